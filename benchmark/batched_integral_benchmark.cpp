@@ -0,0 +1,77 @@
+#include "lebedev_quadrature.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/** Runs `integrate` `n_repeats` times, and returns the average time in microseconds */
+template <typename Integrate>
+double measure(Integrate integrate, unsigned int n_repeats)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < n_repeats; ++i)
+        integrate();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / n_repeats;
+}
+
+
+
+int main()
+{
+    constexpr unsigned int n_repeats = 50;
+    constexpr std::size_t n_integrands = 256;
+
+    std::cout << n_integrands << " integrands\n"
+              << std::setw(8) << "order"
+              << std::setw(18) << "one by one (us)" 
+              << std::setw(16) << "batched (us)"
+              << std::setw(12) << "speedup"
+              << "\n";
+
+    for (unsigned int n = 0; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n))
+            continue;
+
+        const auto order = lebedev::get_rule_order(n);
+        const auto quad_points = lebedev::QuadraturePoints(order);
+        const std::size_t n_points = quad_points.get_weights().size();
+
+        std::vector<double> values(n_integrands * n_points);
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = std::cos(0.001 * i);
+        std::vector<double> integrals(n_integrands);
+
+        lebedev::IntegrationWorkspace workspace;
+        const double one_by_one 
+            = measure([&]()
+                      {
+                          for (std::size_t k = 0; k < n_integrands; ++k)
+                              integrals[k] = quad_points.evaluate_spherical_integral(
+                                  [&](const double*, const double*, const double*, 
+                                      std::size_t, double *) {},
+                                  &values[k * n_points]);
+                      },
+                      n_repeats);
+        const double batched
+            = measure([&]() 
+                      { 
+                          quad_points.evaluate_spherical_integrals(values.data(), n_integrands, 
+                                                                   integrals.data()); 
+                      },
+                      n_repeats);
+
+        std::cout << std::setw(8) << static_cast<unsigned int>(order)
+                  << std::setw(18) << one_by_one
+                  << std::setw(16) << batched
+                  << std::setw(12) << one_by_one / batched
+                  << "\n";
+    }
+
+    return 0;
+}
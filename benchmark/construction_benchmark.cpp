@@ -0,0 +1,87 @@
+#include "lebedev_quadrature.hpp"
+#include "allocation_counter.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+/**
+ * Runs `construct` `n_repeats` times, and returns the average time in
+ * microseconds and the number of allocations per call
+ */
+template <typename Construct>
+std::pair<double, double> measure(Construct construct, unsigned int n_repeats)
+{
+    n_allocations = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < n_repeats; ++i)
+        construct();
+    const auto end = std::chrono::steady_clock::now();
+
+    const double microseconds 
+        = std::chrono::duration<double, std::micro>(end - start).count();
+
+    return {microseconds / n_repeats, 
+            static_cast<double>(n_allocations) / n_repeats};
+}
+
+
+
+int main()
+{
+    constexpr unsigned int n_repeats = 200;
+    const std::size_t max_n_points = 5810;
+    std::unique_ptr<double[]> buffers(new double[4 * max_n_points]);
+
+    std::cout << std::setw(8) << "order"
+              << std::setw(18) << "object (us)" << std::setw(14) << "allocs"
+              << std::setw(18) << "arena (us)" << std::setw(14) << "allocs"
+              << std::setw(18) << "buffers (us)" << std::setw(14) << "allocs"
+              << "\n";
+
+    for (unsigned int n = 0; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n))
+            continue;
+
+        const auto order = lebedev::get_rule_order(n);
+        const std::size_t n_points = lebedev::get_rule_descriptor(n).n_points;
+
+        // a QuadraturePoints object
+        const auto object = measure([order]() { lebedev::QuadraturePoints quad_points(order); },
+                                    n_repeats);
+
+        // a single arena, allocated per rule
+        const auto arena = measure([order, n_points]()
+                                   {
+                                       std::unique_ptr<double[]> arena(new double[4 * n_points]);
+                                       lebedev::generate_quadrature_points(order,
+                                                                           arena.get(),
+                                                                           arena.get() + n_points,
+                                                                           arena.get() + 2 * n_points,
+                                                                           arena.get() + 3 * n_points);
+                                   },
+                                   n_repeats);
+
+        // caller-provided buffers, reused between rules
+        double *x = buffers.get();
+        const auto preallocated = measure([order, n_points, x]()
+                                          {
+                                              lebedev::generate_quadrature_points(order,
+                                                                                  x,
+                                                                                  x + n_points,
+                                                                                  x + 2 * n_points,
+                                                                                  x + 3 * n_points);
+                                          },
+                                          n_repeats);
+
+        std::cout << std::setw(8) << static_cast<unsigned int>(order)
+                  << std::setw(18) << object.first << std::setw(14) << object.second
+                  << std::setw(18) << arena.first << std::setw(14) << arena.second
+                  << std::setw(18) << preallocated.first << std::setw(14) << preallocated.second
+                  << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "lebedev_quadrature.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/** Returns the average time in nanoseconds `integrate` takes, and its result */
+template <typename Integrate>
+double measure(const Integrate &integrate, unsigned int n_repeats, double &result)
+{
+    volatile double sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < n_repeats; ++i)
+        sink = sink + integrate();
+    const auto end = std::chrono::steady_clock::now();
+    result = integrate();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / n_repeats;
+}
+
+
+
+/** Writes x^4 + x^2 y^2 z^2 at each point, in double or single precision */
+template <typename Real>
+void integrand_at_points(const Real *x, const Real *y, const Real *z, std::size_t n, Real *values)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        values[i] = x[i] * x[i] * (x[i] * x[i] + y[i] * y[i] * z[i] * z[i]);
+}
+
+
+
+int main()
+{
+    constexpr unsigned int n_repeats = 20000;
+    const double exact = 4 * M_PI / 5 + 4 * M_PI / 105;
+
+    std::cout << "time in ns per integral of x^4 + x^2 y^2 z^2, and relative error\n";
+    std::cout << std::setw(8) << "order"
+              << std::setw(14) << "double (ns)" << std::setw(10) << "error"
+              << std::setw(14) << "float (ns)" << std::setw(10) << "error"
+              << std::setw(14) << "mixed (ns)" << std::setw(10) << "error" << "\n";
+
+    for (unsigned int n = 2; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n))
+            continue;
+
+        const auto order = lebedev::get_rule_order(n);
+        const lebedev::QuadraturePoints quad_points(order);
+        const lebedev::FloatQuadraturePoints<float> float_rule(quad_points);
+        const lebedev::FloatQuadraturePoints<double> mixed_rule(quad_points);
+        std::vector<double> values(quad_points.get_weights().size());
+        std::vector<float> float_values(values.size());
+
+        double double_result, float_result, mixed_result;
+        const double double_time = measure([&]()
+        {
+            return quad_points.evaluate_spherical_integral(integrand_at_points<double>,
+                                                           values.data());
+        }, n_repeats, double_result);
+        const double float_time = measure([&]()
+        {
+            return float_rule.evaluate_spherical_integral(integrand_at_points<float>,
+                                                          float_values.data());
+        }, n_repeats, float_result);
+        const double mixed_time = measure([&]()
+        {
+            return mixed_rule.evaluate_spherical_integral(integrand_at_points<float>,
+                                                          float_values.data());
+        }, n_repeats, mixed_result);
+
+        std::cout << std::setw(8) << static_cast<unsigned int>(order) << std::setprecision(1)
+                  << std::fixed << std::setw(14) << double_time << std::scientific
+                  << std::setw(10) << std::abs(double_result - exact) / exact
+                  << std::fixed << std::setw(14) << float_time << std::scientific
+                  << std::setw(10) << std::abs(float_result - exact) / exact
+                  << std::fixed << std::setw(14) << mixed_time << std::scientific
+                  << std::setw(10) << std::abs(mixed_result - exact) / exact
+                  << std::defaultfloat << std::setprecision(6) << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include "lebedev_quadrature.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+/** Runs `integrate` `n_repeats` times, and returns the average time in nanoseconds per point */
+template <typename Integrate>
+double measure(Integrate integrate, unsigned int n_repeats, std::size_t n_points)
+{
+    volatile double sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < n_repeats; ++i)
+        sink = sink + integrate();
+    const auto end = std::chrono::steady_clock::now();
+
+    const double nanoseconds 
+        = std::chrono::duration<double, std::nano>(end - start).count();
+
+    return nanoseconds / (n_repeats * n_points);
+}
+
+
+
+int main()
+{
+    constexpr unsigned int n_repeats = 2000;
+
+    auto integrand = [](double x, double y, double z) { return x*x * y*y * z*z + x*y - z; };
+    const lebedev::QuadraturePoints::scalar_function std_function = integrand;
+
+    std::cout << std::setw(8) << "order"
+              << std::setw(22) << "std::function (ns)" 
+              << std::setw(18) << "template (ns)"
+              << std::setw(12) << "speedup"
+              << "\n";
+
+    for (unsigned int n = 0; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n))
+            continue;
+
+        const auto order = lebedev::get_rule_order(n);
+        const auto quad_points = lebedev::QuadraturePoints(order);
+        const std::size_t n_points = quad_points.get_weights().size();
+
+        const double through_std_function 
+            = measure([&]() { return quad_points.evaluate_spherical_integral(std_function); },
+                      n_repeats, n_points);
+        const double inlined 
+            = measure([&]() { return quad_points.evaluate_spherical_integral(integrand); },
+                      n_repeats, n_points);
+
+        std::cout << std::setw(8) << static_cast<unsigned int>(order)
+                  << std::setw(22) << through_std_function
+                  << std::setw(18) << inlined
+                  << std::setw(12) << through_std_function / inlined
+                  << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include "lebedev_quadrature.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/** Integrand which takes around a microsecond to evaluate */
+double expensive_integrand(double x, double y, double z)
+{
+    double t = x + 2*y + 3*z;
+    for (int i = 0; i < 50; ++i)
+        t = std::cos(t) + 0.5 * x;
+
+    return t;
+}
+
+/** Runs `integrate` `n_repeats` times, and returns the average time in milliseconds */
+template <typename Integrate>
+double measure(Integrate integrate, unsigned int n_repeats)
+{
+    volatile double sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < n_repeats; ++i)
+        sink = sink + integrate();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / n_repeats;
+}
+
+
+
+int main()
+{
+    constexpr unsigned int n_repeats = 20;
+    lebedev::ThreadPool pool;
+
+    std::cout << pool.size() << " threads\n"
+              << std::setw(8) << "order"
+              << std::setw(14) << "serial (ms)";
+    for (std::size_t grain_size : {64, 512, 2048})
+        std::cout << std::setw(20) << ("grain " + std::to_string(grain_size) + " (ms)");
+    std::cout << "\n";
+
+    for (unsigned int n = 0; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n) || lebedev::get_rule_descriptor(n).n_points < 1000)
+            continue;
+
+        const auto order = lebedev::get_rule_order(n);
+        const auto quad_points = lebedev::QuadraturePoints(order);
+
+        std::cout << std::setw(8) << static_cast<unsigned int>(order)
+                  << std::setw(14) 
+                  << measure([&]() { return quad_points.evaluate_spherical_integral(expensive_integrand); },
+                             n_repeats);
+        for (std::size_t grain_size : {64, 512, 2048})
+            std::cout << std::setw(20)
+                      << measure([&]() 
+                                 { 
+                                     return quad_points.evaluate_spherical_integral(expensive_integrand, 
+                                                                                    pool, grain_size); 
+                                 },
+                                 n_repeats);
+        std::cout << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include "lebedev_quadrature.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/** Returns the time in microseconds `run` takes, averaged over `n_repeats` calls */
+template <typename Run>
+double measure(const Run &run, unsigned int n_repeats)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < n_repeats; ++i)
+        run();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(end - start).count() / n_repeats;
+}
+
+
+
+int main()
+{
+    constexpr unsigned int n_repeats = 20;
+    constexpr std::size_t n_rotations = 256;
+
+    // rotations about the z-axis and then the x-axis
+    std::vector<lebedev::RotationMatrix> rotations;
+    for (std::size_t r = 0; r < n_rotations; ++r)
+    {
+        const double a = 0.1 * r;
+        const double b = 0.37 * r;
+        rotations.push_back({std::cos(a), -std::sin(a), 0,
+                             std::cos(b) * std::sin(a), std::cos(b) * std::cos(a), -std::sin(b),
+                             std::sin(b) * std::sin(a), std::sin(b) * std::cos(a), std::cos(b)});
+    }
+
+    auto integrand = [](double x, double y, double z) { return x * x * y + y * z * z + 1; };
+    auto integrand_at_points = [](const double *x, const double *y, const double *z,
+                                  std::size_t n, double *values)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            values[i] = x[i] * x[i] * y[i] + y[i] * z[i] * z[i] + 1;
+    };
+
+    std::cout << "time in us to integrate over " << n_rotations << " rotations of a rule\n";
+    std::cout << std::setw(8) << "order" << std::setw(16) << "rotated copy"
+              << std::setw(16) << "rotated view" << std::setw(16) << "batched"
+              << std::setw(16) << "batched blocks" << "\n";
+
+    const lebedev::QuadratureOrder orders[] = {lebedev::QuadratureOrder::order_590,
+                                               lebedev::QuadratureOrder::order_2354,
+                                               lebedev::QuadratureOrder::order_5810};
+    for (const lebedev::QuadratureOrder order : orders)
+    {
+        const lebedev::QuadraturePoints quad_points(order);
+        const std::size_t n = quad_points.get_weights().size();
+        std::vector<double> integrals(n_rotations);
+        lebedev::IntegrationWorkspace workspace;
+
+        // what callers did before: a rotated copy of the points per rotation
+        std::vector<double> x(n), y(n), z(n);
+        const double copy_time = measure([&]()
+        {
+            for (std::size_t r = 0; r < n_rotations; ++r)
+            {
+                lebedev::rotate_points(rotations[r], quad_points.get_x().data(),
+                                       quad_points.get_y().data(), quad_points.get_z().data(),
+                                       n, x.data(), y.data(), z.data());
+                const lebedev::QuadraturePointsView copy(x.data(), y.data(), z.data(),
+                                                         quad_points.get_weights().data(), n);
+                integrals[r] = copy.evaluate_spherical_integral(integrand);
+            }
+        }, n_repeats);
+        const double view_time = measure([&]()
+        {
+            for (std::size_t r = 0; r < n_rotations; ++r)
+                integrals[r] = lebedev::RotatedQuadraturePointsView(quad_points, rotations[r])
+                                   .evaluate_spherical_integral(integrand);
+        }, n_repeats);
+        const double batched_time = measure([&]()
+        {
+            lebedev::evaluate_rotated_spherical_integrals(quad_points, rotations.data(),
+                                                          n_rotations, integrand,
+                                                          integrals.data());
+        }, n_repeats);
+        const double block_time = measure([&]()
+        {
+            lebedev::evaluate_rotated_spherical_integrals(quad_points, rotations.data(),
+                                                          n_rotations, integrand_at_points,
+                                                          integrals.data(), workspace);
+        }, n_repeats);
+
+        std::cout << std::setw(8) << static_cast<unsigned int>(order) << std::setprecision(4)
+                  << std::setw(16) << copy_time << std::setw(16) << view_time
+                  << std::setw(16) << batched_time << std::setw(16) << block_time
+                  << std::setprecision(6) << "\n";
+    }
+
+    return 0;
+}
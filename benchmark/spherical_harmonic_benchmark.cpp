@@ -0,0 +1,197 @@
+#include "lebedev_quadrature.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+/** Returns the time in milliseconds `run` takes, averaged over `n_repeats` calls */
+template <typename Run>
+double measure(const Run &run, unsigned int n_repeats)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < n_repeats; ++i)
+        run();
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / n_repeats;
+}
+
+
+
+int main()
+{
+    constexpr unsigned int n_repeats = 5;
+    constexpr std::size_t n_fields = 16;
+    const lebedev::QuadratureOrder orders[] = {lebedev::QuadratureOrder::order_590,
+                                               lebedev::QuadratureOrder::order_2354};
+    const unsigned int l_maxes[] = {20, 40};
+
+    std::cout << "time in ms to transform " << n_fields << " fields\n";
+    std::cout << std::setw(8) << "order" << std::setw(8) << "l_max"
+              << std::setw(16) << "per (l, m)" << std::setw(16) << "analysis"
+              << std::setw(16) << "synthesis" << std::setw(16) << "both"
+              << std::setw(16) << "fused filter" << "\n";
+
+    for (std::size_t r = 0; r < 2; ++r)
+    {
+        const lebedev::QuadraturePoints quad_points(orders[r]);
+        const lebedev::SphericalHarmonicTransform transform(quad_points, l_maxes[r]);
+        const std::size_t n_points = transform.n_points();
+        const std::size_t n_coefficients = transform.n_coefficients();
+        std::vector<double> harmonics(n_points * n_coefficients);
+        for (std::size_t i = 0; i < n_points; ++i)
+            lebedev::real_spherical_harmonics(quad_points.get_x()[i], quad_points.get_y()[i],
+                                              quad_points.get_z()[i], l_maxes[r],
+                                              harmonics.data() + i * n_coefficients);
+
+        std::vector<double> fields(n_fields * n_points);
+        for (std::size_t f = 0; f < n_fields; ++f)
+            for (std::size_t i = 0; i < n_points; ++i)
+                fields[f * n_points + i] = std::exp(quad_points.get_x()[i] * (1.0 + f))
+                                           * quad_points.get_z()[i];
+        std::vector<double> coefficients(n_fields * n_coefficients);
+        lebedev::IntegrationWorkspace workspace(n_points);
+
+        // one integral per field and harmonic, with the harmonics read from
+        // the same table
+        const double per_harmonic_time = measure([&]()
+        {
+            for (std::size_t f = 0; f < n_fields; ++f)
+                for (std::size_t k = 0; k < n_coefficients; ++k)
+                    coefficients[f * n_coefficients + k] = quad_points.evaluate_spherical_integral(
+                        [&](const double*, const double*, const double*, std::size_t n, double *values)
+                        {
+                            for (std::size_t i = 0; i < n; ++i)
+                                values[i] = fields[f * n_points + i] 
+                                            * harmonics[i * n_coefficients + k];
+                        }, workspace);
+        }, n_repeats);
+        const double analysis_time = measure([&]()
+        {
+            transform.analyze(fields.data(), n_fields, coefficients.data());
+        }, n_repeats);
+
+        std::vector<double> filtered(fields.size());
+        const double synthesis_time = measure([&]()
+        {
+            transform.synthesize(coefficients.data(), n_fields, filtered.data());
+        }, n_repeats);
+
+        // a heat kernel, exp(-l (l + 1) t)
+        std::vector<double> degree_factors(l_maxes[r] + 1);
+        for (unsigned int l = 0; l <= l_maxes[r]; ++l)
+            degree_factors[l] = std::exp(-1e-3 * l * (l + 1));
+        const double unfused_time = measure([&]()
+        {
+            transform.analyze(fields.data(), n_fields, coefficients.data());
+            for (std::size_t f = 0; f < n_fields; ++f)
+                for (unsigned int l = 0; l <= l_maxes[r]; ++l)
+                    for (int m = -static_cast<int>(l); m <= static_cast<int>(l); ++m)
+                        coefficients[f * n_coefficients + lebedev::spherical_harmonic_index(l, m)]
+                            *= degree_factors[l];
+            transform.synthesize(coefficients.data(), n_fields, filtered.data());
+        }, n_repeats);
+        const double filter_time = measure([&]()
+        {
+            transform.filter(fields.data(), n_fields, degree_factors.data(), filtered.data());
+        }, n_repeats);
+
+        std::cout << std::setw(8) << static_cast<unsigned int>(orders[r])
+                  << std::setw(8) << l_maxes[r] << std::setprecision(3)
+                  << std::setw(16) << per_harmonic_time << std::setw(16) << analysis_time
+                  << std::setw(16) << synthesis_time << std::setw(16) << unfused_time
+                  << std::setw(16) << filter_time
+                  << std::setprecision(6) << "\n";
+    }
+
+    // the table against the Legendre recurrence, up to the largest rule
+    const lebedev::QuadratureOrder storage_orders[] = {lebedev::QuadratureOrder::order_590,
+                                                       lebedev::QuadratureOrder::order_2354,
+                                                       lebedev::QuadratureOrder::order_5810};
+    const unsigned int storage_l_maxes[] = {20, 40, 65};
+
+    std::cout << "\nMB held and time in ms to transform " << n_fields
+              << " fields, with a table and with the recurrence\n";
+    std::cout << std::setw(8) << "order" << std::setw(8) << "l_max"
+              << std::setw(12) << "table MB" << std::setw(12) << "analysis"
+              << std::setw(12) << "synthesis" << std::setw(16) << "recurrence MB"
+              << std::setw(12) << "analysis" << std::setw(12) << "synthesis" << "\n";
+
+    for (std::size_t r = 0; r < 3; ++r)
+    {
+        const lebedev::QuadraturePoints quad_points(storage_orders[r]);
+        const lebedev::SphericalHarmonicTransform transforms[]
+            = {lebedev::SphericalHarmonicTransform(quad_points, storage_l_maxes[r]),
+               lebedev::SphericalHarmonicTransform(quad_points, storage_l_maxes[r],
+                                                   lebedev::HarmonicStorage::recurrence)};
+        const std::size_t n_points = transforms[0].n_points();
+
+        std::vector<double> fields(n_fields * n_points);
+        for (std::size_t f = 0; f < n_fields; ++f)
+            for (std::size_t i = 0; i < n_points; ++i)
+                fields[f * n_points + i] = std::exp(quad_points.get_x()[i] * (1.0 + f))
+                                           * quad_points.get_z()[i];
+        std::vector<double> coefficients(n_fields * transforms[0].n_coefficients());
+        std::vector<double> values(fields.size());
+
+        std::cout << std::setw(8) << static_cast<unsigned int>(storage_orders[r])
+                  << std::setw(8) << storage_l_maxes[r] << std::setprecision(3);
+        for (const lebedev::SphericalHarmonicTransform &transform : transforms)
+        {
+            const double analysis_time = measure([&]()
+            {
+                transform.analyze(fields.data(), n_fields, coefficients.data());
+            }, n_repeats);
+            const double synthesis_time = measure([&]()
+            {
+                transform.synthesize(coefficients.data(), n_fields, values.data());
+            }, n_repeats);
+
+            std::cout << std::setw(&transform == transforms ? 12 : 16)
+                      << transform.memory_usage() / 1e6
+                      << std::setw(12) << analysis_time << std::setw(12) << synthesis_time;
+        }
+        std::cout << std::setprecision(6) << "\n";
+    }
+
+    // an invariant field, projected with every point or once per orbit
+    auto cubic_field = [](double x, double y, double z)
+    {
+        return std::exp(x * x * x * x + y * y * y * y + z * z * z * z) * (1 + x * x * y * y * z * z);
+    };
+
+    std::cout << "\ntime in us to project one octahedrally invariant field\n";
+    std::cout << std::setw(8) << "order" << std::setw(8) << "l_max"
+              << std::setw(16) << "full" << std::setw(16) << "cubic" << "\n";
+
+    for (std::size_t r = 1; r < 3; ++r)
+    {
+        const lebedev::QuadraturePoints quad_points(storage_orders[r]);
+        const lebedev::SphericalHarmonicTransform transform(quad_points, storage_l_maxes[r]);
+        const lebedev::CubicHarmonicTransform cubic(storage_orders[r], storage_l_maxes[r]);
+
+        std::vector<double> values(transform.n_points());
+        std::vector<double> coefficients(transform.n_coefficients());
+        const double full_time = measure([&]()
+        {
+            for (std::size_t i = 0; i < values.size(); ++i)
+                values[i] = cubic_field(quad_points.get_x()[i], quad_points.get_y()[i],
+                                        quad_points.get_z()[i]);
+            transform.analyze(values.data(), 1, coefficients.data());
+        }, n_repeats);
+        const double cubic_time = measure([&]()
+        {
+            cubic.project(cubic_field, coefficients.data());
+        }, n_repeats);
+
+        std::cout << std::setw(8) << static_cast<unsigned int>(storage_orders[r])
+                  << std::setw(8) << storage_l_maxes[r] << std::setprecision(3)
+                  << std::setw(16) << 1e3 * full_time << std::setw(16) << 1e3 * cubic_time
+                  << std::setprecision(6) << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include "lebedev_quadrature.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/** Returns the average time in nanoseconds `summation` takes to reduce `n` values */
+double measure(lebedev::Summation summation,
+               const std::vector<double> &values,
+               const std::vector<double> &weights,
+               unsigned int n_repeats)
+{
+    volatile double sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < n_repeats; ++i)
+        sink = sink + lebedev::weighted_sum(summation, values.data(), weights.data(), values.size());
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / n_repeats;
+}
+
+
+
+/** Returns \f$ \sum_i v_i w_i \f$ with compensated long double additions */
+long double reference_sum(const std::vector<double> &values, const std::vector<double> &weights)
+{
+    long double sum = 0;
+    long double compensation = 0;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        const long double term = static_cast<long double>(values[i]) * weights[i];
+        const long double new_sum = sum + term;
+        const long double term_rounded = new_sum - sum;
+        compensation += (sum - (new_sum - term_rounded)) + (term - term_rounded);
+        sum = new_sum;
+    }
+
+    return sum + compensation;
+}
+
+
+
+int main()
+{
+    constexpr unsigned int n_repeats = 20000;
+
+    const lebedev::Summation policies[] = {lebedev::Summation::naive,
+                                           lebedev::Summation::pairwise,
+                                           lebedev::Summation::neumaier,
+                                           lebedev::Summation::double_double};
+    const char *names[] = {"naive", "pairwise", "neumaier", "double-double"};
+    const char *kernel_names[] = {"scalar", "sse2", "avx2", "avx512", "neon"};
+
+    // a degree 2 integrand with a large constant part which the rules
+    // integrate to (nearly) zero, so every digit lost is summation error
+    auto integrand = [](double x, double y) { return 1e8 * (x * x - y * y) + 1.0; };
+
+    std::cout << "kernels use "
+              << kernel_names[static_cast<int>(lebedev::get_simd_kernel())] << "\n";
+    std::cout << "time in ns, and error relative to sum |w_i f_i|\n";
+    std::cout << std::setw(8) << "order";
+    for (const char *name : names)
+        std::cout << std::setw(20) << (std::string(name) + " (ns)") << std::setw(12) << "error";
+    std::cout << "\n";
+
+    for (unsigned int n = 0; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n))
+            continue;
+
+        const auto order = lebedev::get_rule_order(n);
+        const auto quad_points = lebedev::QuadraturePoints(order);
+        const std::vector<double> &weights = quad_points.get_weights();
+        std::vector<double> values(weights.size());
+        double magnitude = 0;
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = integrand(quad_points.get_x()[i], quad_points.get_y()[i]);
+            magnitude += std::abs(values[i] * weights[i]);
+        }
+        const long double expected = reference_sum(values, weights);
+
+        std::cout << std::setw(8) << static_cast<unsigned int>(order);
+        for (const lebedev::Summation summation : policies)
+        {
+            const double sum = lebedev::weighted_sum(summation, values.data(),
+                                                     weights.data(), values.size());
+            std::cout << std::setw(20) << measure(summation, values, weights, n_repeats)
+                      << std::setw(12) << std::setprecision(2)
+                      << static_cast<double>(std::abs(sum - expected) / magnitude)
+                      << std::setprecision(6);
+        }
+        std::cout << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include "lebedev_quadrature.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/** Returns the average time in nanoseconds `kernel` takes to reduce `n` values */
+double measure(lebedev::SimdKernel kernel, 
+               const std::vector<double> &values, 
+               const std::vector<double> &weights,
+               unsigned int n_repeats)
+{
+    volatile double sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < n_repeats; ++i)
+        sink = sink + lebedev::weighted_sum(kernel, values.data(), weights.data(), values.size());
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / n_repeats;
+}
+
+
+
+int main()
+{
+    constexpr unsigned int n_repeats = 20000;
+
+    const lebedev::SimdKernel kernels[] = {lebedev::SimdKernel::scalar,
+                                           lebedev::SimdKernel::sse2,
+                                           lebedev::SimdKernel::avx2,
+                                           lebedev::SimdKernel::avx512,
+                                           lebedev::SimdKernel::neon};
+    const char *names[] = {"scalar", "sse2", "avx2", "avx512", "neon"};
+
+    std::cout << "weighted_sum uses " 
+              << names[static_cast<int>(lebedev::get_simd_kernel())] << "\n";
+    std::cout << std::setw(8) << "order";
+    for (const lebedev::SimdKernel kernel : kernels)
+        if (lebedev::is_simd_kernel_supported(kernel))
+            std::cout << std::setw(12) << (std::string(names[static_cast<int>(kernel)]) + " (ns)");
+    std::cout << "\n";
+
+    for (unsigned int n = 0; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n))
+            continue;
+
+        const auto order = lebedev::get_rule_order(n);
+        const auto quad_points = lebedev::QuadraturePoints(order);
+        const std::vector<double> &weights = quad_points.get_weights();
+        std::vector<double> values(weights.size());
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = std::exp(quad_points.get_x()[i]);
+
+        std::cout << std::setw(8) << static_cast<unsigned int>(order);
+        for (const lebedev::SimdKernel kernel : kernels)
+            if (lebedev::is_simd_kernel_supported(kernel))
+                std::cout << std::setw(12) << measure(kernel, values, weights, n_repeats);
+        std::cout << "\n";
+    }
+
+    return 0;
+}
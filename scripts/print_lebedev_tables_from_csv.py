@@ -2,24 +2,26 @@ import argparse
 import pandas as pd
 
 function_declaration_template = '''template <>
-std::vector<GeneratorPoint>
-make_generator_points<QuadratureOrder::order_{order}>()
+struct GeneratorTable<QuadratureOrder::order_{order}>
 {{
-    return {{'''
+    static constexpr std::array<GeneratorPoint, {n_generators}> generator_points()
+    {{
+        return {{{{'''
 
-function_declaration_end = '''    };
-}'''
+function_declaration_end = '''        }};
+    }
+};'''
 
 generator_point_code_template = [
         '{{1.0, 0.0, 0.0, {weight}, OhPointGen::points_6}}',
-        '{{std::sqrt(0.5), 0.0, 0.0, {weight}, OhPointGen::points_12}}',
-        '{{std::sqrt(1.0/3.0), 0.0, 0.0, {weight}, OhPointGen::points_8}}',
-        '{{{a}, std::sqrt(1.0 - 2.0 * {a} * {a}), 0.0, {weight}, OhPointGen::points_24}}',
-        '{{{a}, std::sqrt(1.0 - {a} * {a}), 0.0, {weight}, OhPointGen::points_24_axis}}',
-        '{{{a}, {b}, std::sqrt(1.0 - {a} * {a} - {b} * {b}), {weight}, OhPointGen::points_48}}'
+        '{{constexpr_sqrt(0.5), 0.0, 0.0, {weight}, OhPointGen::points_12}}',
+        '{{constexpr_sqrt(1.0/3.0), 0.0, 0.0, {weight}, OhPointGen::points_8}}',
+        '{{{a}, constexpr_sqrt(1.0 - 2.0 * {a} * {a}), 0.0, {weight}, OhPointGen::points_24}}',
+        '{{{a}, constexpr_sqrt(1.0 - {a} * {a}), 0.0, {weight}, OhPointGen::points_24_axis}}',
+        '{{{a}, {b}, constexpr_sqrt(1.0 - {a} * {a} - {b} * {b}), {weight}, OhPointGen::points_48}}'
         ]
 
-indent_padding = ' ' * 8
+indent_padding = ' ' * 12
 
 def get_commandline_args():
 
@@ -48,10 +50,11 @@ def main():
     for order in available_orders:
 
         order_table = lebedev_table[ lebedev_table['order'] == order ].reset_index()
-        generator_points_function = function_declaration_template.format(order=order)
+        n_rows = order_table.shape[0]
+        generator_points_function = function_declaration_template.format(order=order,
+                                                                          n_generators=n_rows)
         generator_points_function += '\n'
 
-        n_rows = order_table.shape[0]
         for i, table_row in order_table.iterrows():
             rule = table_row['rule']
             weight = table_row['weight']
@@ -0,0 +1,281 @@
+#ifndef COMPRESSED_QUADRATURE_POINTS_HPP
+#define COMPRESSED_QUADRATURE_POINTS_HPP
+
+#include "preprocessor.hpp"
+#include "quadrature_order.hpp"
+#include "generator_point.hpp"
+#include "quadrature_points.hpp"
+
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#ifndef LEBEDEV_CHECK_SYMMETRY
+#ifdef NDEBUG
+#define LEBEDEV_CHECK_SYMMETRY 0
+#else
+#define LEBEDEV_CHECK_SYMMETRY 1
+#endif
+#endif
+
+namespace lebedev {
+
+/**
+ * \brief Largest difference, relative to the largest value sampled, which
+ * `CompressedQuadraturePoints::has_symmetry` allows between values at
+ * points which are images of each other.
+ */
+constexpr double symmetry_tolerance = 1e-10;
+
+/**
+ * \brief Lebedev rule stored as its generator points only, with the 
+ * quadrature points expanded from them as integrals are evaluated.
+ *
+ * A generator point takes 40 bytes and stands for up to 48 quadrature 
+ * points (32 bytes each when expanded), so this takes around a twentieth of
+ * the memory of `QuadraturePoints` for the larger orders (about 13 kB for
+ * order 5810), which lets many rules stay in cache at once.
+ * Points are visited in the same order as those of `QuadraturePoints`.
+ */
+class CompressedQuadraturePoints
+{
+public:
+    /** \brief scalar_function */
+    using scalar_function = QuadraturePoints::scalar_function;
+
+    /** \brief Copies generator points of a tabulated rule */
+    CompressedQuadraturePoints(QuadratureOrder quad_order);
+
+    /** \brief Copies generator points, e.g. of a rule read at runtime (see `read_generator_table`) */
+    explicit CompressedQuadraturePoints(const std::vector<GeneratorPoint> &generator_points);
+
+    /** \brief Calculates spherical integral given a function object.
+     *
+     * The function object `integrand_at_point` takes three doubles `x`, `y`, `z`
+     * corresponding to the coordinates of the evaluation point.
+     * It should return a double corresponding to the integrand evaluated at that point.
+     * The integrand is summed over each orbit before being multiplied by the
+     * orbit's weight.
+     */
+    double 
+    evaluate_spherical_integral(const scalar_function& integrand_at_point) const;
+
+    /** \brief Calculates spherical integral given any callable.
+     *
+     * Same as the `scalar_function` overload, but `integrand_at_point` is
+     * called directly, so that it can be inlined into the orbit loops.
+     */
+    template <typename ScalarFunction>
+    auto evaluate_spherical_integral(const ScalarFunction &integrand_at_point) const
+        -> decltype(static_cast<double>(integrand_at_point(0.0, 0.0, 0.0)))
+    {
+        double sum = 0;
+        for (const GeneratorPoint &generator_point : generator_points)
+            sum += generator_point.get_weight() 
+                   * sum_over_orbit<double>(generator_point, integrand_at_point);
+
+        return 4 * M_PI * sum;
+    }
+
+    /** \brief Calculates spherical integral of an integrand declared to
+     * have `symmetry`, evaluating it only at the points that needs.
+     *
+     * With `IntegrandSymmetry::octahedral` the integrand is evaluated once
+     * per orbit, and with `IntegrandSymmetry::reflections` once per point
+     * with non-negative coordinates, and each value is scaled by the number
+     * of points it stands for: 6-48 and 2-8 times fewer evaluations 
+     * respectively.
+     * The result is only correct if the integrand does have `symmetry`.
+     * When `LEBEDEV_CHECK_SYMMETRY` is nonzero (by default, unless `NDEBUG`
+     * is defined), this is checked with `has_symmetry` first, and 
+     * `std::invalid_argument` is thrown if it does not.
+     */
+    double 
+    evaluate_spherical_integral(const scalar_function& integrand_at_point,
+                                IntegrandSymmetry symmetry) const;
+
+    /** \brief Calculates spherical integral of any callable declared to have
+     * `symmetry`, called directly.
+     */
+    template <typename ScalarFunction>
+    auto evaluate_spherical_integral(const ScalarFunction &integrand_at_point,
+                                     IntegrandSymmetry symmetry) const
+        -> decltype(static_cast<double>(integrand_at_point(0.0, 0.0, 0.0)))
+    {
+#if LEBEDEV_CHECK_SYMMETRY
+        if (!has_symmetry(integrand_at_point, symmetry))
+            throw std::invalid_argument("Integrand does not have the declared symmetry");
+#endif
+
+        double sum = 0;
+        for (const GeneratorPoint &generator_point : generator_points)
+            sum += generator_point.get_weight() 
+                   * sum_over_orbit<double>(generator_point, integrand_at_point, symmetry);
+
+        return 4 * M_PI * sum;
+    }
+
+    /** \brief Returns whether `integrand_at_point` appears to have `symmetry`,
+     * by comparing its value at one sample point per orbit with its value
+     * at an image of that point under the symmetry.
+     *
+     * The sample points (see `symmetry_sample`) lie off every axis and
+     * mirror plane, so no image is the sample itself, and an integrand
+     * which only breaks the symmetry away from the planes of the rule's
+     * points is still caught.
+     * The values may differ by `symmetry_tolerance` times the largest value
+     * sampled, to allow for rounding.
+     * This evaluates the integrand twice per orbit, so is cheaper than an 
+     * integral without the symmetry, but it is a sample: an integrand which
+     * breaks the symmetry at other points is not caught.
+     */
+    template <typename ScalarFunction>
+    auto has_symmetry(const ScalarFunction &integrand_at_point,
+                      IntegrandSymmetry symmetry) const
+        -> decltype(static_cast<double>(integrand_at_point(0.0, 0.0, 0.0)), bool())
+    {
+        if (symmetry == IntegrandSymmetry::none)
+            return true;
+
+        double largest_value = 0;
+        double largest_difference = 0;
+        for (std::size_t j = 0; j < generator_points.size(); ++j)
+        {
+            const GeneratorPoint sample_point = symmetry_sample(j);
+            // permutes the coordinates and flips at least one sign, so
+            // differs from the first point and from its reflections (for
+            // the first orbit, by a cyclic permutation and negating x, so
+            // neither a rotation nor an even number of reflections)
+            const unsigned int sample = 8 * (1 + (j + 2) % 5) + 1 + j % 7;
+            const unsigned int image 
+                = symmetry == IntegrandSymmetry::octahedral 
+                  ? 0 
+                  : reflection_representative(OhPointGen::points_48, sample);
+
+            const double sample_value = integrand_at_point(sample_point.get_x(sample),
+                                                           sample_point.get_y(sample),
+                                                           sample_point.get_z(sample));
+            const double image_value = integrand_at_point(sample_point.get_x(image),
+                                                          sample_point.get_y(image),
+                                                          sample_point.get_z(image));
+
+            largest_value = std::max({largest_value, 
+                                      std::abs(sample_value), 
+                                      std::abs(image_value)});
+            largest_difference = std::max(largest_difference,
+                                          std::abs(sample_value - image_value));
+        }
+
+        return largest_difference <= symmetry_tolerance * largest_value;
+    }
+
+    /** \brief Calculates spherical integral of each component of an
+     * array-valued integrand, in one pass.
+     *
+     * `integrand_at_point` may be any callable which takes three doubles
+     * `x`, `y`, `z` and returns a `std::array<double, K>`; see
+     * `QuadraturePoints::evaluate_spherical_integral`.
+     */
+    template <typename ArrayFunction>
+    auto evaluate_spherical_integral(const ArrayFunction &integrand_at_point) const
+        -> typename array_integrand_result<
+               typename std::decay<decltype(integrand_at_point(0.0, 0.0, 0.0))>::type>::type
+    {
+        using result = typename std::decay<decltype(integrand_at_point(0.0, 0.0, 0.0))>::type;
+
+        result sum = {};
+        for (const GeneratorPoint &generator_point : generator_points)
+            accumulate_weighted(sum, generator_point.get_weight(), 
+                                sum_over_orbit<result>(generator_point, integrand_at_point));
+
+        for (double &component : sum)
+            component *= 4 * M_PI;
+
+        return sum;
+    }
+
+    /** \brief Returns number of quadrature points */
+    std::size_t size() const;
+
+    /** \brief Returns number of bytes held by this rule */
+    std::size_t memory_usage() const;
+
+    /** \brief Returns const reference to generator points of rule */
+    const std::vector<GeneratorPoint>& get_generator_points() const;
+
+private:
+
+    /** \brief Sums `integrand_at_point` (whose values are `Result`s) over the
+     * points generated by `generator_point`, or over those which stand for
+     * the others under `symmetry`, scaled by the number of points each
+     * stands for */
+    template <typename Result, typename Function>
+    static Result sum_over_orbit(const GeneratorPoint &generator_point, 
+                                 const Function &integrand_at_point,
+                                 IntegrandSymmetry symmetry = IntegrandSymmetry::none)
+    {
+        // indexed by the entries of `orbit_patterns`, offset by 3
+        const double a = generator_point.get_a();
+        const double b = generator_point.get_b();
+        const double c = generator_point.get_c();
+        const double components[7] = {-c, -b, -a, 0.0, a, b, c};
+
+        const OhPointGen generating_rule = generator_point.get_generating_rule();
+        const auto rule = static_cast<unsigned int>(generating_rule);
+        const signed char *x_pattern = orbit_patterns[rule][0];
+        const signed char *y_pattern = orbit_patterns[rule][1];
+        const signed char *z_pattern = orbit_patterns[rule][2];
+
+        Result orbit_sum = {};
+        const unsigned int n = generator_point.n_points();
+        if (symmetry == IntegrandSymmetry::octahedral)
+        {
+            accumulate_weighted(orbit_sum, n, integrand_at_point(components[3 + x_pattern[0]],
+                                                                 components[3 + y_pattern[0]],
+                                                                 components[3 + z_pattern[0]]));
+            return orbit_sum;
+        }
+
+        if (symmetry == IntegrandSymmetry::reflections)
+        {
+            const double class_size = reflection_class_size(generating_rule);
+            for (unsigned int i = 0; i < n; ++i)
+                if (x_pattern[i] >= 0 && y_pattern[i] >= 0 && z_pattern[i] >= 0)
+                    accumulate_weighted(orbit_sum, class_size, 
+                                        integrand_at_point(components[3 + x_pattern[i]],
+                                                           components[3 + y_pattern[i]],
+                                                           components[3 + z_pattern[i]]));
+            return orbit_sum;
+        }
+
+        for (unsigned int i = 0; i < n; ++i)
+            accumulate_weighted(orbit_sum, 1.0, integrand_at_point(components[3 + x_pattern[i]],
+                                                                   components[3 + y_pattern[i]],
+                                                                   components[3 + z_pattern[i]]));
+
+        return orbit_sum;
+    }
+
+    /** \brief Returns the index of the point of an orbit generated by
+     * `generating_rule` with non-negative coordinates, which stands for
+     * point `i` when the integrand is even in each coordinate */
+    static unsigned int reflection_representative(OhPointGen generating_rule, unsigned int i);
+
+    /** \brief Returns the `j`th point sampled by `has_symmetry`, as a
+     * generator of 48 points: its coordinates are positive and distinct, so
+     * it lies off every axis and mirror plane of the octahedral group */
+    static GeneratorPoint symmetry_sample(std::size_t j);
+
+    /** \brief Generator points of rule */
+    std::vector<GeneratorPoint> generator_points;
+    /** \brief Number of quadrature points generated by `generator_points` */
+    std::size_t n_points;
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,141 @@
+#include "preprocessor.hpp"
+#include "compressed_quadrature_points.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace lebedev {
+
+LEBEDEV_INTERNAL_LINKAGE
+std::size_t count_quadrature_points(const std::vector<GeneratorPoint> &generator_points)
+{
+    std::size_t n_points = 0;
+    for (const GeneratorPoint &generator_point : generator_points)
+        n_points += generator_point.n_points();
+
+    return n_points;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+CompressedQuadraturePoints::CompressedQuadraturePoints(QuadratureOrder quad_order)
+{
+    const RuleDescriptor &descriptor = get_rule_descriptor(quad_order);
+    if (!descriptor.available)
+        throw std::invalid_argument("Lebedev order not available");
+
+    const GeneratorPoint *table = descriptor.get_generator_points();
+    generator_points.assign(table, table + descriptor.n_generators);
+    n_points = descriptor.n_points;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+CompressedQuadraturePoints::
+CompressedQuadraturePoints(const std::vector<GeneratorPoint> &generator_points)
+    : generator_points(generator_points)
+    , n_points(count_quadrature_points(generator_points))
+{
+    for (const GeneratorPoint &generator_point : generator_points)
+        if (static_cast<unsigned int>(generator_point.get_generating_rule()) >= n_generating_rules)
+            throw std::invalid_argument("Not a valid octahedral generating rule");
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+double CompressedQuadraturePoints::
+evaluate_spherical_integral(const scalar_function& integrand_at_point) const
+{
+    double sum = 0;
+    for (const GeneratorPoint &generator_point : generator_points)
+        sum += generator_point.get_weight() 
+               * sum_over_orbit<double>(generator_point, integrand_at_point);
+
+    return 4 * M_PI * sum;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+double CompressedQuadraturePoints::
+evaluate_spherical_integral(const scalar_function& integrand_at_point,
+                            IntegrandSymmetry symmetry) const
+{
+#if LEBEDEV_CHECK_SYMMETRY
+    if (!has_symmetry(integrand_at_point, symmetry))
+        throw std::invalid_argument("Integrand does not have the declared symmetry");
+#endif
+
+    double sum = 0;
+    for (const GeneratorPoint &generator_point : generator_points)
+        sum += generator_point.get_weight() 
+               * sum_over_orbit<double>(generator_point, integrand_at_point, symmetry);
+
+    return 4 * M_PI * sum;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+unsigned int CompressedQuadraturePoints::
+reflection_representative(OhPointGen generating_rule, unsigned int i)
+{
+    const auto rule = static_cast<unsigned int>(generating_rule);
+    for (unsigned int j = 0; j < orbit_size(generating_rule); ++j)
+    {
+        bool represents_i = true;
+        for (unsigned int k = 0; k < 3; ++k)
+            represents_i = represents_i && orbit_patterns[rule][k][j] >= 0
+                           && orbit_patterns[rule][k][j] == std::abs(orbit_patterns[rule][k][i]);
+        if (represents_i)
+            return j;
+    }
+
+    return i;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+GeneratorPoint CompressedQuadraturePoints::symmetry_sample(std::size_t j)
+{
+    // each coordinate at least 0.1 more than the last before normalizing,
+    // spread over the region 0 < a < b < c by golden-ratio steps
+    const double a = 0.1 + std::fmod(0.5 + 0.618034 * j, 1.0);
+    const double b = a + 0.1 + std::fmod(0.3 + 0.754878 * j, 1.0);
+    const double c = b + 0.1 + std::fmod(0.1 + 0.569840 * j, 1.0);
+    const double norm = std::sqrt(a * a + b * b + c * c);
+
+    return GeneratorPoint(a / norm, b / norm, c / norm, 0.0, OhPointGen::points_48);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t CompressedQuadraturePoints::size() const
+{
+    return n_points;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+std::size_t CompressedQuadraturePoints::memory_usage() const
+{
+    return sizeof(CompressedQuadraturePoints)
+           + sizeof(GeneratorPoint) * generator_points.capacity();
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+const std::vector<GeneratorPoint>& CompressedQuadraturePoints::get_generator_points() const
+{
+    return generator_points;
+}
+
+} // namespace lebedev
@@ -0,0 +1,82 @@
+#ifndef CONSTEXPR_MATH_HPP
+#define CONSTEXPR_MATH_HPP
+
+namespace lebedev {
+
+/** \brief Absolute value which may be evaluated at compile time */
+constexpr double constexpr_abs(double x)
+{
+    return x < 0 ? -x : x;
+}
+
+
+
+/**
+ * \brief Computes `r * r - v` without rounding error in the product.
+ *
+ * The product is split into high and low parts (Dekker's algorithm) so that
+ * the residual of a candidate square root can be compared exactly with the
+ * residual of its neighbors.
+ */
+constexpr double square_residual(double r, double v)
+{
+    const double p = r * r;
+    const double t = 134217729.0 * r;
+    const double r_high = t - (t - r);
+    const double r_low = r - r_high;
+    const double error = ((r_high * r_high - p) + 2.0 * r_high * r_low)
+                         + r_low * r_low;
+
+    return (p - v) + error;
+}
+
+
+
+/**
+ * \brief Square root which may be evaluated at compile time.
+ *
+ * Newton iteration is run until it reaches a fixed point (or starts
+ * oscillating between two neighboring doubles), then the result is nudged to
+ * whichever of its neighbors has the smallest exact residual.
+ * The result is the correctly rounded square root, so it agrees bit-for-bit
+ * with `std::sqrt`.
+ */
+constexpr double constexpr_sqrt(double v)
+{
+    if (v <= 0)
+        return 0;
+
+    double x = v > 1 ? v : 1.0;
+    double previous = 0;
+    double previous_2 = 0;
+    while (x != previous && x != previous_2)
+    {
+        previous_2 = previous;
+        previous = x;
+        x = 0.5 * (x + v / x);
+    }
+
+    double binade = 1.0;
+    while (binade <= x)
+        binade *= 2.0;
+    while (binade > x)
+        binade *= 0.5;
+
+    // 2^-52 written out, since hexadecimal float literals are C++17
+    const double ulp = binade * 2.220446049250313080847263336181640625e-16;
+    const double ulp_below = (x == binade) ? 0.5 * ulp : ulp;
+
+    double best = x;
+    if (constexpr_abs(square_residual(x + ulp, v))
+        < constexpr_abs(square_residual(best, v)))
+        best = x + ulp;
+    if (constexpr_abs(square_residual(x - ulp_below, v))
+        < constexpr_abs(square_residual(best, v)))
+        best = x - ulp_below;
+
+    return best;
+}
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef CSV_TABLE_HPP
+#define CSV_TABLE_HPP
+
+#include "preprocessor.hpp"
+#include "quadrature_order.hpp"
+#include "generator_point.hpp"
+#include "rule_pack.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace lebedev {
+
+/**
+ * \brief Parses a table of generator points in the format of
+ * `data/lebedev_quadrature_table.csv`.
+ *
+ * Each row is `weight,rule,order,a,b`, where `rule` is 1 through 6 for
+ * `points_6`, `points_12`, `points_8`, `points_24`, `points_24_axis`, and
+ * `points_48` respectively, `order` is the number of points of the rule the
+ * row belongs to, and `a`, `b` are left empty when the rule does not use them.
+ * An optional header row and blank lines are skipped.
+ * The remaining components of each generator point are computed in the same
+ * way as for the tabulated rules.
+ * Numbers are converted as by `std::strtod` in the "C" locale, whatever the
+ * global locale, which rounds correctly, so a few values may differ in the
+ * last bit from the compiled-in tables (these were converted by the Python
+ * script, whose parser does not always round correctly).
+ *
+ * Returns one entry per order, in the order in which they first appear, with
+ * the generator points in the order of their rows.
+ * The table does not give precisions, so an order which is not a
+ * `QuadratureOrder` (e.g. a rule from an extended table) is returned with
+ * precision 0.
+ * Throws `std::invalid_argument` naming the offending line if the table is
+ * malformed, or if its generator points do not add up to the order.
+ */
+std::vector<RulePackEntry> parse_generator_table(const std::string &text);
+
+/**
+ * \brief Reads a table of generator points from file `filename`, see
+ * `parse_generator_table` for the format.
+ *
+ * The file is read into one buffer and parsed in place, and error messages
+ * are only built when a row is rejected, so the other allocations are those
+ * of the returned rules and their generator points (about 200 for the 1287
+ * rows of `data/lebedev_quadrature_table.csv`).
+ */
+std::vector<RulePackEntry> read_generator_table(const std::string &filename);
+
+/**
+ * \brief Reads the generator points of the rule with order `quad_order` from
+ * table file `filename`.
+ *
+ * Pass them to `QuadraturePoints` to expand them into a rule.
+ */
+std::vector<GeneratorPoint> read_generator_points(const std::string &filename, 
+                                                  QuadratureOrder quad_order);
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,288 @@
+#include "preprocessor.hpp"
+
+#include "csv_table.hpp"
+#include "quadrature_order.hpp"
+#include "generator_point.hpp"
+#include "rule_pack.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LEBEDEV_CSV_STRTOD_L 1
+#include <locale.h>
+#include <stdlib.h>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+#elif defined(_WIN32)
+#define LEBEDEV_CSV_STRTOD_L 1
+#include <locale.h>
+#include <stdlib.h>
+#else
+#define LEBEDEV_CSV_STRTOD_L 0
+#endif
+
+namespace lebedev {
+
+/** \brief Returns whether `c` ends a field of a table row */
+LEBEDEV_INTERNAL_LINKAGE
+bool is_field_end(char c)
+{
+    return c == ',' || c == '\n' || c == '\r' || c == '\0';
+}
+
+
+
+/**
+ * \brief Throws `std::invalid_argument` for line `line_number` of a table.
+ *
+ * The message is only built here, so valid rows allocate nothing.
+ */
+[[noreturn]] LEBEDEV_INTERNAL_LINKAGE
+void throw_table_error(std::size_t line_number, const std::string &what)
+{
+    throw std::invalid_argument("Generator table line " + std::to_string(line_number) 
+                                + ": " + what);
+}
+
+
+
+/**
+ * \brief Returns whether `value` is a whole number from 1 to `limit`, which
+ * must be checked before converting it to an integer.
+ */
+LEBEDEV_INTERNAL_LINKAGE
+bool is_whole_number_in_range(double value, double limit)
+{
+    return std::isfinite(value) && value >= 1 && value <= limit && value == std::floor(value);
+}
+
+
+
+/**
+ * \brief Converts the number at `text` as `std::strtod` does in the "C"
+ * locale, whatever the global locale, so that a decimal comma locale does
+ * not stop it at the `.`.
+ */
+LEBEDEV_INTERNAL_LINKAGE
+double parse_c_locale_number(const char *text, char **number_end)
+{
+#if LEBEDEV_CSV_STRTOD_L && defined(_WIN32)
+    static const _locale_t c_locale = _create_locale(LC_NUMERIC, "C");
+    return _strtod_l(text, number_end, c_locale);
+#elif LEBEDEV_CSV_STRTOD_L
+    static const locale_t c_locale = newlocale(LC_NUMERIC_MASK, "C", static_cast<locale_t>(0));
+    return strtod_l(text, number_end, c_locale);
+#else
+    return std::strtod(text, number_end);
+#endif
+}
+
+
+
+/**
+ * \brief Parses the number at `cursor` and moves `cursor` past it and its
+ * trailing comma.
+ *
+ * Returns false (leaving `value` untouched) if the field is empty.
+ */
+LEBEDEV_INTERNAL_LINKAGE
+bool parse_table_field(const char *&cursor, double &value, std::size_t line_number)
+{
+    bool present = false;
+    if (!is_field_end(*cursor))
+    {
+        char *number_end = nullptr;
+        value = parse_c_locale_number(cursor, &number_end);
+        if (number_end == cursor || !is_field_end(*number_end))
+            throw_table_error(line_number, "could not parse number");
+
+        cursor = number_end;
+        present = true;
+    }
+
+    if (*cursor == ',')
+        ++cursor;
+
+    return present;
+}
+
+
+
+/**
+ * \brief Makes the generator point of a table row, computing the components
+ * which are fixed by the generating rule.
+ */
+LEBEDEV_INTERNAL_LINKAGE
+GeneratorPoint make_table_generator_point(unsigned int rule, 
+                                          double weight, 
+                                          double a, 
+                                          double b)
+{
+    switch (rule)
+    {
+    case 1:
+        return {1.0, 0.0, 0.0, weight, OhPointGen::points_6};
+    case 2:
+        return {std::sqrt(0.5), 0.0, 0.0, weight, OhPointGen::points_12};
+    case 3:
+        return {std::sqrt(1.0/3.0), 0.0, 0.0, weight, OhPointGen::points_8};
+    case 4:
+        return {a, std::sqrt(1.0 - 2.0 * a * a), 0.0, weight, OhPointGen::points_24};
+    case 5:
+        return {a, std::sqrt(1.0 - a * a), 0.0, weight, OhPointGen::points_24_axis};
+    default:
+        return {a, b, std::sqrt(1.0 - a * a - b * b), weight, OhPointGen::points_48};
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::vector<RulePackEntry> parse_generator_table(const std::string &text)
+{
+    // c_str is null-terminated, so strtod always stops within the text
+    const char *cursor = text.c_str();
+    const char *end = cursor + text.size();
+
+    std::vector<RulePackEntry> rules;
+    std::vector<unsigned int> rule_n_points;
+    std::vector<unsigned int> rule_orders;
+    std::size_t current_rule = 0;
+
+    for (std::size_t line_number = 1; cursor < end; ++line_number)
+    {
+        const char *line_end = cursor;
+        while (line_end < end && *line_end != '\n')
+            ++line_end;
+
+        // skip blank lines, and the header if it comes before any rows
+        const bool is_blank = cursor == line_end || *cursor == '\r';
+        const bool is_header = rules.empty() && *cursor >= 'a' && *cursor <= 'z';
+        if (is_blank || is_header)
+        {
+            cursor = line_end + 1;
+            continue;
+        }
+
+        if (std::count(cursor, line_end, ',') != 4)
+            throw_table_error(line_number, "expected 5 fields");
+
+        double weight = 0, rule = 0, order = 0, a = 0, b = 0;
+        if (!parse_table_field(cursor, weight, line_number)
+            || !parse_table_field(cursor, rule, line_number)
+            || !parse_table_field(cursor, order, line_number))
+            throw_table_error(line_number, "weight, rule and order are required");
+
+        const bool has_a = parse_table_field(cursor, a, line_number);
+        const bool has_b = parse_table_field(cursor, b, line_number);
+        while (*cursor == '\r')
+            ++cursor;
+        if (cursor != line_end)
+            throw_table_error(line_number, "unexpected characters at end of line");
+
+        if (!is_whole_number_in_range(rule, n_generating_rules))
+            throw_table_error(line_number, "rule must be 1 through 6");
+        const auto rule_number = static_cast<unsigned int>(rule);
+        if ((rule_number >= 4 && !has_a) || (rule_number == 6 && !has_b))
+            throw_table_error(line_number, "rule " + std::to_string(rule_number) + " needs a"
+                                           + (rule_number == 6 ? " and b" : ""));
+
+        const GeneratorPoint generator_point 
+            = make_table_generator_point(rule_number, weight, a, b);
+        // the fixed components are NaN if a and b do not lie on the unit sphere
+        if (!std::isfinite(generator_point.get_a()) || !std::isfinite(generator_point.get_b())
+            || !std::isfinite(generator_point.get_c()))
+            throw_table_error(line_number, "point is not on the unit sphere");
+
+        if (!is_whole_number_in_range(order, std::numeric_limits<unsigned int>::max()))
+            throw_table_error(line_number, "order must be a positive whole number");
+        const auto order_number = static_cast<unsigned int>(order);
+
+        // rows of one order are normally contiguous, so only search on a change
+        if (rules.empty() || rule_orders[current_rule] != order_number)
+        {
+            current_rule = 0;
+            while (current_rule < rules.size() && rule_orders[current_rule] != order_number)
+                ++current_rule;
+
+            if (current_rule == rules.size())
+            {
+                rules.push_back({0, {}});
+                rule_orders.push_back(order_number);
+                rule_n_points.push_back(0);
+            }
+        }
+
+        rules[current_rule].generator_points.push_back(generator_point);
+        rule_n_points[current_rule] += generator_point.n_points();
+
+        cursor = line_end + 1;
+    }
+
+    for (std::size_t i = 0; i < rules.size(); ++i)
+    {
+        if (rule_n_points[i] != rule_orders[i])
+            throw std::invalid_argument("Generator table rule of order " 
+                                        + std::to_string(rule_orders[i])
+                                        + " has generator points giving " 
+                                        + std::to_string(rule_n_points[i]) + " points");
+
+        // the table has no precision, so it is only known for orders of the library
+        const unsigned int rule_number = find_rule_number(rule_orders[i]);
+        rules[i].precision = rule_number == no_rule_number 
+                             ? 0 : get_rule_descriptor(rule_number).precision;
+    }
+
+    return rules;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::vector<RulePackEntry> read_generator_table(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file)
+        throw std::runtime_error("Could not open generator table file " + filename);
+
+    std::string contents(static_cast<std::size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    file.read(&contents[0], static_cast<std::streamsize>(contents.size()));
+    if (!file)
+        throw std::runtime_error("Could not read generator table file " + filename);
+
+    return parse_generator_table(contents);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::vector<GeneratorPoint> read_generator_points(const std::string &filename, 
+                                                  QuadratureOrder quad_order)
+{
+    std::vector<RulePackEntry> rules = read_generator_table(filename);
+    for (RulePackEntry &rule : rules)
+    {
+        std::size_t n_points = 0;
+        for (const GeneratorPoint &generator_point : rule.generator_points)
+            n_points += generator_point.n_points();
+
+        if (n_points == static_cast<std::size_t>(quad_order))
+            return std::move(rule.generator_points);
+    }
+
+    throw std::invalid_argument("Generator table file " + filename 
+                                + " holds no rule of order "
+                                + std::to_string(static_cast<unsigned int>(quad_order)));
+}
+
+} // namespace lebedev
@@ -0,0 +1,322 @@
+#include "preprocessor.hpp"
+#include "cubic_harmonics.hpp"
+#include "spherical_harmonics.hpp"
+#include "weighted_sum.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace lebedev {
+
+LEBEDEV_EXTERNAL_LINKAGE
+unsigned int n_cubic_harmonics_of_degree(unsigned int l)
+{
+    // one for each invariant (x^4 + y^4 + z^4)^i (x^2 y^2 z^2)^j of degree l
+    if (l % 2 != 0)
+        return 0;
+
+    unsigned int n = 0;
+    for (unsigned int i = 0; 4 * i <= l; ++i)
+        if ((l - 4 * i) % 6 == 0)
+            ++n;
+
+    return n;
+}
+
+
+
+/**
+ * \brief Writes the average of the real harmonics of degree up to `l_max`
+ * over the images of the unit vector `u` under the octahedral group (all
+ * 48 signed permutations of its coordinates) to `averages`.
+ *
+ * By the addition theorem these are the coefficients, up to a factor
+ * \f$ 4 \pi / (2l + 1) \f$ in each degree, of the symmetrized Legendre
+ * polynomial \f$ \frac{1}{48} \sum_g P_l(g u \cdot x) \f$, which is
+ * invariant.
+ */
+LEBEDEV_INTERNAL_LINKAGE
+void average_octahedral_images(const double *u, unsigned int l_max, double *averages)
+{
+    const unsigned int permutations[6][3]
+        = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+    const std::size_t n_harmonics = n_spherical_harmonics(l_max);
+
+    std::fill(averages, averages + n_harmonics, 0.0);
+    std::vector<double> values(n_harmonics);
+    for (const auto &permutation : permutations)
+        for (unsigned int signs = 0; signs < 8; ++signs)
+        {
+            const double x = (signs & 1 ? -1 : 1) * u[permutation[0]];
+            const double y = (signs & 2 ? -1 : 1) * u[permutation[1]];
+            const double z = (signs & 4 ? -1 : 1) * u[permutation[2]];
+            real_spherical_harmonics(x, y, z, l_max, values.data());
+            for (std::size_t k = 0; k < n_harmonics; ++k)
+                averages[k] += values[k] / 48;
+        }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+CubicHarmonicTransform::CubicHarmonicTransform(QuadratureOrder quad_order, unsigned int l_max)
+    : CubicHarmonicTransform(CompressedQuadraturePoints(quad_order).get_generator_points(), l_max)
+{}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+CubicHarmonicTransform::
+CubicHarmonicTransform(const std::vector<GeneratorPoint> &generator_points, unsigned int l_max)
+    : l_max(l_max)
+    , rule(generator_points)
+{
+    unsigned int largest_dimension = 0;
+    for (unsigned int l = 0; l <= l_max; ++l)
+        largest_dimension = std::max(largest_dimension, n_cubic_harmonics_of_degree(l));
+
+    // the invariant harmonics of each degree are spanned by the averages of
+    // the harmonics over the images of generic points, x > y > z > 0
+    const std::size_t n_seeds = 2 * largest_dimension + 8;
+    const std::size_t n_harmonics = n_spherical_harmonics(l_max);
+    std::vector<double> averages(n_seeds * n_harmonics);
+    for (std::size_t s = 0; s < n_seeds; ++s)
+    {
+        const double t = 0.05 + 0.9 * std::fmod(0.1 + s * 0.7548776662466927, 1.0);
+        const double r = 0.05 + 0.9 * std::fmod(0.3 + s * 0.5698402909980532, 1.0);
+        const double norm = std::sqrt(1 + t * t + t * t * r * r);
+        const double u[3] = {1 / norm, t / norm, t * r / norm};
+        average_octahedral_images(u, l_max, averages.data() + s * n_harmonics);
+    }
+
+    // so a pivoted Gram-Schmidt process on the averages of each degree,
+    // taking the largest remaining one each time, gives an orthonormal basis
+    for (unsigned int l = 0; l <= l_max; ++l)
+    {
+        const unsigned int dimension = n_cubic_harmonics_of_degree(l);
+        const std::size_t n_orders = 2 * l + 1;
+        std::vector<double> residuals(n_seeds * n_orders);
+        for (std::size_t s = 0; s < n_seeds; ++s)
+            std::copy(averages.begin() + s * n_harmonics + l * l,
+                      averages.begin() + s * n_harmonics + l * l + n_orders,
+                      residuals.begin() + s * n_orders);
+
+        for (unsigned int k = 0; k < dimension; ++k)
+        {
+            std::size_t pivot = 0;
+            double pivot_norm = 0;
+            for (std::size_t s = 0; s < n_seeds; ++s)
+            {
+                const double norm = std::sqrt(weighted_sum(residuals.data() + s * n_orders,
+                                                           residuals.data() + s * n_orders,
+                                                           n_orders));
+                if (norm > pivot_norm)
+                {
+                    pivot = s;
+                    pivot_norm = norm;
+                }
+            }
+
+            std::vector<double> basis_function(residuals.begin() + pivot * n_orders,
+                                               residuals.begin() + (pivot + 1) * n_orders);
+            const double largest = *std::max_element(basis_function.begin(), basis_function.end(),
+                                                     [](double a, double b)
+                                                     {
+                                                         return std::abs(a) < std::abs(b);
+                                                     });
+            for (double &coefficient : basis_function)
+                coefficient *= (largest < 0 ? -1 : 1) / pivot_norm;
+
+            for (std::size_t s = 0; s < n_seeds; ++s)
+            {
+                double *residual = residuals.data() + s * n_orders;
+                const double overlap = weighted_sum(basis_function.data(), residual, n_orders);
+                for (std::size_t i = 0; i < n_orders; ++i)
+                    residual[i] -= overlap * basis_function[i];
+            }
+
+            degrees.push_back(l);
+            expansion_offsets.push_back(expansions.size());
+            expansions.insert(expansions.end(), basis_function.begin(), basis_function.end());
+        }
+    }
+
+    const std::size_t n_cubic = degrees.size();
+    std::vector<double> values(n_harmonics);
+    harmonics.resize(generator_points.size() * n_cubic);
+    for (std::size_t j = 0; j < generator_points.size(); ++j)
+    {
+        const GeneratorPoint &generator_point = generator_points[j];
+        orbit_weights.push_back(4 * M_PI * generator_point.n_points()
+                                * generator_point.get_weight());
+
+        real_spherical_harmonics(generator_point.get_x(0), generator_point.get_y(0),
+                                 generator_point.get_z(0), l_max, values.data());
+        for (std::size_t k = 0; k < n_cubic; ++k)
+        {
+            const unsigned int l = degrees[k];
+            harmonics[j * n_cubic + k] = weighted_sum(values.data() + l * l,
+                                                      expansions.data() + expansion_offsets[k],
+                                                      2 * l + 1);
+        }
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+unsigned int CubicHarmonicTransform::get_l_max() const
+{
+    return l_max;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t CubicHarmonicTransform::n_generators() const
+{
+    return orbit_weights.size();
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t CubicHarmonicTransform::n_coefficients() const
+{
+    return degrees.size();
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+unsigned int CubicHarmonicTransform::get_degree(std::size_t k) const
+{
+    return degrees[k];
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t CubicHarmonicTransform::memory_usage() const
+{
+    return sizeof(CubicHarmonicTransform)
+           + rule.memory_usage() - sizeof(CompressedQuadraturePoints)
+           + sizeof(unsigned int) * degrees.capacity()
+           + sizeof(std::size_t) * expansion_offsets.capacity()
+           + sizeof(double) * (expansions.capacity() + orbit_weights.capacity()
+                               + harmonics.capacity());
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+const std::vector<GeneratorPoint>& CubicHarmonicTransform::get_generator_points() const
+{
+    return rule.get_generator_points();
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void CubicHarmonicTransform::analyze(const double *values,
+                                     std::size_t n_fields,
+                                     double *coefficients) const
+{
+    const std::size_t n_orbits = n_generators();
+    const std::size_t n_cubic = n_coefficients();
+    std::fill(coefficients, coefficients + n_fields * n_cubic, 0.0);
+
+    // the product of an invariant field with a cubic harmonic is the same at
+    // every point of an orbit, so each orbit's sum is one term
+    for (std::size_t j = 0; j < n_orbits; ++j)
+    {
+        const double *row = harmonics.data() + j * n_cubic;
+        for (std::size_t f = 0; f < n_fields; ++f)
+        {
+            const double weighted_value = orbit_weights[j] * values[f * n_orbits + j];
+            double *field_coefficients = coefficients + f * n_cubic;
+            for (std::size_t k = 0; k < n_cubic; ++k)
+                field_coefficients[k] += weighted_value * row[k];
+        }
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void CubicHarmonicTransform::project(const scalar_function &field, double *coefficients) const
+{
+#if LEBEDEV_CHECK_SYMMETRY
+    if (!rule.has_symmetry(field, IntegrandSymmetry::octahedral))
+        throw std::invalid_argument("Field is not octahedrally invariant");
+#endif
+
+    const std::vector<GeneratorPoint> &generator_points = rule.get_generator_points();
+    vec values(generator_points.size());
+    for (std::size_t j = 0; j < generator_points.size(); ++j)
+        values[j] = field(generator_points[j].get_x(0),
+                          generator_points[j].get_y(0),
+                          generator_points[j].get_z(0));
+
+    analyze(values.data(), 1, coefficients);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void CubicHarmonicTransform::synthesize(const double *coefficients,
+                                        std::size_t n_fields,
+                                        double *values) const
+{
+    const std::size_t n_orbits = n_generators();
+    const std::size_t n_cubic = n_coefficients();
+    for (std::size_t f = 0; f < n_fields; ++f)
+        for (std::size_t j = 0; j < n_orbits; ++j)
+            values[f * n_orbits + j] = weighted_sum(coefficients + f * n_cubic,
+                                                    harmonics.data() + j * n_cubic, n_cubic);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void CubicHarmonicTransform::to_spherical_harmonics(const double *cubic_coefficients,
+                                                    std::size_t n_fields,
+                                                    double *coefficients) const
+{
+    const std::size_t n_cubic = n_coefficients();
+    const std::size_t n_harmonics = n_spherical_harmonics(l_max);
+    std::fill(coefficients, coefficients + n_fields * n_harmonics, 0.0);
+
+    for (std::size_t f = 0; f < n_fields; ++f)
+        for (std::size_t k = 0; k < n_cubic; ++k)
+        {
+            const unsigned int l = degrees[k];
+            const double *expansion = expansions.data() + expansion_offsets[k];
+            double *degree_coefficients = coefficients + f * n_harmonics + l * l;
+            for (std::size_t i = 0; i < 2 * l + 1; ++i)
+                degree_coefficients[i] += cubic_coefficients[f * n_cubic + k] * expansion[i];
+        }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void CubicHarmonicTransform::from_spherical_harmonics(const double *coefficients,
+                                                      std::size_t n_fields,
+                                                      double *cubic_coefficients) const
+{
+    const std::size_t n_cubic = n_coefficients();
+    const std::size_t n_harmonics = n_spherical_harmonics(l_max);
+
+    for (std::size_t f = 0; f < n_fields; ++f)
+        for (std::size_t k = 0; k < n_cubic; ++k)
+        {
+            const unsigned int l = degrees[k];
+            cubic_coefficients[f * n_cubic + k]
+                = weighted_sum(coefficients + f * n_harmonics + l * l,
+                               expansions.data() + expansion_offsets[k], 2 * l + 1);
+        }
+}
+
+} // namespace lebedev
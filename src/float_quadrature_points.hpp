@@ -0,0 +1,156 @@
+#ifndef FLOAT_QUADRATURE_POINTS_HPP
+#define FLOAT_QUADRATURE_POINTS_HPP
+
+#include "quadrature_order.hpp"
+#include "quadrature_points.hpp"
+#include "weighted_sum.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lebedev {
+
+/**
+ * \brief Lebedev quadrature rule with its points and weights stored in
+ * single precision, for integrals which only need about six digits.
+ *
+ * Half the memory traffic of `QuadraturePoints`, and twice as many points
+ * per SIMD instruction, at the cost of a relative error of around `1e-7`
+ * in each point and weight.
+ * Sums are accumulated in `Accumulator` (`float` or `double`) unless
+ * another type is given for a single call, e.g.
+ * `evaluate_spherical_integral<double>(f)`; a `double` sum of `float`
+ * products adds almost nothing to their error, whereas a `float` sum adds
+ * an error growing with the number of points.
+ */
+template <typename Accumulator = double>
+class FloatQuadraturePoints
+{
+    static_assert(std::is_same<Accumulator, float>::value
+                  || std::is_same<Accumulator, double>::value,
+                  "Sums of a FloatQuadraturePoints are accumulated in float or double");
+
+public:
+    /** \brief vector of floats */
+    using vec = std::vector<float>;
+
+    /** \brief Calculates single precision copies of the points and weights
+     * of a tabulated rule */
+    explicit FloatQuadraturePoints(QuadratureOrder quad_order)
+    {
+        const std::size_t n = get_rule_descriptor(quad_order).n_points;
+        std::vector<double> arena(4 * n);
+        generate_quadrature_points(quad_order, arena.data(), arena.data() + n,
+                                   arena.data() + 2 * n, arena.data() + 3 * n);
+
+        x.assign(arena.begin(), arena.begin() + n);
+        y.assign(arena.begin() + n, arena.begin() + 2 * n);
+        z.assign(arena.begin() + 2 * n, arena.begin() + 3 * n);
+        weights.assign(arena.begin() + 3 * n, arena.end());
+    }
+
+    /** \brief Copies the points and weights of `quad_points` in single precision */
+    explicit FloatQuadraturePoints(const QuadraturePoints &quad_points)
+        : x(quad_points.get_x().begin(), quad_points.get_x().end())
+        , y(quad_points.get_y().begin(), quad_points.get_y().end())
+        , z(quad_points.get_z().begin(), quad_points.get_z().end())
+        , weights(quad_points.get_weights().begin(), quad_points.get_weights().end())
+    {}
+
+    /** \brief Returns number of quadrature points */
+    std::size_t size() const
+    {
+        return weights.size();
+    }
+
+    /** \brief Returns number of bytes held by this set of quadrature points */
+    std::size_t memory_usage() const
+    {
+        return sizeof(FloatQuadraturePoints)
+               + sizeof(float) * (x.capacity() + y.capacity()
+                                  + z.capacity() + weights.capacity());
+    }
+
+    /** \brief Calculates spherical integral given any callable, with its sum
+     * accumulated in `Sum`.
+     *
+     * `integrand_at_point` takes three floats `x`, `y`, `z` corresponding to
+     * the coordinates of the evaluation point, and returns the integrand
+     * evaluated at that point.
+     */
+    template <typename Sum = Accumulator, typename ScalarFunction>
+    auto evaluate_spherical_integral(const ScalarFunction &integrand_at_point) const
+        -> decltype(static_cast<Sum>(integrand_at_point(0.0f, 0.0f, 0.0f)))
+    {
+        Sum sum = 0;
+        for (std::size_t i = 0; i < weights.size(); ++i)
+            sum += static_cast<Sum>(integrand_at_point(x[i], y[i], z[i])) * weights[i];
+
+        return static_cast<Sum>(4 * M_PI) * sum;
+    }
+
+    /** \brief Calculates spherical integral given any callable which writes
+     * its values into `values`, with the weighted sum accumulated in `Sum`
+     * by the SIMD kernels of `weighted_sum`.
+     *
+     * `integrand_at_points` takes pointers to the coordinates `x`, `y`, `z`
+     * of the quadrature points, their number `n`, and a pointer `values` to
+     * `n` floats, into which it should write the integrand evaluated at each
+     * of the points.
+     */
+    template <typename Sum = Accumulator, typename OutputFunction>
+    auto evaluate_spherical_integral(const OutputFunction &integrand_at_points,
+                                     float *values) const
+        -> decltype(integrand_at_points(std::declval<const float*>(), std::declval<const float*>(),
+                                        std::declval<const float*>(), std::size_t(), values),
+                    Sum())
+    {
+        static_assert(std::is_same<Sum, float>::value || std::is_same<Sum, double>::value,
+                      "Weighted sums of floats are accumulated in float or double");
+
+        integrand_at_points(x.data(), y.data(), z.data(), x.size(), values);
+
+        return static_cast<Sum>(4 * M_PI) * weighted_sum<Sum>(values, weights.data(), weights.size());
+    }
+
+    /** \brief Returns const reference to vector of x-coordinates of quadrature points */
+    const vec& get_x() const
+    {
+        return x;
+    }
+
+    /** \brief Returns const reference to vector of y-coordinates of quadrature points */
+    const vec& get_y() const
+    {
+        return y;
+    }
+
+    /** \brief Returns const reference to vector of z-coordinates of quadrature points */
+    const vec& get_z() const
+    {
+        return z;
+    }
+
+    /** \brief Returns const reference to vector of weights of quadrature points */
+    const vec& get_weights() const
+    {
+        return weights;
+    }
+
+private:
+    /** \brief x-coordinates of quadrature points */
+    vec x;
+    /** \brief y-coordinates of quadrature points */
+    vec y;
+    /** \brief z-coordinates of quadrature points */
+    vec z;
+    /** \brief weights of quadrature points */
+    vec weights;
+};
+
+} // namespace lebedev
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <cassert>
+#include <cstddef>
 #include <stdexcept>
 
 namespace lebedev {
@@ -26,6 +27,100 @@ enum class OctahedralPointGeneration
 
 using OhPointGen = OctahedralPointGeneration;
 
+/** \brief Number of distinct generating rules in `OctahedralPointGeneration` */
+constexpr unsigned int n_generating_rules = 6;
+
+/** \brief Number of points in the image of a point under a generating rule */
+constexpr unsigned int orbit_size(OhPointGen generating_rule)
+{
+    return generating_rule == OhPointGen::points_6  ? 6
+         : generating_rule == OhPointGen::points_12 ? 12
+         : generating_rule == OhPointGen::points_8  ? 8
+         : generating_rule == OhPointGen::points_48 ? 48
+         : 24;
+}
+
+/**
+ * \brief Number of points of an orbit which have the same coordinates up to
+ * sign, i.e. the images of each point under reflections \f$ x \to -x \f$,
+ * \f$ y \to -y \f$ and \f$ z \to -z \f$.
+ */
+constexpr unsigned int reflection_class_size(OhPointGen generating_rule)
+{
+    return generating_rule == OhPointGen::points_6       ? 2
+         : generating_rule == OhPointGen::points_12      ? 4
+         : generating_rule == OhPointGen::points_24_axis ? 4
+         : 8;
+}
+
+/**
+ * \brief Symmetries which an integrand can be declared to have, so that
+ * integrals need only evaluate it at some of the points of each orbit.
+ */
+enum class IntegrandSymmetry
+{
+    /** \brief no symmetry, the integrand is evaluated at every point */
+    none,
+    /** \brief even in each coordinate, so one point per set of reflections
+     * (see `reflection_class_size`) is evaluated */
+    reflections,
+    /** \brief invariant under the octahedral group, so one point per orbit
+     * is evaluated */
+    octahedral
+};
+
+/**
+ * \brief Image of a generating point (`a`, `b`, `c`) under each generating
+ * rule, indexed as `orbit_patterns[rule][coordinate][point]`.
+ *
+ * Entries `1`, `2`, `3` select `a`, `b`, `c` respectively, a negative entry
+ * selects the negated component, and `0` is a zero coordinate.
+ * These patterns are the only place where the images are spelled out, so
+ * every way of generating quadrature points lists them in this order.
+ */
+constexpr signed char orbit_patterns[n_generating_rules][3][48]
+    = {
+        // points_6
+        {{ 1, -1,  0,  0,  0,  0},
+         { 0,  0,  1, -1,  0,  0},
+         { 0,  0,  0,  0,  1, -1}},
+        // points_12
+        {{ 0,  0,  0,  0,  1, -1,  1, -1,  1, -1,  1, -1},
+         { 1, -1,  1, -1,  0,  0,  0,  0,  1,  1, -1, -1},
+         { 1,  1, -1, -1,  1,  1, -1, -1,  0,  0,  0,  0}},
+        // points_8
+        {{ 1, -1,  1, -1,  1, -1,  1, -1},
+         { 1,  1, -1, -1,  1,  1, -1, -1},
+         { 1,  1,  1,  1, -1, -1, -1, -1}},
+        // points_24
+        {{ 1, -1,  1, -1,  1, -1,  1, -1,  1, -1,  1, -1,
+           1, -1,  1, -1,  2, -2,  2, -2,  2, -2,  2, -2},
+         { 1,  1, -1, -1,  1,  1, -1, -1,  2,  2, -2, -2,
+           2,  2, -2, -2,  1,  1, -1, -1,  1,  1, -1, -1},
+         { 2,  2,  2,  2, -2, -2, -2, -2,  1,  1,  1,  1,
+          -1, -1, -1, -1,  1,  1,  1,  1, -1, -1, -1, -1}},
+        // points_24_axis
+        {{ 1, -1,  1, -1,  2, -2,  2, -2,  1, -1,  1, -1,
+           2, -2,  2, -2,  0,  0,  0,  0,  0,  0,  0,  0},
+         { 2,  2, -2, -2,  1,  1, -1, -1,  0,  0,  0,  0,
+           0,  0,  0,  0,  1, -1,  1, -1,  2, -2,  2, -2},
+         { 0,  0,  0,  0,  0,  0,  0,  0,  2,  2, -2, -2,
+           1,  1, -1, -1,  2,  2, -2, -2,  1,  1, -1, -1}},
+        // points_48
+        {{ 1, -1,  1, -1,  1, -1,  1, -1,  1, -1,  1, -1,
+           1, -1,  1, -1,  2, -2,  2, -2,  2, -2,  2, -2,
+           2, -2,  2, -2,  2, -2,  2, -2,  3, -3,  3, -3,
+           3, -3,  3, -3,  3, -3,  3, -3,  3, -3,  3, -3},
+         { 2,  2, -2, -2,  2,  2, -2, -2,  3,  3, -3, -3,
+           3,  3, -3, -3,  1,  1, -1, -1,  1,  1, -1, -1,
+           3,  3, -3, -3,  3,  3, -3, -3,  1,  1, -1, -1,
+           1,  1, -1, -1,  2,  2, -2, -2,  2,  2, -2, -2},
+         { 3,  3,  3,  3, -3, -3, -3, -3,  2,  2,  2,  2,
+          -2, -2, -2, -2,  3,  3,  3,  3, -3, -3, -3, -3,
+           1,  1,  1,  1, -1, -1, -1, -1,  2,  2,  2,  2,
+          -2, -2, -2, -2,  1,  1,  1,  1, -1, -1, -1, -1}}
+      };
+
 /**
  * \brief Point and weight which is acted on by Octahedral symmetry group to 
  * generate sets of points in a particular Lebedev quadrature rule.
@@ -45,11 +140,11 @@ public:
      * on this point, create a `GeneratorPoint` object which can be used to
      * generate a subset of Lebedev quadrature points.
      */
-    GeneratorPoint (double a, 
-                    double b, 
-                    double c, 
-                    double weight, 
-                    OhPointGen generating_rule)
+    constexpr GeneratorPoint (double a, 
+                              double b, 
+                              double c, 
+                              double weight, 
+                              OhPointGen generating_rule)
         : a(a), b(b), c(c), weight(weight), generating_rule(generating_rule)
     {}
 
@@ -60,7 +155,80 @@ public:
      */
     void generate_quadrature_points(vec &x, vec &y, vec &z, vec &w) const;
 
+    /**
+     * \brief Generates quadrature points via action of the Octahedral symmetry
+     * group and writes points and weight to `x`, `y`, `z`, and `w`, each of 
+     * which must have room for `n_points()` entries.
+     */
+    void generate_quadrature_points(double *x, double *y, double *z, double *w) const;
+
+    /** \brief Number of quadrature points generated by this point */
+    constexpr unsigned int n_points() const
+    {
+        return orbit_size(generating_rule);
+    }
+
+    /** \brief x-coordinate of the `i`th point generated by this point */
+    constexpr double get_x(unsigned int i) const
+    {
+        return select_coordinate(orbit_patterns[static_cast<unsigned int>(generating_rule)][0][i]);
+    }
+
+    /** \brief y-coordinate of the `i`th point generated by this point */
+    constexpr double get_y(unsigned int i) const
+    {
+        return select_coordinate(orbit_patterns[static_cast<unsigned int>(generating_rule)][1][i]);
+    }
+
+    /** \brief z-coordinate of the `i`th point generated by this point */
+    constexpr double get_z(unsigned int i) const
+    {
+        return select_coordinate(orbit_patterns[static_cast<unsigned int>(generating_rule)][2][i]);
+    }
+
+    /** \brief x-component of generating point */
+    constexpr double get_a() const
+    {
+        return a;
+    }
+
+    /** \brief y-component of generating point */
+    constexpr double get_b() const
+    {
+        return b;
+    }
+
+    /** \brief z-component of generating point */
+    constexpr double get_c() const
+    {
+        return c;
+    }
+
+    /** \brief Quadrature weight shared by all points generated by this point */
+    constexpr double get_weight() const
+    {
+        return weight;
+    }
+
+    /** \brief Rule which describes action of the octahedral group on this point */
+    constexpr OhPointGen get_generating_rule() const
+    {
+        return generating_rule;
+    }
+
 private:
+    /** \brief Maps an entry of `orbit_patterns` to the matching coordinate */
+    constexpr double select_coordinate(signed char selector) const
+    {
+        return selector == 1  ?  a
+             : selector == -1 ? -a
+             : selector == 2  ?  b
+             : selector == -2 ? -b
+             : selector == 3  ?  c
+             : selector == -3 ? -c
+             : 0.0;
+    }
+
     /* \brief x-component of generating point */
     double a = 1.0;
     /* \brief y-component of generating point */
@@ -0,0 +1,70 @@
+#ifndef GENERATOR_TABLE_HPP
+#define GENERATOR_TABLE_HPP
+
+#include "quadrature_order.hpp"
+#include "generator_point.hpp"
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+
+namespace lebedev {
+
+/**
+ * \brief Tabulated generator points of each available Lebedev rule.
+ *
+ * Each specialization has a constexpr `generator_points()` returning the
+ * generator points of that order, so the tables may be used (and expanded)
+ * at compile time.
+ * Only available orders are specialized, each in its own header in
+ * `generator_tables/` -- include `generator_tables.hpp` to get all of them.
+ */
+template <QuadratureOrder quad_order>
+struct GeneratorTable
+{
+    static_assert(quad_order != quad_order, "Lebedev order not available");
+};
+
+
+
+/**
+ * \brief Generator points of an available order, held in static storage so
+ * that they may be referred to by pointer (see `get_generator_points`).
+ */
+template <QuadratureOrder quad_order>
+struct GeneratorPointStorage
+{
+    /** \brief Number of generator points */
+    static constexpr std::size_t n_generators
+        = std::tuple_size<decltype(GeneratorTable<quad_order>::generator_points())>::value;
+
+    /** \brief Generator points of the rule */
+    static constexpr std::array<GeneratorPoint, n_generators> generator_points
+        = GeneratorTable<quad_order>::generator_points();
+};
+
+template <QuadratureOrder quad_order>
+constexpr std::size_t GeneratorPointStorage<quad_order>::n_generators;
+
+template <QuadratureOrder quad_order>
+constexpr std::array<GeneratorPoint, GeneratorPointStorage<quad_order>::n_generators>
+GeneratorPointStorage<quad_order>::generator_points;
+
+
+
+/**
+ * \brief Returns the generator points of an available order.
+ *
+ * Unlike `GeneratorPointStorage`, this only needs the tabulated data where
+ * it is instantiated, so that the tables of each order can be compiled in
+ * their own translation unit (see `LEBEDEV_SPLIT_TABLES`).
+ */
+template <QuadratureOrder quad_order>
+const GeneratorPoint* get_generator_points()
+{
+    return &GeneratorPointStorage<quad_order>::generator_points[0];
+}
+
+} // namespace lebedev
+
+#endif
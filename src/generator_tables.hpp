@@ -0,0 +1,44 @@
+#ifndef GENERATOR_TABLES_HPP
+#define GENERATOR_TABLES_HPP
+
+/*
+ * Tabulated generator points of every available Lebedev rule.
+ * See `generator_table.hpp` for how they are accessed.
+ */
+
+#include "generator_table.hpp"
+
+#include "generator_tables/order_6.hpp"
+#include "generator_tables/order_14.hpp"
+#include "generator_tables/order_26.hpp"
+#include "generator_tables/order_38.hpp"
+#include "generator_tables/order_50.hpp"
+#include "generator_tables/order_74.hpp"
+#include "generator_tables/order_86.hpp"
+#include "generator_tables/order_110.hpp"
+#include "generator_tables/order_146.hpp"
+#include "generator_tables/order_170.hpp"
+#include "generator_tables/order_194.hpp"
+#include "generator_tables/order_230.hpp"
+#include "generator_tables/order_266.hpp"
+#include "generator_tables/order_302.hpp"
+#include "generator_tables/order_350.hpp"
+#include "generator_tables/order_434.hpp"
+#include "generator_tables/order_590.hpp"
+#include "generator_tables/order_770.hpp"
+#include "generator_tables/order_974.hpp"
+#include "generator_tables/order_1202.hpp"
+#include "generator_tables/order_1454.hpp"
+#include "generator_tables/order_1730.hpp"
+#include "generator_tables/order_2030.hpp"
+#include "generator_tables/order_2354.hpp"
+#include "generator_tables/order_2702.hpp"
+#include "generator_tables/order_3074.hpp"
+#include "generator_tables/order_3470.hpp"
+#include "generator_tables/order_3890.hpp"
+#include "generator_tables/order_4334.hpp"
+#include "generator_tables/order_4802.hpp"
+#include "generator_tables/order_5294.hpp"
+#include "generator_tables/order_5810.hpp"
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef GENERATOR_TABLE_ORDER_110_HPP
+#define GENERATOR_TABLE_ORDER_110_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_110>
+{
+    static constexpr std::array<GeneratorPoint, 6> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.003828270494937162, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.009793737512487513, OhPointGen::points_8},
+            {0.1851156353447362, constexpr_sqrt(1.0 - 2.0 * 0.1851156353447362 * 0.1851156353447362), 0.0, 0.008211737283191111, OhPointGen::points_24},
+            {0.6904210483822922, constexpr_sqrt(1.0 - 2.0 * 0.6904210483822922 * 0.6904210483822922), 0.0, 0.009942814891178105, OhPointGen::points_24},
+            {0.3956894730559419, constexpr_sqrt(1.0 - 2.0 * 0.3956894730559419 * 0.3956894730559419), 0.0, 0.009595471336070964, OhPointGen::points_24},
+            {0.4783690288121502, constexpr_sqrt(1.0 - 0.4783690288121502 * 0.4783690288121502), 0.0, 0.009694996361663029, OhPointGen::points_24_axis}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef GENERATOR_TABLE_ORDER_1202_HPP
+#define GENERATOR_TABLE_ORDER_1202_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_1202>
+{
+    static constexpr std::array<GeneratorPoint, 36> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.0001105189233267572, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.000920523273809074, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.000913315978644356, OhPointGen::points_8},
+            {0.03712636449657089, constexpr_sqrt(1.0 - 2.0 * 0.03712636449657089 * 0.03712636449657089), 0.0, 0.0003690421898017899, OhPointGen::points_24},
+            {0.09140060412262224, constexpr_sqrt(1.0 - 2.0 * 0.09140060412262224 * 0.09140060412262224), 0.0, 0.000560399092868066, OhPointGen::points_24},
+            {0.1531077852469906, constexpr_sqrt(1.0 - 2.0 * 0.1531077852469906 * 0.1531077852469906), 0.0, 0.0006865297629282609, OhPointGen::points_24},
+            {0.2180928891660612, constexpr_sqrt(1.0 - 2.0 * 0.2180928891660612 * 0.2180928891660612), 0.0, 0.000772033855114563, OhPointGen::points_24},
+            {0.2839874532200175, constexpr_sqrt(1.0 - 2.0 * 0.2839874532200175 * 0.2839874532200175), 0.0, 0.0008301545958894795, OhPointGen::points_24},
+            {0.3491177600963764, constexpr_sqrt(1.0 - 2.0 * 0.3491177600963764 * 0.3491177600963764), 0.0, 0.0008686692550179628, OhPointGen::points_24},
+            {0.4121431461444309, constexpr_sqrt(1.0 - 2.0 * 0.4121431461444309 * 0.4121431461444309), 0.0, 0.000892707628584689, OhPointGen::points_24},
+            {0.4718993627149127, constexpr_sqrt(1.0 - 2.0 * 0.4718993627149127 * 0.4718993627149127), 0.0, 0.000906082023856822, OhPointGen::points_24},
+            {0.5273145452842337, constexpr_sqrt(1.0 - 2.0 * 0.5273145452842337 * 0.5273145452842337), 0.0, 0.0009119777254940868, OhPointGen::points_24},
+            {0.6209475332444019, constexpr_sqrt(1.0 - 2.0 * 0.6209475332444019 * 0.6209475332444019), 0.0, 0.000912872013860418, OhPointGen::points_24},
+            {0.6569722711857291, constexpr_sqrt(1.0 - 2.0 * 0.6569722711857291 * 0.6569722711857291), 0.0, 0.0009130714935691736, OhPointGen::points_24},
+            {0.6841788309070143, constexpr_sqrt(1.0 - 2.0 * 0.6841788309070143 * 0.6841788309070143), 0.0, 0.0009152873784554116, OhPointGen::points_24},
+            {0.7012604330123631, constexpr_sqrt(1.0 - 2.0 * 0.7012604330123631 * 0.7012604330123631), 0.0, 0.0009187436274321654, OhPointGen::points_24},
+            {0.1072382215478166, constexpr_sqrt(1.0 - 0.1072382215478166 * 0.1072382215478166), 0.0, 0.0005176977312965694, OhPointGen::points_24_axis},
+            {0.2582068959496968, constexpr_sqrt(1.0 - 0.2582068959496968 * 0.2582068959496968), 0.0, 0.0007331143682101417, OhPointGen::points_24_axis},
+            {0.4172752955306717, constexpr_sqrt(1.0 - 0.4172752955306717 * 0.4172752955306717), 0.0, 0.0008463232836379928, OhPointGen::points_24_axis},
+            {0.5700366911792503, constexpr_sqrt(1.0 - 0.5700366911792503 * 0.5700366911792503), 0.0, 0.0009031122694253992, OhPointGen::points_24_axis},
+            {0.9827986018263948, 0.1771774022615325, constexpr_sqrt(1.0 - 0.9827986018263948 * 0.9827986018263948 - 0.1771774022615325 * 0.1771774022615325), 0.0006485778453163257, OhPointGen::points_48},
+            {0.9624249230326228, 0.2475716463426288, constexpr_sqrt(1.0 - 0.9624249230326228 * 0.9624249230326228 - 0.2475716463426288 * 0.2475716463426288), 0.0007435030910982369, OhPointGen::points_48},
+            {0.9402007994128811, 0.3354616289066489, constexpr_sqrt(1.0 - 0.9402007994128811 * 0.9402007994128811 - 0.3354616289066489 * 0.3354616289066489), 0.0007998527891839054, OhPointGen::points_48},
+            {0.9320822040143202, 0.3173615246611977, constexpr_sqrt(1.0 - 0.9320822040143202 * 0.9320822040143202 - 0.3173615246611977 * 0.3173615246611977), 0.0008101731497468018, OhPointGen::points_48},
+            {0.90436741993933, 0.4090268427085357, constexpr_sqrt(1.0 - 0.90436741993933 * 0.90436741993933 - 0.4090268427085357 * 0.4090268427085357), 0.000848338957459433, OhPointGen::points_48},
+            {0.8912407560074747, 0.3854291150669224, constexpr_sqrt(1.0 - 0.8912407560074747 * 0.8912407560074747 - 0.3854291150669224 * 0.3854291150669224), 0.0008556299257311812, OhPointGen::points_48},
+            {0.8676435628462708, 0.4932221184851285, constexpr_sqrt(1.0 - 0.8676435628462708 * 0.8676435628462708 - 0.4932221184851285 * 0.4932221184851285), 0.000880320867973826, OhPointGen::points_48},
+            {0.8581979986041619, 0.4785320675922435, constexpr_sqrt(1.0 - 0.8581979986041619 * 0.8581979986041619 - 0.4785320675922435 * 0.4785320675922435), 0.000881104818242572, OhPointGen::points_48},
+            {0.8396753624049856, 0.4507422593157064, constexpr_sqrt(1.0 - 0.8396753624049856 * 0.8396753624049856 - 0.4507422593157064 * 0.4507422593157064), 0.0008850282341265444, OhPointGen::points_48},
+            {0.8165288564022188, 0.56321230207621, constexpr_sqrt(1.0 - 0.8165288564022188 * 0.8165288564022188 - 0.56321230207621 * 0.56321230207621), 0.0009021342299040652, OhPointGen::points_48},
+            {0.8015469370783529, 0.54343035696939, constexpr_sqrt(1.0 - 0.8015469370783529 * 0.8015469370783529 - 0.54343035696939 * 0.54343035696939), 0.0009010091677105086, OhPointGen::points_48},
+            {0.777356306907035, 0.5123518486419871, constexpr_sqrt(1.0 - 0.777356306907035 * 0.777356306907035 - 0.5123518486419871 * 0.5123518486419871), 0.0009022692938426916, OhPointGen::points_48},
+            {0.7661621213900394, 0.6394279634749102, constexpr_sqrt(1.0 - 0.7661621213900394 * 0.7661621213900394 - 0.6394279634749102 * 0.6394279634749102), 0.0009158016174693464, OhPointGen::points_48},
+            {0.755358414353351, 0.6269805509024392, constexpr_sqrt(1.0 - 0.755358414353351 * 0.755358414353351 - 0.6269805509024392 * 0.6269805509024392), 0.0009131578003189435, OhPointGen::points_48},
+            {0.7344305757559503, 0.603116169309631, constexpr_sqrt(1.0 - 0.7344305757559503 * 0.7344305757559503 - 0.603116169309631 * 0.603116169309631), 0.0009107813579482704, OhPointGen::points_48},
+            {0.7043837184021765, 0.5693702498468441, constexpr_sqrt(1.0 - 0.7043837184021765 * 0.7043837184021765 - 0.5693702498468441 * 0.5693702498468441), 0.0009105760258970126, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
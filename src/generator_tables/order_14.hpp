@@ -0,0 +1,27 @@
+#ifndef GENERATOR_TABLE_ORDER_14_HPP
+#define GENERATOR_TABLE_ORDER_14_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_14>
+{
+    static constexpr std::array<GeneratorPoint, 2> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.06666666666666667, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.075, OhPointGen::points_8}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef GENERATOR_TABLE_ORDER_1454_HPP
+#define GENERATOR_TABLE_ORDER_1454_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_1454>
+{
+    static constexpr std::array<GeneratorPoint, 42> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 7.777160743261247e-05, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.0007557646413004701, OhPointGen::points_8},
+            {0.03229290663413854, constexpr_sqrt(1.0 - 2.0 * 0.03229290663413854 * 0.03229290663413854), 0.0, 0.0002841633806090617, OhPointGen::points_24},
+            {0.08036733271462222, constexpr_sqrt(1.0 - 2.0 * 0.08036733271462222 * 0.08036733271462222), 0.0, 0.0004374419127053555, OhPointGen::points_24},
+            {0.1354289960531653, constexpr_sqrt(1.0 - 2.0 * 0.1354289960531653 * 0.1354289960531653), 0.0, 0.0005417174740872172, OhPointGen::points_24},
+            {0.1938963861114426, constexpr_sqrt(1.0 - 2.0 * 0.1938963861114426 * 0.1938963861114426), 0.0, 0.0006148000891358593, OhPointGen::points_24},
+            {0.2537343715011275, constexpr_sqrt(1.0 - 2.0 * 0.2537343715011275 * 0.2537343715011275), 0.0, 0.0006664394485800704, OhPointGen::points_24},
+            {0.313525143475257, constexpr_sqrt(1.0 - 2.0 * 0.313525143475257 * 0.313525143475257), 0.0, 0.000702503935692322, OhPointGen::points_24},
+            {0.3721558339375338, constexpr_sqrt(1.0 - 2.0 * 0.3721558339375338 * 0.3721558339375338), 0.0, 0.0007268511789249627, OhPointGen::points_24},
+            {0.4286809575195696, constexpr_sqrt(1.0 - 2.0 * 0.4286809575195696 * 0.4286809575195696), 0.0, 0.0007422637534208629, OhPointGen::points_24},
+            {0.4822510128282994, constexpr_sqrt(1.0 - 2.0 * 0.4822510128282994 * 0.4822510128282994), 0.0, 0.0007509545035841214, OhPointGen::points_24},
+            {0.5320679333566263, constexpr_sqrt(1.0 - 2.0 * 0.5320679333566263 * 0.5320679333566263), 0.0, 0.0007548535057718401, OhPointGen::points_24},
+            {0.6172998195394274, constexpr_sqrt(1.0 - 2.0 * 0.6172998195394274 * 0.6172998195394274), 0.0, 0.0007554088969774001, OhPointGen::points_24},
+            {0.6510679849127481, constexpr_sqrt(1.0 - 2.0 * 0.6510679849127481 * 0.6510679849127481), 0.0, 0.0007553147174442808, OhPointGen::points_24},
+            {0.677731525168736, constexpr_sqrt(1.0 - 2.0 * 0.677731525168736 * 0.677731525168736), 0.0, 0.0007564767653292297, OhPointGen::points_24},
+            {0.6963109410648741, constexpr_sqrt(1.0 - 2.0 * 0.6963109410648741 * 0.6963109410648741), 0.0, 0.000758799180851873, OhPointGen::points_24},
+            {0.7058935009831749, constexpr_sqrt(1.0 - 2.0 * 0.7058935009831749 * 0.7058935009831749), 0.0, 0.0007608261832033027, OhPointGen::points_24},
+            {0.9955546194091855, constexpr_sqrt(1.0 - 0.9955546194091855 * 0.9955546194091855), 0.0, 0.0004021680447874916, OhPointGen::points_24_axis},
+            {0.9734115901794208, constexpr_sqrt(1.0 - 0.9734115901794208 * 0.9734115901794208), 0.0, 0.0005804871793945964, OhPointGen::points_24_axis},
+            {0.9275693732388626, constexpr_sqrt(1.0 - 0.9275693732388626 * 0.9275693732388626), 0.0, 0.0006792151955945159, OhPointGen::points_24_axis},
+            {0.8568022422795103, constexpr_sqrt(1.0 - 0.8568022422795103 * 0.8568022422795103), 0.0, 0.0007336741211286294, OhPointGen::points_24_axis},
+            {0.7623495553719372, constexpr_sqrt(1.0 - 0.7623495553719372 * 0.7623495553719372), 0.0, 0.0007581866300989608, OhPointGen::points_24_axis},
+            {0.5707522908892223, 0.4387028039889501, constexpr_sqrt(1.0 - 0.5707522908892223 * 0.5707522908892223 - 0.4387028039889501 * 0.4387028039889501), 0.0007538257859800743, OhPointGen::points_48},
+            {0.5196463388403083, 0.3858908414762617, constexpr_sqrt(1.0 - 0.5196463388403083 * 0.5196463388403083 - 0.3858908414762617 * 0.3858908414762617), 0.0007483517247053123, OhPointGen::points_48},
+            {0.4646337531215351, 0.3301937372343854, constexpr_sqrt(1.0 - 0.4646337531215351 * 0.4646337531215351 - 0.3301937372343854 * 0.3301937372343854), 0.0007371763661112059, OhPointGen::points_48},
+            {0.4063901697557691, 0.2725423573563777, constexpr_sqrt(1.0 - 0.4063901697557691 * 0.4063901697557691 - 0.2725423573563777 * 0.2725423573563777), 0.0007183448895756934, OhPointGen::points_48},
+            {0.3456329466643087, 0.213951023749525, constexpr_sqrt(1.0 - 0.3456329466643087 * 0.3456329466643087 - 0.213951023749525 * 0.213951023749525), 0.0006895815529822191, OhPointGen::points_48},
+            {0.2831395121050332, 0.1555922309786647, constexpr_sqrt(1.0 - 0.2831395121050332 * 0.2831395121050332 - 0.1555922309786647 * 0.1555922309786647), 0.0006480105801792886, OhPointGen::points_48},
+            {0.219768202292533, 0.09892878979686096, constexpr_sqrt(1.0 - 0.219768202292533 * 0.219768202292533 - 0.09892878979686096 * 0.09892878979686096), 0.0005897558896594636, OhPointGen::points_48},
+            {0.1564696098650355, 0.0459864291067551, constexpr_sqrt(1.0 - 0.1564696098650355 * 0.1564696098650355 - 0.0459864291067551 * 0.0459864291067551), 0.0005095708849247346, OhPointGen::points_48},
+            {0.6027356673721295, 0.3376625140173426, constexpr_sqrt(1.0 - 0.6027356673721295 * 0.6027356673721295 - 0.3376625140173426 * 0.3376625140173426), 0.0007536906428909755, OhPointGen::points_48},
+            {0.5496032320255096, 0.2822301309727988, constexpr_sqrt(1.0 - 0.5496032320255096 * 0.5496032320255096 - 0.2822301309727988 * 0.2822301309727988), 0.0007472505965575118, OhPointGen::points_48},
+            {0.4921707755234567, 0.224863234259254, constexpr_sqrt(1.0 - 0.4921707755234567 * 0.4921707755234567 - 0.224863234259254 * 0.224863234259254), 0.0007343017132279698, OhPointGen::points_48},
+            {0.4309422998598483, 0.1666224723456479, constexpr_sqrt(1.0 - 0.4309422998598483 * 0.4309422998598483 - 0.1666224723456479 * 0.1666224723456479), 0.0007130871582177445, OhPointGen::points_48},
+            {0.3664108182313672, 0.1086964901822169, constexpr_sqrt(1.0 - 0.3664108182313672 * 0.3664108182313672 - 0.1086964901822169 * 0.1086964901822169), 0.0006817022032112776, OhPointGen::points_48},
+            {0.2990189057758436, 0.05251989784120085, constexpr_sqrt(1.0 - 0.2990189057758436 * 0.2990189057758436 - 0.05251989784120085 * 0.05251989784120085), 0.0006380941145604121, OhPointGen::points_48},
+            {0.6268724013144998, 0.2297523657550023, constexpr_sqrt(1.0 - 0.6268724013144998 * 0.6268724013144998 - 0.2297523657550023 * 0.2297523657550023), 0.000755038137792031, OhPointGen::points_48},
+            {0.5707324144834607, 0.17230806070938, constexpr_sqrt(1.0 - 0.5707324144834607 * 0.5707324144834607 - 0.17230806070938 * 0.17230806070938), 0.0007478646640144802, OhPointGen::points_48},
+            {0.5096360901960365, 0.1140238465390513, constexpr_sqrt(1.0 - 0.5096360901960365 * 0.5096360901960365 - 0.1140238465390513 * 0.1140238465390513), 0.000733591872060122, OhPointGen::points_48},
+            {0.4438729938312456, 0.05611522095882537, constexpr_sqrt(1.0 - 0.4438729938312456 * 0.4438729938312456 - 0.05611522095882537 * 0.05611522095882537), 0.0007110120527658118, OhPointGen::points_48},
+            {0.6419978471082389, 0.1164174423140873, constexpr_sqrt(1.0 - 0.6419978471082389 * 0.6419978471082389 - 0.1164174423140873 * 0.1164174423140873), 0.0007571363978689501, OhPointGen::points_48},
+            {0.5817218061802611, 0.05797589531445219, constexpr_sqrt(1.0 - 0.5817218061802611 * 0.5817218061802611 - 0.05797589531445219 * 0.05797589531445219), 0.0007489908329079233, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
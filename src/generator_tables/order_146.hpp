@@ -0,0 +1,32 @@
+#ifndef GENERATOR_TABLE_ORDER_146_HPP
+#define GENERATOR_TABLE_ORDER_146_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_146>
+{
+    static constexpr std::array<GeneratorPoint, 7> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.0005996313688621381, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.007372999718620756, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.007210515360144488, OhPointGen::points_8},
+            {0.6764410400114264, constexpr_sqrt(1.0 - 2.0 * 0.6764410400114264 * 0.6764410400114264), 0.0, 0.007116355493117555, OhPointGen::points_24},
+            {0.4174961227965453, constexpr_sqrt(1.0 - 2.0 * 0.4174961227965453 * 0.4174961227965453), 0.0, 0.006753829486314477, OhPointGen::points_24},
+            {0.1574676672039082, constexpr_sqrt(1.0 - 2.0 * 0.1574676672039082 * 0.1574676672039082), 0.0, 0.007574394159054034, OhPointGen::points_24},
+            {0.1403553811713183, 0.4493328323269557, constexpr_sqrt(1.0 - 0.1403553811713183 * 0.1403553811713183 - 0.4493328323269557 * 0.4493328323269557), 0.006991087353303262, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
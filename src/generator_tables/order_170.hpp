@@ -0,0 +1,33 @@
+#ifndef GENERATOR_TABLE_ORDER_170_HPP
+#define GENERATOR_TABLE_ORDER_170_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_170>
+{
+    static constexpr std::array<GeneratorPoint, 8> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.005544842902037365, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.006071332770670752, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.006383674773515093, OhPointGen::points_8},
+            {0.2551252621114134, constexpr_sqrt(1.0 - 2.0 * 0.2551252621114134 * 0.2551252621114134), 0.0, 0.00518338758774779, OhPointGen::points_24},
+            {0.6743601460362766, constexpr_sqrt(1.0 - 2.0 * 0.6743601460362766 * 0.6743601460362766), 0.0, 0.006317929009813725, OhPointGen::points_24},
+            {0.431891069671941, constexpr_sqrt(1.0 - 2.0 * 0.431891069671941 * 0.431891069671941), 0.0, 0.006201670006589077, OhPointGen::points_24},
+            {0.2613931360335988, constexpr_sqrt(1.0 - 0.2613931360335988 * 0.2613931360335988), 0.0, 0.005477143385137348, OhPointGen::points_24_axis},
+            {0.4990453161796037, 0.1446630744325115, constexpr_sqrt(1.0 - 0.4990453161796037 * 0.4990453161796037 - 0.1446630744325115 * 0.1446630744325115), 0.005968383987681156, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef GENERATOR_TABLE_ORDER_1730_HPP
+#define GENERATOR_TABLE_ORDER_1730_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_1730>
+{
+    static constexpr std::array<GeneratorPoint, 49> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 6.309049437420976e-05, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.0006398287705571748, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.000635718507353072, OhPointGen::points_8},
+            {0.02860923126194662, constexpr_sqrt(1.0 - 2.0 * 0.02860923126194662 * 0.02860923126194662), 0.0, 0.0002221207162188168, OhPointGen::points_24},
+            {0.07142556767711522, constexpr_sqrt(1.0 - 2.0 * 0.07142556767711522 * 0.07142556767711522), 0.0, 0.0003475784022286848, OhPointGen::points_24},
+            {0.1209199540995559, constexpr_sqrt(1.0 - 2.0 * 0.1209199540995559 * 0.1209199540995559), 0.0, 0.0004350742443589804, OhPointGen::points_24},
+            {0.1738673106594379, constexpr_sqrt(1.0 - 2.0 * 0.1738673106594379 * 0.1738673106594379), 0.0, 0.0004978569136522127, OhPointGen::points_24},
+            {0.2284645438467734, constexpr_sqrt(1.0 - 2.0 * 0.2284645438467734 * 0.2284645438467734), 0.0, 0.0005435036221998053, OhPointGen::points_24},
+            {0.2834807671701512, constexpr_sqrt(1.0 - 2.0 * 0.2834807671701512 * 0.2834807671701512), 0.0, 0.0005765913388219542, OhPointGen::points_24},
+            {0.3379680145467339, constexpr_sqrt(1.0 - 2.0 * 0.3379680145467339 * 0.3379680145467339), 0.0, 0.0006001200359226003, OhPointGen::points_24},
+            {0.3911355454819537, constexpr_sqrt(1.0 - 2.0 * 0.3911355454819537 * 0.3911355454819537), 0.0, 0.0006162178172717512, OhPointGen::points_24},
+            {0.4422860353001403, constexpr_sqrt(1.0 - 2.0 * 0.4422860353001403 * 0.4422860353001403), 0.0, 0.0006265218152438484, OhPointGen::points_24},
+            {0.4907781568726057, constexpr_sqrt(1.0 - 2.0 * 0.4907781568726057 * 0.4907781568726057), 0.0, 0.0006323987160974212, OhPointGen::points_24},
+            {0.5360006153211468, constexpr_sqrt(1.0 - 2.0 * 0.5360006153211468 * 0.5360006153211468), 0.0, 0.0006350767851540569, OhPointGen::points_24},
+            {0.6142105973596603, constexpr_sqrt(1.0 - 2.0 * 0.6142105973596603 * 0.6142105973596603), 0.0, 0.0006354362775297107, OhPointGen::points_24},
+            {0.6459300387977503, constexpr_sqrt(1.0 - 2.0 * 0.6459300387977503 * 0.6459300387977503), 0.0, 0.0006352302462706236, OhPointGen::points_24},
+            {0.6718056125089225, constexpr_sqrt(1.0 - 2.0 * 0.6718056125089225 * 0.6718056125089225), 0.0, 0.0006358117881417972, OhPointGen::points_24},
+            {0.6910888533186254, constexpr_sqrt(1.0 - 2.0 * 0.6910888533186254 * 0.6910888533186254), 0.0, 0.0006373101590310116, OhPointGen::points_24},
+            {0.7030467416823252, constexpr_sqrt(1.0 - 2.0 * 0.7030467416823252 * 0.7030467416823252), 0.0, 0.0006390428961368665, OhPointGen::points_24},
+            {0.08354951166354646, constexpr_sqrt(1.0 - 0.08354951166354646 * 0.08354951166354646), 0.0, 0.0003186913449946576, OhPointGen::points_24_axis},
+            {0.2050143009099486, constexpr_sqrt(1.0 - 0.2050143009099486 * 0.2050143009099486), 0.0, 0.0004678028558591711, OhPointGen::points_24_axis},
+            {0.3370208290706637, constexpr_sqrt(1.0 - 0.3370208290706637 * 0.3370208290706637), 0.0, 0.0005538829697598626, OhPointGen::points_24_axis},
+            {0.4689051484233963, constexpr_sqrt(1.0 - 0.4689051484233963 * 0.4689051484233963), 0.0, 0.0006044475907190476, OhPointGen::points_24_axis},
+            {0.5939400424557334, constexpr_sqrt(1.0 - 0.5939400424557334 * 0.5939400424557334), 0.0, 0.0006313575103509012, OhPointGen::points_24_axis},
+            {0.1394983311832261, 0.04097581162050343, constexpr_sqrt(1.0 - 0.1394983311832261 * 0.1394983311832261 - 0.04097581162050343 * 0.04097581162050343), 0.000407862643185563, OhPointGen::points_48},
+            {0.1967999180485014, 0.08851987391293348, constexpr_sqrt(1.0 - 0.1967999180485014 * 0.1967999180485014 - 0.08851987391293348 * 0.08851987391293348), 0.0004759933057812725, OhPointGen::points_48},
+            {0.2546183732548967, 0.1397680182969819, constexpr_sqrt(1.0 - 0.2546183732548967 * 0.2546183732548967 - 0.1397680182969819 * 0.1397680182969819), 0.000526815118641344, OhPointGen::points_48},
+            {0.3121281074713875, 0.1929452542226526, constexpr_sqrt(1.0 - 0.3121281074713875 * 0.3121281074713875 - 0.1929452542226526 * 0.1929452542226526), 0.0005643048560507316, OhPointGen::points_48},
+            {0.3685981078502492, 0.2467898337061562, constexpr_sqrt(1.0 - 0.3685981078502492 * 0.3685981078502492 - 0.2467898337061562 * 0.2467898337061562), 0.0005914501076613073, OhPointGen::points_48},
+            {0.4233760321547856, 0.3003104124785409, constexpr_sqrt(1.0 - 0.4233760321547856 * 0.4233760321547856 - 0.3003104124785409 * 0.3003104124785409), 0.0006104561257874195, OhPointGen::points_48},
+            {0.4758671236059246, 0.3526684328175033, constexpr_sqrt(1.0 - 0.4758671236059246 * 0.4758671236059246 - 0.3526684328175033 * 0.3526684328175033), 0.0006230252860707806, OhPointGen::points_48},
+            {0.5255178579796463, 0.4031134861145713, constexpr_sqrt(1.0 - 0.5255178579796463 * 0.5255178579796463 - 0.4031134861145713 * 0.4031134861145713), 0.0006305618761760796, OhPointGen::points_48},
+            {0.5718025633734589, 0.4509426448342351, constexpr_sqrt(1.0 - 0.5718025633734589 * 0.5718025633734589 - 0.4509426448342351 * 0.4509426448342351), 0.0006343092767597889, OhPointGen::points_48},
+            {0.2686927772723415, 0.04711322502423248, constexpr_sqrt(1.0 - 0.2686927772723415 * 0.2686927772723415 - 0.04711322502423248 * 0.04711322502423248), 0.0005176268945737827, OhPointGen::points_48},
+            {0.3306006819904809, 0.09784487303942696, constexpr_sqrt(1.0 - 0.3306006819904809 * 0.3306006819904809 - 0.09784487303942696 * 0.09784487303942696), 0.0005564840313313692, OhPointGen::points_48},
+            {0.3904906850594983, 0.1505395810025273, constexpr_sqrt(1.0 - 0.3904906850594983 * 0.3904906850594983 - 0.1505395810025273 * 0.1505395810025273), 0.000585642667103898, OhPointGen::points_48},
+            {0.447995795190439, 0.203972815629605, constexpr_sqrt(1.0 - 0.447995795190439 * 0.447995795190439 - 0.203972815629605 * 0.203972815629605), 0.0006066386925777091, OhPointGen::points_48},
+            {0.502707684891978, 0.2571529941121107, constexpr_sqrt(1.0 - 0.502707684891978 * 0.502707684891978 - 0.2571529941121107 * 0.2571529941121107), 0.0006208824962234458, OhPointGen::points_48},
+            {0.5542087392260217, 0.309219137581567, constexpr_sqrt(1.0 - 0.5542087392260217 * 0.5542087392260217 - 0.309219137581567 * 0.309219137581567), 0.0006296314297822907, OhPointGen::points_48},
+            {0.6020850887375186, 0.3593807506130276, constexpr_sqrt(1.0 - 0.6020850887375186 * 0.6020850887375186 - 0.3593807506130276 * 0.3593807506130276), 0.0006340423756791859, OhPointGen::points_48},
+            {0.4019851409179594, 0.05063389934378671, constexpr_sqrt(1.0 - 0.4019851409179594 * 0.4019851409179594 - 0.05063389934378671 * 0.05063389934378671), 0.0005829627677107342, OhPointGen::points_48},
+            {0.46356145674498, 0.1032422269160612, constexpr_sqrt(1.0 - 0.46356145674498 * 0.46356145674498 - 0.1032422269160612 * 0.1032422269160612), 0.000604869337608111, OhPointGen::points_48},
+            {0.5215860931591575, 0.1566322094006254, constexpr_sqrt(1.0 - 0.5215860931591575 * 0.5215860931591575 - 0.1566322094006254 * 0.1566322094006254), 0.0006202362317732461, OhPointGen::points_48},
+            {0.5758202499099271, 0.2098082827491099, constexpr_sqrt(1.0 - 0.5758202499099271 * 0.5758202499099271 - 0.2098082827491099 * 0.2098082827491099), 0.0006299005328403779, OhPointGen::points_48},
+            {0.6259893683876795, 0.2618824114553391, constexpr_sqrt(1.0 - 0.6259893683876795 * 0.6259893683876795 - 0.2618824114553391 * 0.2618824114553391), 0.0006347722390609352, OhPointGen::points_48},
+            {0.5313795124811891, 0.05263245019338556, constexpr_sqrt(1.0 - 0.5313795124811891 * 0.5313795124811891 - 0.05263245019338556 * 0.05263245019338556), 0.0006203778981238834, OhPointGen::points_48},
+            {0.5893317955931995, 0.1061059730982005, constexpr_sqrt(1.0 - 0.5893317955931995 * 0.5893317955931995 - 0.1061059730982005 * 0.1061059730982005), 0.0006308414671239979, OhPointGen::points_48},
+            {0.64262463212158, 0.1594171564034221, constexpr_sqrt(1.0 - 0.64262463212158 * 0.64262463212158 - 0.1594171564034221 * 0.1594171564034221), 0.0006362706466959498, OhPointGen::points_48},
+            {0.6511904367376113, 0.0535478953656554, constexpr_sqrt(1.0 - 0.6511904367376113 * 0.6511904367376113 - 0.0535478953656554 * 0.0535478953656554), 0.0006375414170333233, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
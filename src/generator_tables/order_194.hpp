@@ -0,0 +1,34 @@
+#ifndef GENERATOR_TABLE_ORDER_194_HPP
+#define GENERATOR_TABLE_ORDER_194_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_194>
+{
+    static constexpr std::array<GeneratorPoint, 9> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.001782340447244611, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.005716905949977102, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.005573383178848738, OhPointGen::points_8},
+            {0.6712973442695226, constexpr_sqrt(1.0 - 2.0 * 0.6712973442695226 * 0.6712973442695226), 0.0, 0.005608704082587997, OhPointGen::points_24},
+            {0.2892465627575439, constexpr_sqrt(1.0 - 2.0 * 0.2892465627575439 * 0.2892465627575439), 0.0, 0.005158237711805383, OhPointGen::points_24},
+            {0.4446933178717437, constexpr_sqrt(1.0 - 2.0 * 0.4446933178717437 * 0.4446933178717437), 0.0, 0.005518771467273614, OhPointGen::points_24},
+            {0.1299335447650067, constexpr_sqrt(1.0 - 2.0 * 0.1299335447650067 * 0.1299335447650067), 0.0, 0.004106777028169394, OhPointGen::points_24},
+            {0.3457702197611283, constexpr_sqrt(1.0 - 0.3457702197611283 * 0.3457702197611283), 0.0, 0.005051846064614808, OhPointGen::points_24_axis},
+            {0.159041710538353, 0.8360360154824589, constexpr_sqrt(1.0 - 0.159041710538353 * 0.159041710538353 - 0.8360360154824589 * 0.8360360154824589), 0.005530248916233094, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
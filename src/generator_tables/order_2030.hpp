@@ -0,0 +1,81 @@
+#ifndef GENERATOR_TABLE_ORDER_2030_HPP
+#define GENERATOR_TABLE_ORDER_2030_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_2030>
+{
+    static constexpr std::array<GeneratorPoint, 56> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 4.656031899197431e-05, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.0005421549195295507, OhPointGen::points_8},
+            {0.02540835336814348, constexpr_sqrt(1.0 - 2.0 * 0.02540835336814348 * 0.02540835336814348), 0.0, 0.0001778522133346553, OhPointGen::points_24},
+            {0.06399322800504915, constexpr_sqrt(1.0 - 2.0 * 0.06399322800504915 * 0.06399322800504915), 0.0, 0.0002811325405682796, OhPointGen::points_24},
+            {0.1088269469804125, constexpr_sqrt(1.0 - 2.0 * 0.1088269469804125 * 0.1088269469804125), 0.0, 0.0003548896312631459, OhPointGen::points_24},
+            {0.1570670798818287, constexpr_sqrt(1.0 - 2.0 * 0.1570670798818287 * 0.1570670798818287), 0.0, 0.0004090310897173364, OhPointGen::points_24},
+            {0.2071163932282514, constexpr_sqrt(1.0 - 2.0 * 0.2071163932282514 * 0.2071163932282514), 0.0, 0.0004493286134169965, OhPointGen::points_24},
+            {0.2578914044450844, constexpr_sqrt(1.0 - 2.0 * 0.2578914044450844 * 0.2578914044450844), 0.0, 0.0004793728447962723, OhPointGen::points_24},
+            {0.3085687558169623, constexpr_sqrt(1.0 - 2.0 * 0.3085687558169623 * 0.3085687558169623), 0.0, 0.0005015415319164265, OhPointGen::points_24},
+            {0.3584719706267024, constexpr_sqrt(1.0 - 2.0 * 0.3584719706267024 * 0.3584719706267024), 0.0, 0.0005175127372677937, OhPointGen::points_24},
+            {0.4070135594428709, constexpr_sqrt(1.0 - 2.0 * 0.4070135594428709 * 0.4070135594428709), 0.0, 0.0005285522262081019, OhPointGen::points_24},
+            {0.4536618626222638, constexpr_sqrt(1.0 - 2.0 * 0.4536618626222638 * 0.4536618626222638), 0.0, 0.0005356832703713962, OhPointGen::points_24},
+            {0.4979195686463577, constexpr_sqrt(1.0 - 2.0 * 0.4979195686463577 * 0.4979195686463577), 0.0, 0.000539791473617517, OhPointGen::points_24},
+            {0.5393075111126999, constexpr_sqrt(1.0 - 2.0 * 0.5393075111126999 * 0.5393075111126999), 0.0, 0.000541689944159993, OhPointGen::points_24},
+            {0.6115617676843916, constexpr_sqrt(1.0 - 2.0 * 0.6115617676843916 * 0.6115617676843916), 0.0, 0.0005419308476889938, OhPointGen::points_24},
+            {0.6414308435160159, constexpr_sqrt(1.0 - 2.0 * 0.6414308435160159 * 0.6414308435160159), 0.0, 0.0005416936902030596, OhPointGen::points_24},
+            {0.6664099412721607, constexpr_sqrt(1.0 - 2.0 * 0.6664099412721607 * 0.6664099412721607), 0.0, 0.0005419544338703164, OhPointGen::points_24},
+            {0.6859161771214913, constexpr_sqrt(1.0 - 2.0 * 0.6859161771214913 * 0.6859161771214913), 0.0, 0.0005428983656630974, OhPointGen::points_24},
+            {0.699362559350389, constexpr_sqrt(1.0 - 2.0 * 0.699362559350389 * 0.699362559350389), 0.0, 0.0005442286500098193, OhPointGen::points_24},
+            {0.706239338771938, constexpr_sqrt(1.0 - 2.0 * 0.706239338771938 * 0.706239338771938), 0.0, 0.0005452250345057301, OhPointGen::points_24},
+            {0.07479028168349763, constexpr_sqrt(1.0 - 0.07479028168349763 * 0.07479028168349763), 0.0, 0.000256800249772853, OhPointGen::points_24_axis},
+            {0.1848951153969366, constexpr_sqrt(1.0 - 0.1848951153969366 * 0.1848951153969366), 0.0, 0.0003827211700292145, OhPointGen::points_24_axis},
+            {0.3059529066581305, constexpr_sqrt(1.0 - 0.3059529066581305 * 0.3059529066581305), 0.0, 0.0004579491561917824, OhPointGen::points_24_axis},
+            {0.4285556101021362, constexpr_sqrt(1.0 - 0.4285556101021362 * 0.4285556101021362), 0.0, 0.0005042003969083574, OhPointGen::points_24_axis},
+            {0.5468758653496526, constexpr_sqrt(1.0 - 0.5468758653496526 * 0.5468758653496526), 0.0, 0.0005312708889976024, OhPointGen::points_24_axis},
+            {0.6565821978343439, constexpr_sqrt(1.0 - 0.6565821978343439 * 0.6565821978343439), 0.0, 0.0005438401790747117, OhPointGen::points_24_axis},
+            {0.1253901572367117, 0.03681917226439641, constexpr_sqrt(1.0 - 0.1253901572367117 * 0.1253901572367117 - 0.03681917226439641 * 0.03681917226439641), 0.0003316041873197344, OhPointGen::points_48},
+            {0.1775721510383941, 0.07982487607213301, constexpr_sqrt(1.0 - 0.1775721510383941 * 0.1775721510383941 - 0.07982487607213301 * 0.07982487607213301), 0.0003899113567153771, OhPointGen::points_48},
+            {0.2305693358216114, 0.1264640966592335, constexpr_sqrt(1.0 - 0.2305693358216114 * 0.2305693358216114 - 0.1264640966592335 * 0.1264640966592335), 0.0004343343327201309, OhPointGen::points_48},
+            {0.2836502845992063, 0.1751585683418957, constexpr_sqrt(1.0 - 0.2836502845992063 * 0.2836502845992063 - 0.1751585683418957 * 0.1751585683418957), 0.0004679415262318919, OhPointGen::points_48},
+            {0.336179474623259, 0.224799590763267, constexpr_sqrt(1.0 - 0.336179474623259 * 0.336179474623259 - 0.224799590763267 * 0.224799590763267), 0.0004930847981631031, OhPointGen::points_48},
+            {0.3875979172264824, 0.2745299257422246, constexpr_sqrt(1.0 - 0.3875979172264824 * 0.3875979172264824 - 0.2745299257422246 * 0.2745299257422246), 0.0005115031867540091, OhPointGen::points_48},
+            {0.4374019316999074, 0.3236373482441118, constexpr_sqrt(1.0 - 0.4374019316999074 * 0.4374019316999074 - 0.3236373482441118 * 0.3236373482441118), 0.0005245217148457367, OhPointGen::points_48},
+            {0.4851275843340022, 0.3714967859436741, constexpr_sqrt(1.0 - 0.4851275843340022 * 0.4851275843340022 - 0.3714967859436741 * 0.3714967859436741), 0.0005332041499895321, OhPointGen::points_48},
+            {0.5303391803806868, 0.4175353646321745, constexpr_sqrt(1.0 - 0.5303391803806868 * 0.5303391803806868 - 0.4175353646321745 * 0.4175353646321745), 0.0005384583126021542, OhPointGen::points_48},
+            {0.5726197380596287, 0.4612084406355461, constexpr_sqrt(1.0 - 0.5726197380596287 * 0.5726197380596287 - 0.4612084406355461 * 0.4612084406355461), 0.0005411067210798852, OhPointGen::points_48},
+            {0.2431520732564863, 0.04258040133043952, constexpr_sqrt(1.0 - 0.2431520732564863 * 0.2431520732564863 - 0.04258040133043952 * 0.04258040133043952), 0.0004259797391468714, OhPointGen::points_48},
+            {0.3002096800895869, 0.08869424306722722, constexpr_sqrt(1.0 - 0.3002096800895869 * 0.3002096800895869 - 0.08869424306722722 * 0.08869424306722722), 0.0004604931368460021, OhPointGen::points_48},
+            {0.3558554457457432, 0.1368811706510655, constexpr_sqrt(1.0 - 0.3558554457457432 * 0.3558554457457432 - 0.1368811706510655 * 0.1368811706510655), 0.0004871814878255202, OhPointGen::points_48},
+            {0.4097782537048887, 0.1860739985015033, constexpr_sqrt(1.0 - 0.4097782537048887 * 0.4097782537048887 - 0.1860739985015033 * 0.1860739985015033), 0.0005072242910074885, OhPointGen::points_48},
+            {0.4616337666067458, 0.2354235077395853, constexpr_sqrt(1.0 - 0.4616337666067458 * 0.4616337666067458 - 0.2354235077395853 * 0.2354235077395853), 0.000521706984523535, OhPointGen::points_48},
+            {0.5110707008417874, 0.2842074921347011, constexpr_sqrt(1.0 - 0.5110707008417874 * 0.5110707008417874 - 0.2842074921347011 * 0.2842074921347011), 0.000531578596628031, OhPointGen::points_48},
+            {0.5577415286163795, 0.3317784414984102, constexpr_sqrt(1.0 - 0.5577415286163795 * 0.5577415286163795 - 0.3317784414984102 * 0.3317784414984102), 0.0005376833708758905, OhPointGen::points_48},
+            {0.601306043136695, 0.37752990020407, constexpr_sqrt(1.0 - 0.601306043136695 * 0.601306043136695 - 0.37752990020407 * 0.37752990020407), 0.0005408032092069521, OhPointGen::points_48},
+            {0.3661596767261781, 0.04599367887164592, constexpr_sqrt(1.0 - 0.3661596767261781 * 0.3661596767261781 - 0.04599367887164592 * 0.04599367887164592), 0.0004842744917904866, OhPointGen::points_48},
+            {0.4237633153506581, 0.0940489377365442, constexpr_sqrt(1.0 - 0.4237633153506581 * 0.4237633153506581 - 0.0940489377365442 * 0.0940489377365442), 0.000504892607618813, OhPointGen::points_48},
+            {0.4786328454658452, 0.1431377109091971, constexpr_sqrt(1.0 - 0.4786328454658452 * 0.4786328454658452 - 0.1431377109091971 * 0.1431377109091971), 0.0005202607980478373, OhPointGen::points_48},
+            {0.5305702076789774, 0.192418638884357, constexpr_sqrt(1.0 - 0.5305702076789774 * 0.5305702076789774 - 0.192418638884357 * 0.192418638884357), 0.0005309932388325743, OhPointGen::points_48},
+            {0.5793436224231788, 0.241159094477519, constexpr_sqrt(1.0 - 0.5793436224231788 * 0.5793436224231788 - 0.241159094477519 * 0.241159094477519), 0.0005377419770895208, OhPointGen::points_48},
+            {0.6247069017094747, 0.2886871491583605, constexpr_sqrt(1.0 - 0.6247069017094747 * 0.6247069017094747 - 0.2886871491583605 * 0.2886871491583605), 0.0005411696331677717, OhPointGen::points_48},
+            {0.4874315552535204, 0.04804978774953206, constexpr_sqrt(1.0 - 0.4874315552535204 * 0.4874315552535204 - 0.04804978774953206 * 0.04804978774953206), 0.000519799629328242, OhPointGen::points_48},
+            {0.5427337322059053, 0.09716857199366664, constexpr_sqrt(1.0 - 0.5427337322059053 * 0.5427337322059053 - 0.09716857199366664 * 0.09716857199366664), 0.0005311120836622945, OhPointGen::points_48},
+            {0.59434937472467, 0.1465205839795055, constexpr_sqrt(1.0 - 0.59434937472467 * 0.59434937472467 - 0.1465205839795055 * 0.1465205839795055), 0.0005384309319956951, OhPointGen::points_48},
+            {0.6421314033564943, 0.1953579449803574, constexpr_sqrt(1.0 - 0.6421314033564943 * 0.6421314033564943 - 0.1953579449803574 * 0.1953579449803574), 0.0005421859504051886, OhPointGen::points_48},
+            {0.602062837471398, 0.04916375015738108, constexpr_sqrt(1.0 - 0.602062837471398 * 0.602062837471398 - 0.04916375015738108 * 0.04916375015738108), 0.0005390948355046314, OhPointGen::points_48},
+            {0.6529222529856881, 0.09861621540127004, constexpr_sqrt(1.0 - 0.6529222529856881 * 0.6529222529856881 - 0.09861621540127004 * 0.09861621540127004), 0.0005433312705027845, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
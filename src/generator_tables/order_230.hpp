@@ -0,0 +1,35 @@
+#ifndef GENERATOR_TABLE_ORDER_230_HPP
+#define GENERATOR_TABLE_ORDER_230_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_230>
+{
+    static constexpr std::array<GeneratorPoint, 10> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, -0.05522639919727325, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.004450274607445226, OhPointGen::points_8},
+            {0.4492044687397611, constexpr_sqrt(1.0 - 2.0 * 0.4492044687397611 * 0.4492044687397611), 0.0, 0.004496841067921404, OhPointGen::points_24},
+            {0.2520419490210201, constexpr_sqrt(1.0 - 2.0 * 0.2520419490210201 * 0.2520419490210201), 0.0, 0.00504915345047875, OhPointGen::points_24},
+            {0.6981906658447242, constexpr_sqrt(1.0 - 2.0 * 0.6981906658447242 * 0.6981906658447242), 0.0, 0.003976408018051883, OhPointGen::points_24},
+            {0.658740524346096, constexpr_sqrt(1.0 - 2.0 * 0.658740524346096 * 0.658740524346096), 0.0, 0.004401400650381014, OhPointGen::points_24},
+            {0.0403854405009766, constexpr_sqrt(1.0 - 2.0 * 0.0403854405009766 * 0.0403854405009766), 0.0, 0.01724544350544401, OhPointGen::points_24},
+            {0.5823842309715584, constexpr_sqrt(1.0 - 0.5823842309715584 * 0.5823842309715584), 0.0, 0.004231083095357343, OhPointGen::points_24_axis},
+            {0.3545877390518688, constexpr_sqrt(1.0 - 0.3545877390518688 * 0.3545877390518688), 0.0, 0.005198069864064399, OhPointGen::points_24_axis},
+            {0.2272181808998187, 0.4864661535886647, constexpr_sqrt(1.0 - 0.2272181808998187 * 0.2272181808998187 - 0.4864661535886647 * 0.4864661535886647), 0.004695720972568883, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
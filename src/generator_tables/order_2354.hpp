@@ -0,0 +1,89 @@
+#ifndef GENERATOR_TABLE_ORDER_2354_HPP
+#define GENERATOR_TABLE_ORDER_2354_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_2354>
+{
+    static constexpr std::array<GeneratorPoint, 64> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 3.922616270665292e-05, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.0004703831750854424, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.0004678202801282136, OhPointGen::points_8},
+            {0.02290024646530589, constexpr_sqrt(1.0 - 2.0 * 0.02290024646530589 * 0.02290024646530589), 0.0, 0.00014378322289799, OhPointGen::points_24},
+            {0.05779086652271284, constexpr_sqrt(1.0 - 2.0 * 0.05779086652271284 * 0.05779086652271284), 0.0, 0.0002303572493577644, OhPointGen::points_24},
+            {0.09863103576375984, constexpr_sqrt(1.0 - 2.0 * 0.09863103576375984 * 0.09863103576375984), 0.0, 0.0002933110752447454, OhPointGen::points_24},
+            {0.1428155792982185, constexpr_sqrt(1.0 - 2.0 * 0.1428155792982185 * 0.1428155792982185), 0.0, 0.0003402905998359838, OhPointGen::points_24},
+            {0.1888978116601463, constexpr_sqrt(1.0 - 2.0 * 0.1888978116601463 * 0.1888978116601463), 0.0, 0.0003759138466870372, OhPointGen::points_24},
+            {0.235909168297021, constexpr_sqrt(1.0 - 2.0 * 0.235909168297021 * 0.235909168297021), 0.0, 0.0004030638447899798, OhPointGen::points_24},
+            {0.2831228833706171, constexpr_sqrt(1.0 - 2.0 * 0.2831228833706171 * 0.2831228833706171), 0.0, 0.0004236591432242211, OhPointGen::points_24},
+            {0.3299495857966693, constexpr_sqrt(1.0 - 2.0 * 0.3299495857966693 * 0.3299495857966693), 0.0, 0.0004390522656946746, OhPointGen::points_24},
+            {0.3758840802660796, constexpr_sqrt(1.0 - 2.0 * 0.3758840802660796 * 0.3758840802660796), 0.0, 0.0004502523466626247, OhPointGen::points_24},
+            {0.420475183100948, constexpr_sqrt(1.0 - 2.0 * 0.420475183100948 * 0.420475183100948), 0.0, 0.0004580577727783541, OhPointGen::points_24},
+            {0.4633068518751051, constexpr_sqrt(1.0 - 2.0 * 0.4633068518751051 * 0.4633068518751051), 0.0, 0.0004631391616615899, OhPointGen::points_24},
+            {0.5039849474507313, constexpr_sqrt(1.0 - 2.0 * 0.5039849474507313 * 0.5039849474507313), 0.0, 0.0004660928953698676, OhPointGen::points_24},
+            {0.5421265793440747, constexpr_sqrt(1.0 - 2.0 * 0.5421265793440747 * 0.5421265793440747), 0.0, 0.0004674751807936953, OhPointGen::points_24},
+            {0.609266023055731, constexpr_sqrt(1.0 - 2.0 * 0.609266023055731 * 0.609266023055731), 0.0, 0.000467641490393292, OhPointGen::points_24},
+            {0.6374654204984869, constexpr_sqrt(1.0 - 2.0 * 0.6374654204984869 * 0.6374654204984869), 0.0, 0.000467408649234787, OhPointGen::points_24},
+            {0.6615136472609892, constexpr_sqrt(1.0 - 2.0 * 0.6615136472609892 * 0.6615136472609892), 0.0, 0.0004674928539483207, OhPointGen::points_24},
+            {0.6809487285958127, constexpr_sqrt(1.0 - 2.0 * 0.6809487285958127 * 0.6809487285958127), 0.0, 0.0004680748979686447, OhPointGen::points_24},
+            {0.6952980021665196, constexpr_sqrt(1.0 - 2.0 * 0.6952980021665196 * 0.6952980021665196), 0.0, 0.000469044980638904, OhPointGen::points_24},
+            {0.70412454976954, constexpr_sqrt(1.0 - 2.0 * 0.70412454976954 * 0.70412454976954), 0.0, 0.0004699877075860818, OhPointGen::points_24},
+            {0.06744033088306065, constexpr_sqrt(1.0 - 0.06744033088306065 * 0.06744033088306065), 0.0, 0.0002099942281069176, OhPointGen::points_24_axis},
+            {0.1678684485334166, constexpr_sqrt(1.0 - 0.1678684485334166 * 0.1678684485334166), 0.0, 0.0003172269150712804, OhPointGen::points_24_axis},
+            {0.2793559049539613, constexpr_sqrt(1.0 - 0.2793559049539613 * 0.2793559049539613), 0.0, 0.0003832051358546523, OhPointGen::points_24_axis},
+            {0.3935264218057639, constexpr_sqrt(1.0 - 0.3935264218057639 * 0.3935264218057639), 0.0, 0.0004252193818146985, OhPointGen::points_24_axis},
+            {0.5052629268232558, constexpr_sqrt(1.0 - 0.5052629268232558 * 0.5052629268232558), 0.0, 0.0004513807963755, OhPointGen::points_24_axis},
+            {0.6107905315437531, constexpr_sqrt(1.0 - 0.6107905315437531 * 0.6107905315437531), 0.0, 0.0004657797469114178, OhPointGen::points_24_axis},
+            {0.1135081039843524, 0.03331954884662588, constexpr_sqrt(1.0 - 0.1135081039843524 * 0.1135081039843524 - 0.03331954884662588 * 0.03331954884662588), 0.0002733362800522836, OhPointGen::points_48},
+            {0.1612866626099378, 0.07247167465436538, constexpr_sqrt(1.0 - 0.1612866626099378 * 0.1612866626099378 - 0.07247167465436538 * 0.07247167465436538), 0.0003235485368463559, OhPointGen::points_48},
+            {0.2100786550168205, 0.1151539110849745, constexpr_sqrt(1.0 - 0.2100786550168205 * 0.2100786550168205 - 0.1151539110849745 * 0.1151539110849745), 0.0003624908726013453, OhPointGen::points_48},
+            {0.2592282009459942, 0.1599491097143677, constexpr_sqrt(1.0 - 0.2592282009459942 * 0.2592282009459942 - 0.1599491097143677 * 0.1599491097143677), 0.0003925540070712828, OhPointGen::points_48},
+            {0.3081740561320203, 0.2058699956028027, constexpr_sqrt(1.0 - 0.3081740561320203 * 0.3081740561320203 - 0.2058699956028027 * 0.2058699956028027), 0.0004156129781116235, OhPointGen::points_48},
+            {0.3564289781578164, 0.2521624953502911, constexpr_sqrt(1.0 - 0.3564289781578164 * 0.3564289781578164 - 0.2521624953502911 * 0.2521624953502911), 0.0004330644984623263, OhPointGen::points_48},
+            {0.4035587288240703, 0.2982090785797674, constexpr_sqrt(1.0 - 0.4035587288240703 * 0.4035587288240703 - 0.2982090785797674 * 0.2982090785797674), 0.0004459677725921312, OhPointGen::points_48},
+            {0.4491671196373903, 0.3434762087235733, constexpr_sqrt(1.0 - 0.4491671196373903 * 0.4491671196373903 - 0.3434762087235733 * 0.3434762087235733), 0.0004551593004456795, OhPointGen::points_48},
+            {0.4928854782917489, 0.3874831357203437, constexpr_sqrt(1.0 - 0.4928854782917489 * 0.4928854782917489 - 0.3874831357203437 * 0.3874831357203437), 0.0004613341462749918, OhPointGen::points_48},
+            {0.5343646791958988, 0.4297814821746926, constexpr_sqrt(1.0 - 0.5343646791958988 * 0.5343646791958988 - 0.4297814821746926 * 0.4297814821746926), 0.0004651019618269806, OhPointGen::points_48},
+            {0.573268321653099, 0.4699402260943537, constexpr_sqrt(1.0 - 0.573268321653099 * 0.573268321653099 - 0.4699402260943537 * 0.4699402260943537), 0.0004670249536100625, OhPointGen::points_48},
+            {0.2214131583218986, 0.03873602040643895, constexpr_sqrt(1.0 - 0.2214131583218986 * 0.2214131583218986 - 0.03873602040643895 * 0.03873602040643895), 0.0003549555576441708, OhPointGen::points_48},
+            {0.2741796504750071, 0.08089496256902012, constexpr_sqrt(1.0 - 0.2741796504750071 * 0.2741796504750071 - 0.08089496256902012 * 0.08089496256902012), 0.000385610824524901, OhPointGen::points_48},
+            {0.3259797439149485, 0.1251732177620872, constexpr_sqrt(1.0 - 0.3259797439149485 * 0.3259797439149485 - 0.1251732177620872 * 0.1251732177620872), 0.0004098622845756882, OhPointGen::points_48},
+            {0.3765441148826891, 0.1706260286403185, constexpr_sqrt(1.0 - 0.3765441148826891 * 0.3765441148826891 - 0.1706260286403185 * 0.1706260286403185), 0.000428632860426895, OhPointGen::points_48},
+            {0.4255773574530558, 0.2165115147300408, constexpr_sqrt(1.0 - 0.4255773574530558 * 0.4255773574530558 - 0.2165115147300408 * 0.2165115147300408), 0.0004427802198993945, OhPointGen::points_48},
+            {0.472779511705843, 0.2622089812225259, constexpr_sqrt(1.0 - 0.472779511705843 * 0.472779511705843 - 0.2622089812225259 * 0.2622089812225259), 0.0004530473511488561, OhPointGen::points_48},
+            {0.5178546895819012, 0.3071721431296201, constexpr_sqrt(1.0 - 0.5178546895819012 * 0.5178546895819012 - 0.3071721431296201 * 0.3071721431296201), 0.0004600805475703138, OhPointGen::points_48},
+            {0.560514119209746, 0.3508998998801138, constexpr_sqrt(1.0 - 0.560514119209746 * 0.560514119209746 - 0.3508998998801138 * 0.3508998998801138), 0.0004644599059958017, OhPointGen::points_48},
+            {0.6004763319352512, 0.3929160876166931, constexpr_sqrt(1.0 - 0.6004763319352512 * 0.6004763319352512 - 0.3929160876166931 * 0.3929160876166931), 0.0004667274455712508, OhPointGen::points_48},
+            {0.3352842634946949, 0.04202563457288019, constexpr_sqrt(1.0 - 0.3352842634946949 * 0.3352842634946949 - 0.04202563457288019 * 0.04202563457288019), 0.0004069360518020356, OhPointGen::points_48},
+            {0.389197162981467, 0.0861430975887085, constexpr_sqrt(1.0 - 0.389197162981467 * 0.389197162981467 - 0.0861430975887085 * 0.0861430975887085), 0.0004260442819919195, OhPointGen::points_48},
+            {0.4409875565542281, 0.1314500879380001, constexpr_sqrt(1.0 - 0.4409875565542281 * 0.4409875565542281 - 0.1314500879380001 * 0.1314500879380001), 0.0004408678508029063, OhPointGen::points_48},
+            {0.4904893058592484, 0.1772189657383859, constexpr_sqrt(1.0 - 0.4904893058592484 * 0.4904893058592484 - 0.1772189657383859 * 0.1772189657383859), 0.0004518748115548597, OhPointGen::points_48},
+            {0.537505613876955, 0.2228277110050294, constexpr_sqrt(1.0 - 0.537505613876955 * 0.537505613876955 - 0.2228277110050294 * 0.2228277110050294), 0.0004595564875375116, OhPointGen::points_48},
+            {0.5818255708669969, 0.2677179935014386, constexpr_sqrt(1.0 - 0.5818255708669969 * 0.5818255708669969 - 0.2677179935014386 * 0.2677179935014386), 0.0004643988774315846, OhPointGen::points_48},
+            {0.6232334858144959, 0.3113675035544165, constexpr_sqrt(1.0 - 0.6232334858144959 * 0.6232334858144959 - 0.3113675035544165 * 0.3113675035544165), 0.0004668827491646946, OhPointGen::points_48},
+            {0.4489485354492058, 0.04409162378368174, constexpr_sqrt(1.0 - 0.4489485354492058 * 0.4489485354492058 - 0.04409162378368174 * 0.04409162378368174), 0.0004400541823741973, OhPointGen::points_48},
+            {0.501513687593315, 0.08939009917748489, constexpr_sqrt(1.0 - 0.501513687593315 * 0.501513687593315 - 0.08939009917748489 * 0.08939009917748489), 0.0004514512890193797, OhPointGen::points_48},
+            {0.5511300550512623, 0.1351806029383365, constexpr_sqrt(1.0 - 0.5511300550512623 * 0.5511300550512623 - 0.1351806029383365 * 0.1351806029383365), 0.0004596198627347549, OhPointGen::points_48},
+            {0.5976720409858, 0.1808370355053196, constexpr_sqrt(1.0 - 0.5976720409858 * 0.5976720409858 - 0.1808370355053196 * 0.1808370355053196), 0.0004648659016801781, OhPointGen::points_48},
+            {0.6409956378989354, 0.2257852192301602, constexpr_sqrt(1.0 - 0.6409956378989354 * 0.6409956378989354 - 0.2257852192301602 * 0.2257852192301602), 0.0004675502017157673, OhPointGen::points_48},
+            {0.5581222330827514, 0.0453217342163716, constexpr_sqrt(1.0 - 0.5581222330827514 * 0.5581222330827514 - 0.0453217342163716 * 0.0453217342163716), 0.0004598494476455523, OhPointGen::points_48},
+            {0.6074705984161695, 0.09117488031840314, constexpr_sqrt(1.0 - 0.6074705984161695 * 0.6074705984161695 - 0.09117488031840314 * 0.09117488031840314), 0.0004654916955152048, OhPointGen::points_48},
+            {0.6532272537379032, 0.1369294213140155, constexpr_sqrt(1.0 - 0.6532272537379032 * 0.6532272537379032 - 0.1369294213140155 * 0.1369294213140155), 0.0004684709779505137, OhPointGen::points_48},
+            {0.6594761494500487, 0.04589901487275583, constexpr_sqrt(1.0 - 0.6594761494500487 * 0.6594761494500487 - 0.04589901487275583 * 0.04589901487275583), 0.0004691445539106986, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef GENERATOR_TABLE_ORDER_26_HPP
+#define GENERATOR_TABLE_ORDER_26_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_26>
+{
+    static constexpr std::array<GeneratorPoint, 3> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.04761904761904762, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.0380952380952381, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.03214285714285714, OhPointGen::points_8}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef GENERATOR_TABLE_ORDER_266_HPP
+#define GENERATOR_TABLE_ORDER_266_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_266>
+{
+    static constexpr std::array<GeneratorPoint, 11> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, -0.001313769127326952, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, -0.002522728704859336, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.004186853881700583, OhPointGen::points_8},
+            {0.7039373391585475, constexpr_sqrt(1.0 - 2.0 * 0.7039373391585475 * 0.7039373391585475), 0.0, 0.005315167977810885, OhPointGen::points_24},
+            {0.1012526248572414, constexpr_sqrt(1.0 - 2.0 * 0.1012526248572414 * 0.1012526248572414), 0.0, 0.004047142377086219, OhPointGen::points_24},
+            {0.4647448726420539, constexpr_sqrt(1.0 - 2.0 * 0.4647448726420539 * 0.4647448726420539), 0.0, 0.00411248239440699, OhPointGen::points_24},
+            {0.3277420654971629, constexpr_sqrt(1.0 - 2.0 * 0.3277420654971629 * 0.3277420654971629), 0.0, 0.003595584899758782, OhPointGen::points_24},
+            {0.6620338663699974, constexpr_sqrt(1.0 - 2.0 * 0.6620338663699974 * 0.6620338663699974), 0.0, 0.004256131351428158, OhPointGen::points_24},
+            {0.8506508083520399, constexpr_sqrt(1.0 - 0.8506508083520399 * 0.8506508083520399), 0.0, 0.00422958270064724, OhPointGen::points_24_axis},
+            {0.3233484542692899, 0.1153112011009701, constexpr_sqrt(1.0 - 0.3233484542692899 * 0.3233484542692899 - 0.1153112011009701 * 0.1153112011009701), 0.004080914225780505, OhPointGen::points_48},
+            {0.2314790158712601, 0.5244939240922365, constexpr_sqrt(1.0 - 0.2314790158712601 * 0.2314790158712601 - 0.5244939240922365 * 0.5244939240922365), 0.004071467593830964, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef GENERATOR_TABLE_ORDER_2702_HPP
+#define GENERATOR_TABLE_ORDER_2702_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_2702>
+{
+    static constexpr std::array<GeneratorPoint, 72> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 2.998675149888161e-05, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.0004077860529495355, OhPointGen::points_8},
+            {0.02065562538818703, constexpr_sqrt(1.0 - 2.0 * 0.02065562538818703 * 0.02065562538818703), 0.0, 0.0001185349192520667, OhPointGen::points_24},
+            {0.05250918173022379, constexpr_sqrt(1.0 - 2.0 * 0.05250918173022379 * 0.05250918173022379), 0.0, 0.0001913408643425751, OhPointGen::points_24},
+            {0.08993480082038376, constexpr_sqrt(1.0 - 2.0 * 0.08993480082038376 * 0.08993480082038376), 0.0, 0.0002452886577209897, OhPointGen::points_24},
+            {0.1306023924436019, constexpr_sqrt(1.0 - 2.0 * 0.1306023924436019 * 0.1306023924436019), 0.0, 0.0002862408183288702, OhPointGen::points_24},
+            {0.1732060388531418, constexpr_sqrt(1.0 - 2.0 * 0.1732060388531418 * 0.1732060388531418), 0.0, 0.0003178032258257357, OhPointGen::points_24},
+            {0.2168727084820249, constexpr_sqrt(1.0 - 2.0 * 0.2168727084820249 * 0.2168727084820249), 0.0, 0.000342294566763369, OhPointGen::points_24},
+            {0.2609528309173586, constexpr_sqrt(1.0 - 2.0 * 0.2609528309173586 * 0.2609528309173586), 0.0, 0.0003612790520235922, OhPointGen::points_24},
+            {0.3049252927938952, constexpr_sqrt(1.0 - 2.0 * 0.3049252927938952 * 0.3049252927938952), 0.0, 0.0003758638229818521, OhPointGen::points_24},
+            {0.3483484138084404, constexpr_sqrt(1.0 - 2.0 * 0.3483484138084404 * 0.3483484138084404), 0.0, 0.0003868711798859953, OhPointGen::points_24},
+            {0.3908321549106406, constexpr_sqrt(1.0 - 2.0 * 0.3908321549106406 * 0.3908321549106406), 0.0, 0.0003949429933189938, OhPointGen::points_24},
+            {0.4320210071894814, constexpr_sqrt(1.0 - 2.0 * 0.4320210071894814 * 0.4320210071894814), 0.0, 0.0004006068107541156, OhPointGen::points_24},
+            {0.4715824795890053, constexpr_sqrt(1.0 - 2.0 * 0.4715824795890053 * 0.4715824795890053), 0.0, 0.0004043192149672723, OhPointGen::points_24},
+            {0.5091984794078454, constexpr_sqrt(1.0 - 2.0 * 0.5091984794078454 * 0.5091984794078454), 0.0, 0.0004064947495808078, OhPointGen::points_24},
+            {0.5445580145650804, constexpr_sqrt(1.0 - 2.0 * 0.5445580145650804 * 0.5445580145650804), 0.0, 0.0004075245619813152, OhPointGen::points_24},
+            {0.6072575796841768, constexpr_sqrt(1.0 - 2.0 * 0.6072575796841768 * 0.6072575796841768), 0.0, 0.0004076423540893566, OhPointGen::points_24},
+            {0.6339484505755802, constexpr_sqrt(1.0 - 2.0 * 0.6339484505755802 * 0.6339484505755802), 0.0, 0.0004074280862251555, OhPointGen::points_24},
+            {0.6570718257486958, constexpr_sqrt(1.0 - 2.0 * 0.6570718257486958 * 0.6570718257486958), 0.0, 0.0004074163756012244, OhPointGen::points_24},
+            {0.6762557330090709, constexpr_sqrt(1.0 - 2.0 * 0.6762557330090709 * 0.6762557330090709), 0.0, 0.0004077647795071246, OhPointGen::points_24},
+            {0.691116169692379, constexpr_sqrt(1.0 - 2.0 * 0.691116169692379 * 0.691116169692379), 0.0, 0.000408451755278253, OhPointGen::points_24},
+            {0.701284191165996, constexpr_sqrt(1.0 - 2.0 * 0.701284191165996 * 0.701284191165996), 0.0, 0.0004092468459224052, OhPointGen::points_24},
+            {0.706455927241002, constexpr_sqrt(1.0 - 2.0 * 0.706455927241002 * 0.706455927241002), 0.0, 0.0004097872687240906, OhPointGen::points_24},
+            {0.06123554989894765, constexpr_sqrt(1.0 - 0.06123554989894765 * 0.06123554989894765), 0.0, 0.0001738986811745028, OhPointGen::points_24_axis},
+            {0.1533070348312393, constexpr_sqrt(1.0 - 0.1533070348312393 * 0.1533070348312393), 0.0, 0.0002659616045280191, OhPointGen::points_24_axis},
+            {0.2563902605244206, constexpr_sqrt(1.0 - 0.2563902605244206 * 0.2563902605244206), 0.0, 0.0003240596008171533, OhPointGen::points_24_axis},
+            {0.3629346991663361, constexpr_sqrt(1.0 - 0.3629346991663361 * 0.3629346991663361), 0.0, 0.0003621195964432943, OhPointGen::points_24_axis},
+            {0.4683949968987538, constexpr_sqrt(1.0 - 0.4683949968987538 * 0.4683949968987538), 0.0, 0.0003868838330760539, OhPointGen::points_24_axis},
+            {0.5694479240657953, constexpr_sqrt(1.0 - 0.5694479240657953 * 0.5694479240657953), 0.0, 0.0004018911532693111, OhPointGen::points_24_axis},
+            {0.6634465430993955, constexpr_sqrt(1.0 - 0.6634465430993955 * 0.6634465430993955), 0.0, 0.0004089929432983252, OhPointGen::points_24_axis},
+            {0.1033958573552305, 0.03034544009063584, constexpr_sqrt(1.0 - 0.1033958573552305 * 0.1033958573552305 - 0.03034544009063584 * 0.03034544009063584), 0.0002279907527706409, OhPointGen::points_48},
+            {0.1473521412414395, 0.06618803044247135, constexpr_sqrt(1.0 - 0.1473521412414395 * 0.1473521412414395 - 0.06618803044247135 * 0.06618803044247135), 0.0002715205490578897, OhPointGen::points_48},
+            {0.1924552158705967, 0.1054431128987715, constexpr_sqrt(1.0 - 0.1924552158705967 * 0.1924552158705967 - 0.1054431128987715 * 0.1054431128987715), 0.0003057917896703976, OhPointGen::points_48},
+            {0.2381094362890328, 0.1468263551238858, constexpr_sqrt(1.0 - 0.2381094362890328 * 0.2381094362890328 - 0.1468263551238858 * 0.1468263551238858), 0.0003326913052452555, OhPointGen::points_48},
+            {0.283812170793676, 0.1894486108187886, constexpr_sqrt(1.0 - 0.283812170793676 * 0.283812170793676 - 0.1894486108187886 * 0.1894486108187886), 0.0003537334711890037, OhPointGen::points_48},
+            {0.3291323133373415, 0.2326374238761579, constexpr_sqrt(1.0 - 0.3291323133373415 * 0.3291323133373415 - 0.2326374238761579 * 0.2326374238761579), 0.0003700567500783129, OhPointGen::points_48},
+            {0.373689697874146, 0.2758485808485768, constexpr_sqrt(1.0 - 0.373689697874146 * 0.373689697874146 - 0.2758485808485768 * 0.2758485808485768), 0.0003825245372589122, OhPointGen::points_48},
+            {0.4171406040760013, 0.3186179331996921, constexpr_sqrt(1.0 - 0.4171406040760013 * 0.4171406040760013 - 0.3186179331996921 * 0.3186179331996921), 0.0003918125171518296, OhPointGen::points_48},
+            {0.4591677985256915, 0.3605329796303794, constexpr_sqrt(1.0 - 0.4591677985256915 * 0.4591677985256915 - 0.3605329796303794 * 0.3605329796303794), 0.0003984720419937579, OhPointGen::points_48},
+            {0.4994733831718418, 0.4012147253586509, constexpr_sqrt(1.0 - 0.4994733831718418 * 0.4994733831718418 - 0.4012147253586509 * 0.4012147253586509), 0.0004029746003338211, OhPointGen::points_48},
+            {0.5377731830445096, 0.4403050025570692, constexpr_sqrt(1.0 - 0.5377731830445096 * 0.5377731830445096 - 0.4403050025570692 * 0.4403050025570692), 0.0004057428632156627, OhPointGen::points_48},
+            {0.5737917830001331, 0.4774565904277483, constexpr_sqrt(1.0 - 0.5737917830001331 * 0.5737917830001331 - 0.4774565904277483 * 0.4774565904277483), 0.0004071719274114857, OhPointGen::points_48},
+            {0.2027323586271389, 0.03544122504976147, constexpr_sqrt(1.0 - 0.2027323586271389 * 0.2027323586271389 - 0.03544122504976147 * 0.03544122504976147), 0.0002990236950664119, OhPointGen::points_48},
+            {0.2516942375187273, 0.07418304388646328, constexpr_sqrt(1.0 - 0.2516942375187273 * 0.2516942375187273 - 0.07418304388646328 * 0.07418304388646328), 0.0003262951734212878, OhPointGen::points_48},
+            {0.3000227995257181, 0.1150502745727186, constexpr_sqrt(1.0 - 0.3000227995257181 * 0.3000227995257181 - 0.1150502745727186 * 0.1150502745727186), 0.0003482634608242413, OhPointGen::points_48},
+            {0.3474806691046342, 0.1571963371209364, constexpr_sqrt(1.0 - 0.3474806691046342 * 0.3474806691046342 - 0.1571963371209364 * 0.1571963371209364), 0.0003656596681700892, OhPointGen::points_48},
+            {0.3938103180359209, 0.19996318772471, constexpr_sqrt(1.0 - 0.3938103180359209 * 0.3938103180359209 - 0.19996318772471 * 0.19996318772471), 0.0003791740467794218, OhPointGen::points_48},
+            {0.4387519590455703, 0.2428073457846535, constexpr_sqrt(1.0 - 0.4387519590455703 * 0.4387519590455703 - 0.2428073457846535 * 0.2428073457846535), 0.0003894034450156905, OhPointGen::points_48},
+            {0.4820503960077787, 0.2852575132906155, constexpr_sqrt(1.0 - 0.4820503960077787 * 0.4820503960077787 - 0.2852575132906155 * 0.2852575132906155), 0.0003968600245508371, OhPointGen::points_48},
+            {0.5234573778475101, 0.3268884208674639, constexpr_sqrt(1.0 - 0.5234573778475101 * 0.5234573778475101 - 0.3268884208674639 * 0.3268884208674639), 0.000401993135142005, OhPointGen::points_48},
+            {0.5627318647235282, 0.3673033321675939, constexpr_sqrt(1.0 - 0.5627318647235282 * 0.5627318647235282 - 0.3673033321675939 * 0.3673033321675939), 0.0004052108801278599, OhPointGen::points_48},
+            {0.5996390607156954, 0.406121155183029, constexpr_sqrt(1.0 - 0.5996390607156954 * 0.5996390607156954 - 0.406121155183029 * 0.406121155183029), 0.0004068978613940934, OhPointGen::points_48},
+            {0.3084780753791947, 0.03860125523100059, constexpr_sqrt(1.0 - 0.3084780753791947 * 0.3084780753791947 - 0.03860125523100059 * 0.03860125523100059), 0.0003454275351319704, OhPointGen::points_48},
+            {0.3589988275920223, 0.07928938987104867, constexpr_sqrt(1.0 - 0.3589988275920223 * 0.3589988275920223 - 0.07928938987104867 * 0.07928938987104867), 0.000362996353700792, OhPointGen::points_48},
+            {0.4078628415881973, 0.1212614643030087, constexpr_sqrt(1.0 - 0.4078628415881973 * 0.4078628415881973 - 0.1212614643030087 * 0.1212614643030087), 0.0003770187233889873, OhPointGen::points_48},
+            {0.4549287258889735, 0.1638770827382693, constexpr_sqrt(1.0 - 0.4549287258889735 * 0.4549287258889735 - 0.1638770827382693 * 0.1638770827382693), 0.0003878608613694378, OhPointGen::points_48},
+            {0.5000278512957279, 0.2065965798260176, constexpr_sqrt(1.0 - 0.5000278512957279 * 0.5000278512957279 - 0.2065965798260176 * 0.2065965798260176), 0.0003959065270221274, OhPointGen::points_48},
+            {0.5429785044928199, 0.2489436378852235, constexpr_sqrt(1.0 - 0.5429785044928199 * 0.5429785044928199 - 0.2489436378852235 * 0.2489436378852235), 0.000401528697546357, OhPointGen::points_48},
+            {0.5835939850491711, 0.2904811368946891, constexpr_sqrt(1.0 - 0.5835939850491711 * 0.5835939850491711 - 0.2904811368946891 * 0.2904811368946891), 0.0004050866785614717, OhPointGen::points_48},
+            {0.6216870353444856, 0.3307941957666609, constexpr_sqrt(1.0 - 0.6216870353444856 * 0.6216870353444856 - 0.3307941957666609 * 0.3307941957666609), 0.0004069320185051913, OhPointGen::points_48},
+            {0.4151104662709091, 0.04064829146052554, constexpr_sqrt(1.0 - 0.4151104662709091 * 0.4151104662709091 - 0.04064829146052554 * 0.04064829146052554), 0.0003760120964062763, OhPointGen::points_48},
+            {0.4649804275009218, 0.08258424547294756, constexpr_sqrt(1.0 - 0.4649804275009218 * 0.4649804275009218 - 0.08258424547294756 * 0.08258424547294756), 0.0003870969564418064, OhPointGen::points_48},
+            {0.5124695757009662, 0.1251841962027289, constexpr_sqrt(1.0 - 0.5124695757009662 * 0.5124695757009662 - 0.1251841962027289 * 0.1251841962027289), 0.0003955287790534055, OhPointGen::points_48},
+            {0.5574711100606224, 0.1679107505976331, constexpr_sqrt(1.0 - 0.5574711100606224 * 0.5574711100606224 - 0.1679107505976331 * 0.1679107505976331), 0.0004015361911302668, OhPointGen::points_48},
+            {0.5998597333287227, 0.2102805057358715, constexpr_sqrt(1.0 - 0.5998597333287227 * 0.5998597333287227 - 0.2102805057358715 * 0.2102805057358715), 0.0004053836986719548, OhPointGen::points_48},
+            {0.63950071485166, 0.2518418087774107, constexpr_sqrt(1.0 - 0.63950071485166 * 0.63950071485166 - 0.2518418087774107 * 0.2518418087774107), 0.0004073578673299117, OhPointGen::points_48},
+            {0.5188456224746252, 0.04194321676077518, constexpr_sqrt(1.0 - 0.5188456224746252 * 0.5188456224746252 - 0.04194321676077518 * 0.04194321676077518), 0.0003954628379231406, OhPointGen::points_48},
+            {0.5664190707942778, 0.08457661551921498, constexpr_sqrt(1.0 - 0.5664190707942778 * 0.5664190707942778 - 0.08457661551921498 * 0.08457661551921498), 0.000401764550884753, OhPointGen::points_48},
+            {0.6110464353283153, 0.1273652932519396, constexpr_sqrt(1.0 - 0.6110464353283153 * 0.6110464353283153 - 0.1273652932519396 * 0.1273652932519396), 0.0004059030348651293, OhPointGen::points_48},
+            {0.6526430302051563, 0.1698173239076354, constexpr_sqrt(1.0 - 0.6526430302051563 * 0.6526430302051563 - 0.1698173239076354 * 0.1698173239076354), 0.000408056580948488, OhPointGen::points_48},
+            {0.6167551880377548, 0.04266398851548864, constexpr_sqrt(1.0 - 0.6167551880377548 * 0.6167551880377548 - 0.04266398851548864 * 0.04266398851548864), 0.0004063018753664651, OhPointGen::points_48},
+            {0.6607195418355383, 0.0855192581423835, constexpr_sqrt(1.0 - 0.6607195418355383 * 0.6607195418355383 - 0.0855192581423835 * 0.0855192581423835), 0.0004087191292799671, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef GENERATOR_TABLE_ORDER_302_HPP
+#define GENERATOR_TABLE_ORDER_302_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_302>
+{
+    static constexpr std::array<GeneratorPoint, 12> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.0008545911725128148, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.003599119285025571, OhPointGen::points_8},
+            {0.3515640345570105, constexpr_sqrt(1.0 - 2.0 * 0.3515640345570105 * 0.3515640345570105), 0.0, 0.003449788424305883, OhPointGen::points_24},
+            {0.6566329410219612, constexpr_sqrt(1.0 - 2.0 * 0.6566329410219612 * 0.6566329410219612), 0.0, 0.003604822601419882, OhPointGen::points_24},
+            {0.4729054132581005, constexpr_sqrt(1.0 - 2.0 * 0.4729054132581005 * 0.4729054132581005), 0.0, 0.003576729661743367, OhPointGen::points_24},
+            {0.09618308522614784, constexpr_sqrt(1.0 - 2.0 * 0.09618308522614784 * 0.09618308522614784), 0.0, 0.002352101413689164, OhPointGen::points_24},
+            {0.2219645236294178, constexpr_sqrt(1.0 - 2.0 * 0.2219645236294178 * 0.2219645236294178), 0.0, 0.003108953122413675, OhPointGen::points_24},
+            {0.7011766416089545, constexpr_sqrt(1.0 - 2.0 * 0.7011766416089545 * 0.7011766416089545), 0.0, 0.003650045807677255, OhPointGen::points_24},
+            {0.2644152887060663, constexpr_sqrt(1.0 - 0.2644152887060663 * 0.2644152887060663), 0.0, 0.002982344963171804, OhPointGen::points_24_axis},
+            {0.5718955891878961, constexpr_sqrt(1.0 - 0.5718955891878961 * 0.5718955891878961), 0.0, 0.00360082093221646, OhPointGen::points_24_axis},
+            {0.2510034751770465, 0.8000727494073951, constexpr_sqrt(1.0 - 0.2510034751770465 * 0.2510034751770465 - 0.8000727494073951 * 0.8000727494073951), 0.003571540554273387, OhPointGen::points_48},
+            {0.1233548532583327, 0.4127724083168531, constexpr_sqrt(1.0 - 0.1233548532583327 * 0.1233548532583327 - 0.4127724083168531 * 0.4127724083168531), 0.00339231220500617, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
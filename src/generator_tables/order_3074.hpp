@@ -0,0 +1,106 @@
+#ifndef GENERATOR_TABLE_ORDER_3074_HPP
+#define GENERATOR_TABLE_ORDER_3074_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_3074>
+{
+    static constexpr std::array<GeneratorPoint, 81> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 2.599095953754734e-05, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.0003603134089687541, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.0003586067974412447, OhPointGen::points_8},
+            {0.01886108518723392, constexpr_sqrt(1.0 - 2.0 * 0.01886108518723392 * 0.01886108518723392), 0.0, 9.83152847438588e-05, OhPointGen::points_24},
+            {0.04800217244625303, constexpr_sqrt(1.0 - 2.0 * 0.04800217244625303 * 0.04800217244625303), 0.0, 0.000160502310795445, OhPointGen::points_24},
+            {0.08244922058397242, constexpr_sqrt(1.0 - 2.0 * 0.08244922058397242 * 0.08244922058397242), 0.0, 0.0002072200131464099, OhPointGen::points_24},
+            {0.1200408362484023, constexpr_sqrt(1.0 - 2.0 * 0.1200408362484023 * 0.1200408362484023), 0.0, 0.0002431297618814187, OhPointGen::points_24},
+            {0.1595773530809965, constexpr_sqrt(1.0 - 2.0 * 0.1595773530809965 * 0.1595773530809965), 0.0, 0.0002711819064496707, OhPointGen::points_24},
+            {0.2002635973434064, constexpr_sqrt(1.0 - 2.0 * 0.2002635973434064 * 0.2002635973434064), 0.0, 0.0002932762038321116, OhPointGen::points_24},
+            {0.2415127590139982, constexpr_sqrt(1.0 - 2.0 * 0.2415127590139982 * 0.2415127590139982), 0.0, 0.0003107032514197368, OhPointGen::points_24},
+            {0.2828584158458477, constexpr_sqrt(1.0 - 2.0 * 0.2828584158458477 * 0.2828584158458477), 0.0, 0.0003243808058921213, OhPointGen::points_24},
+            {0.3239091015338138, constexpr_sqrt(1.0 - 2.0 * 0.3239091015338138 * 0.3239091015338138), 0.0, 0.000334989909137403, OhPointGen::points_24},
+            {0.3643225097962194, constexpr_sqrt(1.0 - 2.0 * 0.3643225097962194 * 0.3643225097962194), 0.0, 0.0003430580688505218, OhPointGen::points_24},
+            {0.4037897083691802, constexpr_sqrt(1.0 - 2.0 * 0.4037897083691802 * 0.4037897083691802), 0.0, 0.0003490124109290343, OhPointGen::points_24},
+            {0.4420247515194127, constexpr_sqrt(1.0 - 2.0 * 0.4420247515194127 * 0.4420247515194127), 0.0, 0.0003532148948561955, OhPointGen::points_24},
+            {0.4787572538464938, constexpr_sqrt(1.0 - 2.0 * 0.4787572538464938 * 0.4787572538464938), 0.0, 0.0003559862669062833, OhPointGen::points_24},
+            {0.5137265251275234, constexpr_sqrt(1.0 - 2.0 * 0.5137265251275234 * 0.5137265251275234), 0.0, 0.0003576224317551411, OhPointGen::points_24},
+            {0.546676405665461, constexpr_sqrt(1.0 - 2.0 * 0.546676405665461 * 0.546676405665461), 0.0, 0.0003584050533086076, OhPointGen::points_24},
+            {0.6054859420813535, constexpr_sqrt(1.0 - 2.0 * 0.6054859420813535 * 0.6054859420813535), 0.0, 0.0003584903581373224, OhPointGen::points_24},
+            {0.6308106701764562, constexpr_sqrt(1.0 - 2.0 * 0.6308106701764562 * 0.6308106701764562), 0.0, 0.0003582991879040586, OhPointGen::points_24},
+            {0.6530369230179583, constexpr_sqrt(1.0 - 2.0 * 0.6530369230179583 * 0.6530369230179583), 0.0, 0.0003582371187963125, OhPointGen::points_24},
+            {0.6718609524611158, constexpr_sqrt(1.0 - 2.0 * 0.6718609524611158 * 0.6718609524611158), 0.0, 0.000358435363112235, OhPointGen::points_24},
+            {0.6869676499894013, constexpr_sqrt(1.0 - 2.0 * 0.6869676499894013 * 0.6869676499894013), 0.0, 0.0003589120166517785, OhPointGen::points_24},
+            {0.6980467077240748, constexpr_sqrt(1.0 - 2.0 * 0.6980467077240748 * 0.6980467077240748), 0.0, 0.0003595445704531601, OhPointGen::points_24},
+            {0.7048241721250522, constexpr_sqrt(1.0 - 2.0 * 0.7048241721250522 * 0.7048241721250522), 0.0, 0.0003600943557111074, OhPointGen::points_24},
+            {0.05591105222058232, constexpr_sqrt(1.0 - 0.05591105222058232 * 0.05591105222058232), 0.0, 0.0001456447096742039, OhPointGen::points_24_axis},
+            {0.1407384078513916, constexpr_sqrt(1.0 - 0.1407384078513916 * 0.1407384078513916), 0.0, 0.0002252370188283782, OhPointGen::points_24_axis},
+            {0.2364035438976309, constexpr_sqrt(1.0 - 0.2364035438976309 * 0.2364035438976309), 0.0, 0.0002766135443474897, OhPointGen::points_24_axis},
+            {0.336060273781817, constexpr_sqrt(1.0 - 0.336060273781817 * 0.336060273781817), 0.0, 0.0003110729491500851, OhPointGen::points_24_axis},
+            {0.4356292630054665, constexpr_sqrt(1.0 - 0.4356292630054665 * 0.4356292630054665), 0.0, 0.0003342506712303391, OhPointGen::points_24_axis},
+            {0.5321569415256174, constexpr_sqrt(1.0 - 0.5321569415256174 * 0.5321569415256174), 0.0, 0.000349198183402686, OhPointGen::points_24_axis},
+            {0.6232956305040555, constexpr_sqrt(1.0 - 0.6232956305040555 * 0.6232956305040555), 0.0, 0.0003576003604348932, OhPointGen::points_24_axis},
+            {0.09469870086838468, 0.0277874838730947, constexpr_sqrt(1.0 - 0.09469870086838468 * 0.09469870086838468 - 0.0277874838730947 * 0.0277874838730947), 0.0001921921305788564, OhPointGen::points_48},
+            {0.1353170300568141, 0.06076569878628364, constexpr_sqrt(1.0 - 0.1353170300568141 * 0.1353170300568141 - 0.06076569878628364 * 0.06076569878628364), 0.0002301458216495632, OhPointGen::points_48},
+            {0.1771679481726077, 0.0970307276271104, constexpr_sqrt(1.0 - 0.1771679481726077 * 0.1771679481726077 - 0.0970307276271104 * 0.0970307276271104), 0.0002604248549522893, OhPointGen::points_48},
+            {0.2197066664231751, 0.1354112458524762, constexpr_sqrt(1.0 - 0.2197066664231751 * 0.2197066664231751 - 0.1354112458524762 * 0.1354112458524762), 0.0002845275425870697, OhPointGen::points_48},
+            {0.2624783557374927, 0.17509964797441, constexpr_sqrt(1.0 - 0.2624783557374927 * 0.2624783557374927 - 0.17509964797441 * 0.17509964797441), 0.000303687089797484, OhPointGen::points_48},
+            {0.3050969521214442, 0.2154896907449802, constexpr_sqrt(1.0 - 0.3050969521214442 * 0.3050969521214442 - 0.2154896907449802 * 0.2154896907449802), 0.0003188414832298066, OhPointGen::points_48},
+            {0.3472252637196021, 0.2560954625740152, constexpr_sqrt(1.0 - 0.3472252637196021 * 0.3472252637196021 - 0.2560954625740152 * 0.2560954625740152), 0.0003307046414722089, OhPointGen::points_48},
+            {0.388561021902636, 0.2965070050624096, constexpr_sqrt(1.0 - 0.388561021902636 * 0.388561021902636 - 0.2965070050624096 * 0.2965070050624096), 0.000339833096903136, OhPointGen::points_48},
+            {0.4288273776062765, 0.3363641488734497, constexpr_sqrt(1.0 - 0.4288273776062765 * 0.4288273776062765 - 0.3363641488734497 * 0.3363641488734497), 0.0003466757899705373, OhPointGen::points_48},
+            {0.4677662471302948, 0.3753400029836788, constexpr_sqrt(1.0 - 0.4677662471302948 * 0.4677662471302948 - 0.3753400029836788 * 0.3753400029836788), 0.0003516095923230054, OhPointGen::points_48},
+            {0.505133358955336, 0.4131297522144286, constexpr_sqrt(1.0 - 0.505133358955336 * 0.505133358955336 - 0.4131297522144286 * 0.4131297522144286), 0.0003549645184048486, OhPointGen::points_48},
+            {0.5406942145810492, 0.4494423776081795, constexpr_sqrt(1.0 - 0.5406942145810492 * 0.5406942145810492 - 0.4494423776081795 * 0.4494423776081795), 0.0003570415969441392, OhPointGen::points_48},
+            {0.5742204122576458, 0.4839938958841502, constexpr_sqrt(1.0 - 0.5742204122576458 * 0.5742204122576458 - 0.4839938958841502 * 0.4839938958841502), 0.0003581251798496118, OhPointGen::points_48},
+            {0.1865407027225188, 0.03259144851070796, constexpr_sqrt(1.0 - 0.1865407027225188 * 0.1865407027225188 - 0.03259144851070796 * 0.03259144851070796), 0.0002543491329913348, OhPointGen::points_48},
+            {0.2321186453689432, 0.06835679505297343, constexpr_sqrt(1.0 - 0.2321186453689432 * 0.2321186453689432 - 0.06835679505297343 * 0.06835679505297343), 0.0002786711051330776, OhPointGen::points_48},
+            {0.2773159142523882, 0.1062284864451989, constexpr_sqrt(1.0 - 0.2773159142523882 * 0.2773159142523882 - 0.1062284864451989 * 0.1062284864451989), 0.0002985552361083679, OhPointGen::points_48},
+            {0.3219200192237254, 0.1454404409323047, constexpr_sqrt(1.0 - 0.3219200192237254 * 0.3219200192237254 - 0.1454404409323047 * 0.1454404409323047), 0.0003145867929154039, OhPointGen::points_48},
+            {0.3657032593944029, 0.185401828258251, constexpr_sqrt(1.0 - 0.3657032593944029 * 0.3657032593944029 - 0.185401828258251 * 0.185401828258251), 0.0003273290662067609, OhPointGen::points_48},
+            {0.4084376778363622, 0.225629741201475, constexpr_sqrt(1.0 - 0.4084376778363622 * 0.4084376778363622 - 0.225629741201475 * 0.225629741201475), 0.0003372705511943501, OhPointGen::points_48},
+            {0.4499004945751427, 0.2657104425000896, constexpr_sqrt(1.0 - 0.4499004945751427 * 0.4499004945751427 - 0.2657104425000896 * 0.2657104425000896), 0.000344827443785151, OhPointGen::points_48},
+            {0.4898758141326335, 0.3052755487631557, constexpr_sqrt(1.0 - 0.4898758141326335 * 0.4898758141326335 - 0.3052755487631557 * 0.3052755487631557), 0.0003503592783048583, OhPointGen::points_48},
+            {0.5281547442266309, 0.3439863920645423, constexpr_sqrt(1.0 - 0.5281547442266309 * 0.5281547442266309 - 0.3439863920645423 * 0.3439863920645423), 0.0003541854792663162, OhPointGen::points_48},
+            {0.5645346989813992, 0.3815229456121914, constexpr_sqrt(1.0 - 0.5645346989813992 * 0.5645346989813992 - 0.3815229456121914 * 0.3815229456121914), 0.0003565995517909428, OhPointGen::points_48},
+            {0.5988181252159848, 0.4175752420966734, constexpr_sqrt(1.0 - 0.5988181252159848 * 0.5988181252159848 - 0.4175752420966734 * 0.4175752420966734), 0.0003578802078302898, OhPointGen::points_48},
+            {0.2850425424471603, 0.03562149509862536, constexpr_sqrt(1.0 - 0.2850425424471603 * 0.2850425424471603 - 0.03562149509862536 * 0.03562149509862536), 0.0002958644592860982, OhPointGen::points_48},
+            {0.3324619433027876, 0.07330318886871096, constexpr_sqrt(1.0 - 0.3324619433027876 * 0.3324619433027876 - 0.07330318886871096 * 0.07330318886871096), 0.0003119548129116835, OhPointGen::points_48},
+            {0.3785848333076282, 0.1123226296008472, constexpr_sqrt(1.0 - 0.3785848333076282 * 0.3785848333076282 - 0.1123226296008472 * 0.1123226296008472), 0.0003250745225005984, OhPointGen::points_48},
+            {0.4232891028562115, 0.1521084193337708, constexpr_sqrt(1.0 - 0.4232891028562115 * 0.4232891028562115 - 0.1521084193337708 * 0.1521084193337708), 0.0003355153415935208, OhPointGen::points_48},
+            {0.4664287050829722, 0.192184445922361, constexpr_sqrt(1.0 - 0.4664287050829722 * 0.4664287050829722 - 0.192184445922361 * 0.192184445922361), 0.0003435847568549328, OhPointGen::points_48},
+            {0.5078458493735726, 0.2321360989678303, constexpr_sqrt(1.0 - 0.5078458493735726 * 0.5078458493735726 - 0.2321360989678303 * 0.2321360989678303), 0.0003495786831622488, OhPointGen::points_48},
+            {0.547377981620418, 0.271588648636052, constexpr_sqrt(1.0 - 0.547377981620418 * 0.547377981620418 - 0.271588648636052 * 0.271588648636052), 0.0003537767805534621, OhPointGen::points_48},
+            {0.5848617133811376, 0.3101924707571355, constexpr_sqrt(1.0 - 0.5848617133811376 * 0.5848617133811376 - 0.3101924707571355 * 0.3101924707571355), 0.0003564459815421428, OhPointGen::points_48},
+            {0.6201348281584887, 0.3476121052890973, constexpr_sqrt(1.0 - 0.6201348281584887 * 0.6201348281584887 - 0.3476121052890973 * 0.3476121052890973), 0.0003578464061225468, OhPointGen::points_48},
+            {0.3852191185387871, 0.03763224880035108, constexpr_sqrt(1.0 - 0.3852191185387871 * 0.3852191185387871 - 0.03763224880035108 * 0.03763224880035108), 0.0003239748762836212, OhPointGen::points_48},
+            {0.4325025061073423, 0.07659581935637134, constexpr_sqrt(1.0 - 0.4325025061073423 * 0.4325025061073423 - 0.07659581935637134 * 0.07659581935637134), 0.0003345491784174287, OhPointGen::points_48},
+            {0.477848622973449, 0.11633813060839, constexpr_sqrt(1.0 - 0.477848622973449 * 0.477848622973449 - 0.11633813060839 * 0.11633813060839), 0.0003429126177301782, OhPointGen::points_48},
+            {0.5211663693009, 0.1563890598752899, constexpr_sqrt(1.0 - 0.5211663693009 * 0.5211663693009 - 0.1563890598752899 * 0.1563890598752899), 0.0003492420343097421, OhPointGen::points_48},
+            {0.5623469504853703, 0.19633208101492, constexpr_sqrt(1.0 - 0.5623469504853703 * 0.5623469504853703 - 0.19633208101492 * 0.19633208101492), 0.0003537399050235257, OhPointGen::points_48},
+            {0.6012718188659246, 0.2357847407258738, constexpr_sqrt(1.0 - 0.6012718188659246 * 0.6012718188659246 - 0.2357847407258738 * 0.2357847407258738), 0.0003566209152659172, OhPointGen::points_48},
+            {0.6378179206390117, 0.274384612124406, constexpr_sqrt(1.0 - 0.6378179206390117 * 0.6378179206390117 - 0.274384612124406 * 0.274384612124406), 0.0003581084321919782, OhPointGen::points_48},
+            {0.4836936460214534, 0.03895902610739024, constexpr_sqrt(1.0 - 0.4836936460214534 * 0.4836936460214534 - 0.03895902610739024 * 0.03895902610739024), 0.0003426522117591512, OhPointGen::points_48},
+            {0.5293792562683797, 0.0787124681931264, constexpr_sqrt(1.0 - 0.5293792562683797 * 0.5293792562683797 - 0.0787124681931264 * 0.0787124681931264), 0.0003491848770121379, OhPointGen::points_48},
+            {0.5726281253100033, 0.1187963808202981, constexpr_sqrt(1.0 - 0.5726281253100033 * 0.5726281253100033 - 0.1187963808202981 * 0.1187963808202981), 0.0003539318235231476, OhPointGen::points_48},
+            {0.6133658776169068, 0.1587914708061787, constexpr_sqrt(1.0 - 0.6133658776169068 * 0.6133658776169068 - 0.1587914708061787 * 0.1587914708061787), 0.0003570231438458694, OhPointGen::points_48},
+            {0.6515085491865307, 0.1983058575227646, constexpr_sqrt(1.0 - 0.6515085491865307 * 0.6515085491865307 - 0.1983058575227646 * 0.1983058575227646), 0.0003586207335051714, OhPointGen::points_48},
+            {0.5778692716064976, 0.03977209689791542, constexpr_sqrt(1.0 - 0.5778692716064976 * 0.5778692716064976 - 0.03977209689791542 * 0.03977209689791542), 0.0003541196205164025, OhPointGen::points_48},
+            {0.6207904288086192, 0.07990157592981152, constexpr_sqrt(1.0 - 0.6207904288086192 * 0.6207904288086192 - 0.07990157592981152 * 0.07990157592981152), 0.0003574296911573953, OhPointGen::points_48},
+            {0.6608688171046802, 0.1199671308754309, constexpr_sqrt(1.0 - 0.6608688171046802 * 0.6608688171046802 - 0.1199671308754309 * 0.1199671308754309), 0.0003591993279818963, OhPointGen::points_48},
+            {0.665626308948913, 0.04015955957805969, constexpr_sqrt(1.0 - 0.665626308948913 * 0.665626308948913 - 0.04015955957805969 * 0.04015955957805969), 0.0003595855034661997, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef GENERATOR_TABLE_ORDER_3470_HPP
+#define GENERATOR_TABLE_ORDER_3470_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_3470>
+{
+    static constexpr std::array<GeneratorPoint, 90> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 2.04038273082633e-05, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.0003178149703889544, OhPointGen::points_8},
+            {0.01721420832906233, constexpr_sqrt(1.0 - 2.0 * 0.01721420832906233 * 0.01721420832906233), 0.0, 8.28811512807611e-05, OhPointGen::points_24},
+            {0.0440887537498177, constexpr_sqrt(1.0 - 2.0 * 0.0440887537498177 * 0.0440887537498177), 0.0, 0.0001360883192522954, OhPointGen::points_24},
+            {0.0759468081387868, constexpr_sqrt(1.0 - 2.0 * 0.0759468081387868 * 0.0759468081387868), 0.0, 0.0001766854454542662, OhPointGen::points_24},
+            {0.1108335359204799, constexpr_sqrt(1.0 - 2.0 * 0.1108335359204799 * 0.1108335359204799), 0.0, 0.0002083153161230153, OhPointGen::points_24},
+            {0.1476517054388567, constexpr_sqrt(1.0 - 2.0 * 0.1476517054388567 * 0.1476517054388567), 0.0, 0.0002333279544657158, OhPointGen::points_24},
+            {0.1856731870860615, constexpr_sqrt(1.0 - 2.0 * 0.1856731870860615 * 0.1856731870860615), 0.0, 0.0002532809539930247, OhPointGen::points_24},
+            {0.2243634099428821, constexpr_sqrt(1.0 - 2.0 * 0.2243634099428821 * 0.2243634099428821), 0.0, 0.0002692472184211158, OhPointGen::points_24},
+            {0.2633006881662727, constexpr_sqrt(1.0 - 2.0 * 0.2633006881662727 * 0.2633006881662727), 0.0, 0.0002819949946811885, OhPointGen::points_24},
+            {0.3021340904916283, constexpr_sqrt(1.0 - 2.0 * 0.3021340904916283 * 0.3021340904916283), 0.0, 0.000292095359397303, OhPointGen::points_24},
+            {0.3405594048030089, constexpr_sqrt(1.0 - 2.0 * 0.3405594048030089 * 0.3405594048030089), 0.0, 0.0002999889782948352, OhPointGen::points_24},
+            {0.3783044434007372, constexpr_sqrt(1.0 - 2.0 * 0.3783044434007372 * 0.3783044434007372), 0.0, 0.0003060292120496902, OhPointGen::points_24},
+            {0.415119476740791, constexpr_sqrt(1.0 - 2.0 * 0.415119476740791 * 0.415119476740791), 0.0, 0.0003105109167522192, OhPointGen::points_24},
+            {0.4507705766443257, constexpr_sqrt(1.0 - 2.0 * 0.4507705766443257 * 0.4507705766443257), 0.0, 0.0003136902387550312, OhPointGen::points_24},
+            {0.4850346056573187, constexpr_sqrt(1.0 - 2.0 * 0.4850346056573187 * 0.4850346056573187), 0.0, 0.0003157984652454632, OhPointGen::points_24},
+            {0.517695081779247, constexpr_sqrt(1.0 - 2.0 * 0.517695081779247 * 0.517695081779247), 0.0, 0.0003170516518425422, OhPointGen::points_24},
+            {0.5485384240820989, constexpr_sqrt(1.0 - 2.0 * 0.5485384240820989 * 0.5485384240820989), 0.0, 0.0003176568425633755, OhPointGen::points_24},
+            {0.6039117238943308, constexpr_sqrt(1.0 - 2.0 * 0.6039117238943308 * 0.6039117238943308), 0.0, 0.0003177198411207062, OhPointGen::points_24},
+            {0.6279956655573113, constexpr_sqrt(1.0 - 2.0 * 0.6279956655573113 * 0.6279956655573113), 0.0, 0.0003175519492394733, OhPointGen::points_24},
+            {0.6493636169568952, constexpr_sqrt(1.0 - 2.0 * 0.6493636169568952 * 0.6493636169568952), 0.0, 0.0003174654952634756, OhPointGen::points_24},
+            {0.6677644117704504, constexpr_sqrt(1.0 - 2.0 * 0.6677644117704504 * 0.6677644117704504), 0.0, 0.0003175676415467654, OhPointGen::points_24},
+            {0.6829368572115624, constexpr_sqrt(1.0 - 2.0 * 0.6829368572115624 * 0.6829368572115624), 0.0, 0.000317892341783541, OhPointGen::points_24},
+            {0.6946195818184121, constexpr_sqrt(1.0 - 2.0 * 0.6946195818184121 * 0.6946195818184121), 0.0, 0.0003183788287531909, OhPointGen::points_24},
+            {0.7025711542057026, constexpr_sqrt(1.0 - 2.0 * 0.7025711542057026 * 0.7025711542057026), 0.0, 0.0003188755151918807, OhPointGen::points_24},
+            {0.7066004767140119, constexpr_sqrt(1.0 - 2.0 * 0.7066004767140119 * 0.7066004767140119), 0.0, 0.0003191916889313849, OhPointGen::points_24},
+            {0.05132537689946062, constexpr_sqrt(1.0 - 0.05132537689946062 * 0.05132537689946062), 0.0, 0.0001231779611744508, OhPointGen::points_24_axis},
+            {0.1297994661331225, constexpr_sqrt(1.0 - 0.1297994661331225 * 0.1297994661331225), 0.0, 0.000192466137383988, OhPointGen::points_24_axis},
+            {0.2188852049401307, constexpr_sqrt(1.0 - 0.2188852049401307 * 0.2188852049401307), 0.0, 0.0002380881867403424, OhPointGen::points_24_axis},
+            {0.3123174824903457, constexpr_sqrt(1.0 - 0.3123174824903457 * 0.3123174824903457), 0.0, 0.0002693100663037885, OhPointGen::points_24_axis},
+            {0.4064037620738195, constexpr_sqrt(1.0 - 0.4064037620738195 * 0.4064037620738195), 0.0, 0.0002908673382834366, OhPointGen::points_24_axis},
+            {0.4984958396944782, constexpr_sqrt(1.0 - 0.4984958396944782 * 0.4984958396944782), 0.0, 0.0003053914619381535, OhPointGen::points_24_axis},
+            {0.5864975046021365, constexpr_sqrt(1.0 - 0.5864975046021365 * 0.5864975046021365), 0.0, 0.0003143916684147777, OhPointGen::points_24_axis},
+            {0.6686711634580175, constexpr_sqrt(1.0 - 0.6686711634580175 * 0.6686711634580175), 0.0, 0.0003187042244055363, OhPointGen::points_24_axis},
+            {0.0871573878083595, 0.02557175233367578, constexpr_sqrt(1.0 - 0.0871573878083595 * 0.0871573878083595 - 0.02557175233367578 * 0.02557175233367578), 0.000163521953586979, OhPointGen::points_48},
+            {0.1248383123134007, 0.05604823383376681, constexpr_sqrt(1.0 - 0.1248383123134007 * 0.1248383123134007 - 0.05604823383376681 * 0.05604823383376681), 0.000196810991769607, OhPointGen::points_48},
+            {0.1638062693383378, 0.08968568601900764, constexpr_sqrt(1.0 - 0.1638062693383378 * 0.1638062693383378 - 0.08968568601900764 * 0.08968568601900764), 0.0002236754342249974, OhPointGen::points_48},
+            {0.2035586203373176, 0.1254086651976279, constexpr_sqrt(1.0 - 0.2035586203373176 * 0.2035586203373176 - 0.1254086651976279 * 0.1254086651976279), 0.0002453186687017181, OhPointGen::points_48},
+            {0.2436798975293774, 0.1624780150162012, constexpr_sqrt(1.0 - 0.2436798975293774 * 0.2436798975293774 - 0.1624780150162012 * 0.1624780150162012), 0.0002627551791580541, OhPointGen::points_48},
+            {0.2838207507773806, 0.2003422342683208, constexpr_sqrt(1.0 - 0.2838207507773806 * 0.2838207507773806 - 0.2003422342683208 * 0.2003422342683208), 0.000276765486015222, OhPointGen::points_48},
+            {0.3236787502217692, 0.2385628026255263, constexpr_sqrt(1.0 - 0.3236787502217692 * 0.3236787502217692 - 0.2385628026255263 * 0.2385628026255263), 0.0002879467027765895, OhPointGen::points_48},
+            {0.3629849554840691, 0.2767731148783578, constexpr_sqrt(1.0 - 0.3629849554840691 * 0.3629849554840691 - 0.2767731148783578 * 0.2767731148783578), 0.0002967639918918702, OhPointGen::points_48},
+            {0.4014948081992087, 0.3146542308245309, constexpr_sqrt(1.0 - 0.4014948081992087 * 0.4014948081992087 - 0.3146542308245309 * 0.3146542308245309), 0.0003035900684660351, OhPointGen::points_48},
+            {0.4389818379260225, 0.3519196415895088, constexpr_sqrt(1.0 - 0.4389818379260225 * 0.4389818379260225 - 0.3519196415895088 * 0.3519196415895088), 0.0003087338237298308, OhPointGen::points_48},
+            {0.4752331143674377, 0.3883050984023654, constexpr_sqrt(1.0 - 0.4752331143674377 * 0.4752331143674377 - 0.3883050984023654 * 0.3883050984023654), 0.0003124608838860167, OhPointGen::points_48},
+            {0.5100457318374018, 0.4235613423908649, constexpr_sqrt(1.0 - 0.5100457318374018 * 0.5100457318374018 - 0.4235613423908649 * 0.4235613423908649), 0.0003150084294226743, OhPointGen::points_48},
+            {0.5432238388954868, 0.457448471719622, constexpr_sqrt(1.0 - 0.5432238388954868 * 0.5432238388954868 - 0.457448471719622 * 0.457448471719622), 0.0003165958398598402, OhPointGen::points_48},
+            {0.5745758685072442, 0.4897311639255524, constexpr_sqrt(1.0 - 0.5745758685072442 * 0.5745758685072442 - 0.4897311639255524 * 0.4897311639255524), 0.0003174320440957372, OhPointGen::points_48},
+            {0.1723981437592809, 0.03010630597881105, constexpr_sqrt(1.0 - 0.1723981437592809 * 0.1723981437592809 - 0.03010630597881105 * 0.03010630597881105), 0.0002182188909812599, OhPointGen::points_48},
+            {0.2149553257844597, 0.06326031554204695, constexpr_sqrt(1.0 - 0.2149553257844597 * 0.2149553257844597 - 0.06326031554204695 * 0.06326031554204695), 0.0002399727933921445, OhPointGen::points_48},
+            {0.2573256081247422, 0.09848566980258631, constexpr_sqrt(1.0 - 0.2573256081247422 * 0.2573256081247422 - 0.09848566980258631 * 0.09848566980258631), 0.0002579796133514652, OhPointGen::points_48},
+            {0.2993163751238106, 0.1350835952384266, constexpr_sqrt(1.0 - 0.2993163751238106 * 0.2993163751238106 - 0.1350835952384266 * 0.1350835952384266), 0.0002727114052623535, OhPointGen::points_48},
+            {0.3407238005148, 0.1725184055442181, constexpr_sqrt(1.0 - 0.3407238005148 * 0.3407238005148 - 0.1725184055442181 * 0.1725184055442181), 0.0002846327656281355, OhPointGen::points_48},
+            {0.3813454978483264, 0.2103559279730725, constexpr_sqrt(1.0 - 0.3813454978483264 * 0.3813454978483264 - 0.2103559279730725 * 0.2103559279730725), 0.0002941491102051334, OhPointGen::points_48},
+            {0.4209848104423343, 0.248227877455486, constexpr_sqrt(1.0 - 0.4209848104423343 * 0.4209848104423343 - 0.248227877455486 * 0.248227877455486), 0.0003016049492136107, OhPointGen::points_48},
+            {0.45945196999963, 0.2858099509982883, constexpr_sqrt(1.0 - 0.45945196999963 * 0.45945196999963 - 0.2858099509982883 * 0.2858099509982883), 0.0003072949726175648, OhPointGen::points_48},
+            {0.496564016618593, 0.3228075659915428, constexpr_sqrt(1.0 - 0.496564016618593 * 0.496564016618593 - 0.3228075659915428 * 0.3228075659915428), 0.000311476814288646, OhPointGen::points_48},
+            {0.5321441655571562, 0.3589459907204151, constexpr_sqrt(1.0 - 0.5321441655571562 * 0.5321441655571562 - 0.3589459907204151 * 0.3589459907204151), 0.0003143823673666223, OhPointGen::points_48},
+            {0.5660208438582166, 0.393963008886431, constexpr_sqrt(1.0 - 0.5660208438582166 * 0.5660208438582166 - 0.393963008886431 * 0.393963008886431), 0.0003162269764661535, OhPointGen::points_48},
+            {0.5980264315964364, 0.4276029922949089, constexpr_sqrt(1.0 - 0.5980264315964364 * 0.5980264315964364 - 0.4276029922949089 * 0.4276029922949089), 0.0003172164663759821, OhPointGen::points_48},
+            {0.2644215852350733, 0.03300939429072552, constexpr_sqrt(1.0 - 0.2644215852350733 * 0.2644215852350733 - 0.03300939429072552 * 0.03300939429072552), 0.0002554575398967435, OhPointGen::points_48},
+            {0.3090113743443063, 0.06803887650078501, constexpr_sqrt(1.0 - 0.3090113743443063 * 0.3090113743443063 - 0.06803887650078501 * 0.06803887650078501), 0.0002701704069135677, OhPointGen::points_48},
+            {0.3525871079197808, 0.1044326136206709, constexpr_sqrt(1.0 - 0.3525871079197808 * 0.3525871079197808 - 0.1044326136206709 * 0.1044326136206709), 0.000282369341346894, OhPointGen::points_48},
+            {0.3950418005354029, 0.1416751597517679, constexpr_sqrt(1.0 - 0.3950418005354029 * 0.3950418005354029 - 0.1416751597517679 * 0.1416751597517679), 0.0002922898463214289, OhPointGen::points_48},
+            {0.4362475663430163, 0.1793408610504821, constexpr_sqrt(1.0 - 0.4362475663430163 * 0.4362475663430163 - 0.1793408610504821 * 0.1793408610504821), 0.0003001829062162428, OhPointGen::points_48},
+            {0.4760661812145854, 0.2170630750175722, constexpr_sqrt(1.0 - 0.4760661812145854 * 0.4760661812145854 - 0.2170630750175722 * 0.2170630750175722), 0.0003062890864542953, OhPointGen::points_48},
+            {0.5143551042512103, 0.2545145157815807, constexpr_sqrt(1.0 - 0.5143551042512103 * 0.5143551042512103 - 0.2545145157815807 * 0.2545145157815807), 0.0003108328279264746, OhPointGen::points_48},
+            {0.5509709026935597, 0.2913940101706601, constexpr_sqrt(1.0 - 0.5509709026935597 * 0.5509709026935597 - 0.2913940101706601 * 0.2913940101706601), 0.0003140243146201245, OhPointGen::points_48},
+            {0.5857711030329428, 0.3274169910910705, constexpr_sqrt(1.0 - 0.5857711030329428 * 0.5857711030329428 - 0.3274169910910705 * 0.3274169910910705), 0.000316063803097713, OhPointGen::points_48},
+            {0.6186149917404392, 0.3623081329317265, constexpr_sqrt(1.0 - 0.6186149917404392 * 0.6186149917404392 - 0.3623081329317265 * 0.3623081329317265), 0.0003171462882206275, OhPointGen::points_48},
+            {0.3586894569557064, 0.0349735438645004, constexpr_sqrt(1.0 - 0.3586894569557064 * 0.3586894569557064 - 0.0349735438645004 * 0.0349735438645004), 0.0002812388416031796, OhPointGen::points_48},
+            {0.4035266610019441, 0.07129736739757095, constexpr_sqrt(1.0 - 0.4035266610019441 * 0.4035266610019441 - 0.07129736739757095 * 0.07129736739757095), 0.0002912137500288045, OhPointGen::points_48},
+            {0.446777531233251, 0.1084758620193165, constexpr_sqrt(1.0 - 0.446777531233251 * 0.446777531233251 - 0.1084758620193165 * 0.1084758620193165), 0.0002993241256502206, OhPointGen::points_48},
+            {0.4883638346608543, 0.1460915689241772, constexpr_sqrt(1.0 - 0.4883638346608543 * 0.4883638346608543 - 0.1460915689241772 * 0.1460915689241772), 0.0003057101738983822, OhPointGen::points_48},
+            {0.5281908348434601, 0.183779083236998, constexpr_sqrt(1.0 - 0.5281908348434601 * 0.5281908348434601 - 0.183779083236998 * 0.183779083236998), 0.0003105319326251432, OhPointGen::points_48},
+            {0.5661542687149311, 0.2212075390874021, constexpr_sqrt(1.0 - 0.5661542687149311 * 0.5661542687149311 - 0.2212075390874021 * 0.2212075390874021), 0.0003139565514428167, OhPointGen::points_48},
+            {0.6021450102031451, 0.2580682841160985, constexpr_sqrt(1.0 - 0.6021450102031451 * 0.6021450102031451 - 0.2580682841160985 * 0.2580682841160985), 0.0003161543006806366, OhPointGen::points_48},
+            {0.636052078361005, 0.2940656362094121, constexpr_sqrt(1.0 - 0.636052078361005 * 0.636052078361005 - 0.2940656362094121 * 0.2940656362094121), 0.0003172985960613294, OhPointGen::points_48},
+            {0.4521611065087196, 0.03631055365867002, constexpr_sqrt(1.0 - 0.4521611065087196 * 0.4521611065087196 - 0.03631055365867002 * 0.03631055365867002), 0.0002989400336901431, OhPointGen::points_48},
+            {0.4959365651560963, 0.0734831846848435, constexpr_sqrt(1.0 - 0.4959365651560963 * 0.4959365651560963 - 0.0734831846848435 * 0.0734831846848435), 0.0003054555883947677, OhPointGen::points_48},
+            {0.5376815804038283, 0.1111087643812648, constexpr_sqrt(1.0 - 0.5376815804038283 * 0.5376815804038283 - 0.1111087643812648 * 0.1111087643812648), 0.0003104764960807702, OhPointGen::points_48},
+            {0.5773314480243767, 0.1488226085145408, constexpr_sqrt(1.0 - 0.5773314480243767 * 0.5773314480243767 - 0.1488226085145408 * 0.1488226085145408), 0.0003141015825977616, OhPointGen::points_48},
+            {0.6148113245575056, 0.1862892274135151, constexpr_sqrt(1.0 - 0.6148113245575056 * 0.6148113245575056 - 0.1862892274135151 * 0.1862892274135151), 0.0003164520621159896, OhPointGen::points_48},
+            {0.650040746284238, 0.2231909701714456, constexpr_sqrt(1.0 - 0.650040746284238 * 0.650040746284238 - 0.2231909701714456 * 0.2231909701714456), 0.0003176652305912204, OhPointGen::points_48},
+            {0.5425151448707213, 0.03718201306118944, constexpr_sqrt(1.0 - 0.5425151448707213 * 0.5425151448707213 - 0.03718201306118944 * 0.03718201306118944), 0.0003105097161023939, OhPointGen::points_48},
+            {0.5841860556907931, 0.07483616335067346, constexpr_sqrt(1.0 - 0.5841860556907931 * 0.5841860556907931 - 0.07483616335067346 * 0.07483616335067346), 0.000314301411789055, OhPointGen::points_48},
+            {0.62346321868515, 0.112599083426612, constexpr_sqrt(1.0 - 0.62346321868515 * 0.62346321868515 - 0.112599083426612 * 0.112599083426612), 0.00031681728662872, OhPointGen::points_48},
+            {0.6602934551848842, 0.1501303813157619, constexpr_sqrt(1.0 - 0.6602934551848842 * 0.6602934551848842 - 0.1501303813157619 * 0.1501303813157619), 0.0003181401865570968, OhPointGen::points_48},
+            {0.6278573968375105, 0.0376755993024572, constexpr_sqrt(1.0 - 0.6278573968375105 * 0.6278573968375105 - 0.0376755993024572 * 0.0376755993024572), 0.0003170663659156037, OhPointGen::points_48},
+            {0.6665611711264577, 0.07548443301360158, constexpr_sqrt(1.0 - 0.6665611711264577 * 0.6665611711264577 - 0.07548443301360158 * 0.07548443301360158), 0.000318544794462551, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
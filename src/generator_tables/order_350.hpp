@@ -0,0 +1,38 @@
+#ifndef GENERATOR_TABLE_ORDER_350_HPP
+#define GENERATOR_TABLE_ORDER_350_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_350>
+{
+    static constexpr std::array<GeneratorPoint, 13> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.003006796749453936, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.003050627745650771, OhPointGen::points_8},
+            {0.7068965463912316, constexpr_sqrt(1.0 - 2.0 * 0.7068965463912316 * 0.7068965463912316), 0.0, 0.001621104600288991, OhPointGen::points_24},
+            {0.4794682625712025, constexpr_sqrt(1.0 - 2.0 * 0.4794682625712025 * 0.4794682625712025), 0.0, 0.003005701484901752, OhPointGen::points_24},
+            {0.1927533154878019, constexpr_sqrt(1.0 - 2.0 * 0.1927533154878019 * 0.1927533154878019), 0.0, 0.002990992529653774, OhPointGen::points_24},
+            {0.6930357961327123, constexpr_sqrt(1.0 - 2.0 * 0.6930357961327123 * 0.6930357961327123), 0.0, 0.002982170644107595, OhPointGen::points_24},
+            {0.3608302115520091, constexpr_sqrt(1.0 - 2.0 * 0.3608302115520091 * 0.3608302115520091), 0.0, 0.002721564237310992, OhPointGen::points_24},
+            {0.6498486161496169, constexpr_sqrt(1.0 - 2.0 * 0.6498486161496169 * 0.6498486161496169), 0.0, 0.003033513795811141, OhPointGen::points_24},
+            {0.1932945013230339, constexpr_sqrt(1.0 - 0.1932945013230339 * 0.1932945013230339), 0.0, 0.003007949555218533, OhPointGen::points_24_axis},
+            {0.3800494919899303, constexpr_sqrt(1.0 - 0.3800494919899303 * 0.3800494919899303), 0.0, 0.002881964603055307, OhPointGen::points_24_axis},
+            {0.2899558825499574, 0.7934537856582315, constexpr_sqrt(1.0 - 0.2899558825499574 * 0.2899558825499574 - 0.7934537856582315 * 0.7934537856582315), 0.002958357626535696, OhPointGen::points_48},
+            {0.09684121455103956, 0.8280801506686862, constexpr_sqrt(1.0 - 0.09684121455103956 * 0.09684121455103956 - 0.8280801506686862 * 0.8280801506686862), 0.003036020026407088, OhPointGen::points_48},
+            {0.1833434647041659, 0.9074658265305128, constexpr_sqrt(1.0 - 0.1833434647041659 * 0.1833434647041659 - 0.9074658265305128 * 0.9074658265305128), 0.002832187403926303, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef GENERATOR_TABLE_ORDER_38_HPP
+#define GENERATOR_TABLE_ORDER_38_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_38>
+{
+    static constexpr std::array<GeneratorPoint, 3> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.009523809523809525, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.03214285714285714, OhPointGen::points_8},
+            {0.4597008433809831, constexpr_sqrt(1.0 - 0.4597008433809831 * 0.4597008433809831), 0.0, 0.02857142857142857, OhPointGen::points_24_axis}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef GENERATOR_TABLE_ORDER_3890_HPP
+#define GENERATOR_TABLE_ORDER_3890_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_3890>
+{
+    static constexpr std::array<GeneratorPoint, 100> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 1.80739525219692e-05, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.0002848008782238827, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.0002836065837530581, OhPointGen::points_8},
+            {0.01587876419858352, constexpr_sqrt(1.0 - 2.0 * 0.01587876419858352 * 0.01587876419858352), 0.0, 7.013149266673816e-05, OhPointGen::points_24},
+            {0.04069193593751206, constexpr_sqrt(1.0 - 2.0 * 0.04069193593751206 * 0.04069193593751206), 0.0, 0.0001162798021956766, OhPointGen::points_24},
+            {0.07025888115257997, constexpr_sqrt(1.0 - 2.0 * 0.07025888115257997 * 0.07025888115257997), 0.0, 0.0001518728583972105, OhPointGen::points_24},
+            {0.1027495450028704, constexpr_sqrt(1.0 - 2.0 * 0.1027495450028704 * 0.1027495450028704), 0.0, 0.0001798796108216934, OhPointGen::points_24},
+            {0.1371457730893426, constexpr_sqrt(1.0 - 2.0 * 0.1371457730893426 * 0.1371457730893426), 0.0, 0.0002022593385972785, OhPointGen::points_24},
+            {0.1727758532671953, constexpr_sqrt(1.0 - 2.0 * 0.1727758532671953 * 0.1727758532671953), 0.0, 0.0002203093105575464, OhPointGen::points_24},
+            {0.2091492038929037, constexpr_sqrt(1.0 - 2.0 * 0.2091492038929037 * 0.2091492038929037), 0.0, 0.0002349294234299855, OhPointGen::points_24},
+            {0.2458813281751915, constexpr_sqrt(1.0 - 2.0 * 0.2458813281751915 * 0.2458813281751915), 0.0, 0.0002467682058747003, OhPointGen::points_24},
+            {0.2826545859450066, constexpr_sqrt(1.0 - 2.0 * 0.2826545859450066 * 0.2826545859450066), 0.0, 0.0002563092683572224, OhPointGen::points_24},
+            {0.3191957291799622, constexpr_sqrt(1.0 - 2.0 * 0.3191957291799622 * 0.3191957291799622), 0.0, 0.0002639253896763318, OhPointGen::points_24},
+            {0.3552621469299578, constexpr_sqrt(1.0 - 2.0 * 0.3552621469299578 * 0.3552621469299578), 0.0, 0.0002699137479265108, OhPointGen::points_24},
+            {0.390632950340623, constexpr_sqrt(1.0 - 2.0 * 0.390632950340623 * 0.390632950340623), 0.0, 0.0002745196420166739, OhPointGen::points_24},
+            {0.4251028614093031, constexpr_sqrt(1.0 - 2.0 * 0.4251028614093031 * 0.4251028614093031), 0.0, 0.0002779529197397593, OhPointGen::points_24},
+            {0.458477752011187, constexpr_sqrt(1.0 - 2.0 * 0.458477752011187 * 0.458477752011187), 0.0, 0.0002803996086684265, OhPointGen::points_24},
+            {0.4905711358710193, constexpr_sqrt(1.0 - 2.0 * 0.4905711358710193 * 0.4905711358710193), 0.0, 0.0002820302356715842, OhPointGen::points_24},
+            {0.5212011669847385, constexpr_sqrt(1.0 - 2.0 * 0.5212011669847385 * 0.5212011669847385), 0.0, 0.0002830056747491068, OhPointGen::points_24},
+            {0.5501878488737995, constexpr_sqrt(1.0 - 2.0 * 0.5501878488737995 * 0.5501878488737995), 0.0, 0.0002834808950776839, OhPointGen::points_24},
+            {0.6025037877479342, constexpr_sqrt(1.0 - 2.0 * 0.6025037877479342 * 0.6025037877479342), 0.0, 0.0002835282339078929, OhPointGen::points_24},
+            {0.6254572689549016, constexpr_sqrt(1.0 - 2.0 * 0.6254572689549016 * 0.6254572689549016), 0.0, 0.00028338192670658, OhPointGen::points_24},
+            {0.6460107179528248, constexpr_sqrt(1.0 - 2.0 * 0.6460107179528248 * 0.6460107179528248), 0.0, 0.0002832858336906784, OhPointGen::points_24},
+            {0.6639541138154251, constexpr_sqrt(1.0 - 2.0 * 0.6639541138154251 * 0.6639541138154251), 0.0, 0.0002833268235451244, OhPointGen::points_24},
+            {0.6790688515667495, constexpr_sqrt(1.0 - 2.0 * 0.6790688515667495 * 0.6790688515667495), 0.0, 0.0002835432677029253, OhPointGen::points_24},
+            {0.6911338580371512, constexpr_sqrt(1.0 - 2.0 * 0.6911338580371512 * 0.6911338580371512), 0.0, 0.0002839091722743049, OhPointGen::points_24},
+            {0.699938595612649, constexpr_sqrt(1.0 - 2.0 * 0.699938595612649 * 0.699938595612649), 0.0, 0.0002843308178875841, OhPointGen::points_24},
+            {0.7053037748656896, constexpr_sqrt(1.0 - 2.0 * 0.7053037748656896 * 0.7053037748656896), 0.0, 0.0002846703550533846, OhPointGen::points_24},
+            {0.04732224387180115, constexpr_sqrt(1.0 - 0.04732224387180115 * 0.04732224387180115), 0.0, 0.00010511934069719, OhPointGen::points_24_axis},
+            {0.1202100529326803, constexpr_sqrt(1.0 - 0.1202100529326803 * 0.1202100529326803), 0.0, 0.0001657871838796974, OhPointGen::points_24_axis},
+            {0.2034304820664855, constexpr_sqrt(1.0 - 0.2034304820664855 * 0.2034304820664855), 0.0, 0.0002064648113714232, OhPointGen::points_24_axis},
+            {0.2912285643573002, constexpr_sqrt(1.0 - 0.2912285643573002 * 0.2912285643573002), 0.0, 0.0002347942745819741, OhPointGen::points_24_axis},
+            {0.3802361792726768, constexpr_sqrt(1.0 - 0.3802361792726768 * 0.3802361792726768), 0.0, 0.0002547775326597726, OhPointGen::points_24_axis},
+            {0.4680598511056146, constexpr_sqrt(1.0 - 0.4680598511056146 * 0.4680598511056146), 0.0, 0.0002686876684847025, OhPointGen::points_24_axis},
+            {0.5528151052155599, constexpr_sqrt(1.0 - 0.5528151052155599 * 0.5528151052155599), 0.0, 0.0002778665755515867, OhPointGen::points_24_axis},
+            {0.6329386307803041, constexpr_sqrt(1.0 - 0.6329386307803041 * 0.6329386307803041), 0.0, 0.0002830996616782929, OhPointGen::points_24_axis},
+            {0.0805651665136907, 0.02363454684003124, constexpr_sqrt(1.0 - 0.0805651665136907 * 0.0805651665136907 - 0.02363454684003124 * 0.02363454684003124), 0.0001403063340168372, OhPointGen::points_48},
+            {0.1156476077139389, 0.05191291632545936, constexpr_sqrt(1.0 - 0.1156476077139389 * 0.1156476077139389 - 0.05191291632545936 * 0.05191291632545936), 0.0001696504125939477, OhPointGen::points_48},
+            {0.1520473382760421, 0.0832271573699452, constexpr_sqrt(1.0 - 0.1520473382760421 * 0.1520473382760421 - 0.0832271573699452 * 0.0832271573699452), 0.000193578724274539, OhPointGen::points_48},
+            {0.1892986699745931, 0.1165855667993712, constexpr_sqrt(1.0 - 0.1892986699745931 * 0.1892986699745931 - 0.1165855667993712 * 0.1165855667993712), 0.0002130614510521968, OhPointGen::points_48},
+            {0.2270194446777792, 0.1513077167409504, constexpr_sqrt(1.0 - 0.2270194446777792 * 0.2270194446777792 - 0.1513077167409504 * 0.1513077167409504), 0.0002289381265931048, OhPointGen::points_48},
+            {0.2648908185093273, 0.1868882025807859, constexpr_sqrt(1.0 - 0.2648908185093273 * 0.2648908185093273 - 0.1868882025807859 * 0.1868882025807859), 0.0002418630292816186, OhPointGen::points_48},
+            {0.3026389259574136, 0.2229277629776224, constexpr_sqrt(1.0 - 0.3026389259574136 * 0.3026389259574136 - 0.2229277629776224 * 0.2229277629776224), 0.0002523400495631193, OhPointGen::points_48},
+            {0.3400220296151384, 0.2590951840746235, constexpr_sqrt(1.0 - 0.3400220296151384 * 0.3400220296151384 - 0.2590951840746235 * 0.2590951840746235), 0.0002607623973449605, OhPointGen::points_48},
+            {0.376821795333551, 0.2951047291750847, constexpr_sqrt(1.0 - 0.376821795333551 * 0.376821795333551 - 0.2951047291750847 * 0.2951047291750847), 0.0002674441032689209, OhPointGen::points_48},
+            {0.4128372900921884, 0.330701971416993, constexpr_sqrt(1.0 - 0.4128372900921884 * 0.4128372900921884 - 0.330701971416993 * 0.330701971416993), 0.0002726432360343356, OhPointGen::points_48},
+            {0.447880713181563, 0.3656544101087634, constexpr_sqrt(1.0 - 0.447880713181563 * 0.447880713181563 - 0.3656544101087634 * 0.3656544101087634), 0.0002765787685924545, OhPointGen::points_48},
+            {0.4817742034089257, 0.3997448951939695, constexpr_sqrt(1.0 - 0.4817742034089257 * 0.4817742034089257 - 0.3997448951939695 * 0.3997448951939695), 0.0002794428690642224, OhPointGen::points_48},
+            {0.5143472814653344, 0.4327667110812024, constexpr_sqrt(1.0 - 0.5143472814653344 * 0.5143472814653344 - 0.4327667110812024 * 0.4327667110812024), 0.0002814099002062895, OhPointGen::points_48},
+            {0.545434621390565, 0.4645196123532293, constexpr_sqrt(1.0 - 0.545434621390565 * 0.545434621390565 - 0.4645196123532293 * 0.4645196123532293), 0.0002826429531578994, OhPointGen::points_48},
+            {0.5748739313170252, 0.4948063555703345, constexpr_sqrt(1.0 - 0.5748739313170252 * 0.5748739313170252 - 0.4948063555703345 * 0.4948063555703345), 0.0002832983542550884, OhPointGen::points_48},
+            {0.1599598738286342, 0.02792357590048985, constexpr_sqrt(1.0 - 0.1599598738286342 * 0.1599598738286342 - 0.02792357590048985 * 0.02792357590048985), 0.0001886695565284976, OhPointGen::points_48},
+            {0.1998097412500951, 0.05877141038139065, constexpr_sqrt(1.0 - 0.1998097412500951 * 0.1998097412500951 - 0.05877141038139065 * 0.05877141038139065), 0.0002081867882748234, OhPointGen::points_48},
+            {0.2396228952566202, 0.09164573914691376, constexpr_sqrt(1.0 - 0.2396228952566202 * 0.2396228952566202 - 0.09164573914691376 * 0.09164573914691376), 0.0002245148680600796, OhPointGen::points_48},
+            {0.2792228341097746, 0.1259049641962687, constexpr_sqrt(1.0 - 0.2792228341097746 * 0.2792228341097746 - 0.1259049641962687 * 0.1259049641962687), 0.0002380370491511872, OhPointGen::points_48},
+            {0.3184251107546741, 0.1610594823400863, constexpr_sqrt(1.0 - 0.3184251107546741 * 0.3184251107546741 - 0.1610594823400863 * 0.1610594823400863), 0.0002491398041852455, OhPointGen::points_48},
+            {0.3570481164426244, 0.1967151653460898, constexpr_sqrt(1.0 - 0.3570481164426244 * 0.3570481164426244 - 0.1967151653460898 * 0.1967151653460898), 0.000258163240588123, OhPointGen::points_48},
+            {0.3949164710492144, 0.2325404606175168, constexpr_sqrt(1.0 - 0.3949164710492144 * 0.3949164710492144 - 0.2325404606175168 * 0.2325404606175168), 0.0002653965506227417, OhPointGen::points_48},
+            {0.4318617293970503, 0.2682461141151439, constexpr_sqrt(1.0 - 0.4318617293970503 * 0.4318617293970503 - 0.2682461141151439 * 0.2682461141151439), 0.0002710857216747087, OhPointGen::points_48},
+            {0.4677221009931678, 0.3035720116011973, constexpr_sqrt(1.0 - 0.4677221009931678 * 0.4677221009931678 - 0.3035720116011973 * 0.3035720116011973), 0.0002754434093903659, OhPointGen::points_48},
+            {0.5023417939270955, 0.3382781859197439, constexpr_sqrt(1.0 - 0.5023417939270955 * 0.5023417939270955 - 0.3382781859197439 * 0.3382781859197439), 0.000278657993251938, OhPointGen::points_48},
+            {0.5355701836636128, 0.3721383065625942, constexpr_sqrt(1.0 - 0.5355701836636128 * 0.5355701836636128 - 0.3721383065625942 * 0.3721383065625942), 0.0002809011080679474, OhPointGen::points_48},
+            {0.5672608451328771, 0.4049346360466055, constexpr_sqrt(1.0 - 0.5672608451328771 * 0.5672608451328771 - 0.4049346360466055 * 0.4049346360466055), 0.0002823336184560987, OhPointGen::points_48},
+            {0.5972704202540162, 0.4364538098633802, constexpr_sqrt(1.0 - 0.5972704202540162 * 0.5972704202540162 - 0.4364538098633802 * 0.4364538098633802), 0.0002831101175806309, OhPointGen::points_48},
+            {0.2461687022333596, 0.03070423166833368, constexpr_sqrt(1.0 - 0.2461687022333596 * 0.2461687022333596 - 0.03070423166833368 * 0.03070423166833368), 0.0002221679970354546, OhPointGen::points_48},
+            {0.2881774566286831, 0.06338034669281885, constexpr_sqrt(1.0 - 0.2881774566286831 * 0.2881774566286831 - 0.06338034669281885 * 0.06338034669281885), 0.0002356185734270703, OhPointGen::points_48},
+            {0.3293963604116978, 0.0974286248706794, constexpr_sqrt(1.0 - 0.3293963604116978 * 0.3293963604116978 - 0.0974286248706794 * 0.0974286248706794), 0.000246922834480559, OhPointGen::points_48},
+            {0.3697303822241377, 0.132379953228229, constexpr_sqrt(1.0 - 0.3697303822241377 * 0.3697303822241377 - 0.132379953228229 * 0.132379953228229), 0.0002562726348642046, OhPointGen::points_48},
+            {0.4090663023135127, 0.1678497018129336, constexpr_sqrt(1.0 - 0.4090663023135127 * 0.4090663023135127 - 0.1678497018129336 * 0.1678497018129336), 0.0002638756726753028, OhPointGen::points_48},
+            {0.4472819355411712, 0.2035095105326114, constexpr_sqrt(1.0 - 0.4472819355411712 * 0.4472819355411712 - 0.2035095105326114 * 0.2035095105326114), 0.0002699311157390862, OhPointGen::points_48},
+            {0.4842513377231437, 0.2390692566672091, constexpr_sqrt(1.0 - 0.4842513377231437 * 0.4842513377231437 - 0.2390692566672091 * 0.2390692566672091), 0.0002746233268403837, OhPointGen::points_48},
+            {0.5198477629962928, 0.2742649818076149, constexpr_sqrt(1.0 - 0.5198477629962928 * 0.5198477629962928 - 0.2742649818076149 * 0.2742649818076149), 0.0002781225674454771, OhPointGen::points_48},
+            {0.5539453011883145, 0.3088503806580094, constexpr_sqrt(1.0 - 0.5539453011883145 * 0.5539453011883145 - 0.3088503806580094 * 0.3088503806580094), 0.0002805881254045684, OhPointGen::points_48},
+            {0.5864196762401251, 0.3425904245906614, constexpr_sqrt(1.0 - 0.5864196762401251 * 0.5864196762401251 - 0.3425904245906614 * 0.3425904245906614), 0.0002821719877004913, OhPointGen::points_48},
+            {0.617148446666839, 0.3752562294789468, constexpr_sqrt(1.0 - 0.617148446666839 * 0.617148446666839 - 0.3752562294789468 * 0.3752562294789468), 0.0002830222502333124, OhPointGen::points_48},
+            {0.3350337830565727, 0.03261589934634747, constexpr_sqrt(1.0 - 0.3350337830565727 * 0.3350337830565727 - 0.03261589934634747 * 0.03261589934634747), 0.000245799595674487, OhPointGen::points_48},
+            {0.3775773224758284, 0.06658438928081573, constexpr_sqrt(1.0 - 0.3775773224758284 * 0.3775773224758284 - 0.06658438928081573 * 0.06658438928081573), 0.0002551474407503706, OhPointGen::points_48},
+            {0.4188155229848973, 0.1014565797157954, constexpr_sqrt(1.0 - 0.4188155229848973 * 0.4188155229848973 - 0.1014565797157954 * 0.1014565797157954), 0.0002629065335195311, OhPointGen::points_48},
+            {0.4586805892009344, 0.1368573320843822, constexpr_sqrt(1.0 - 0.4586805892009344 * 0.4586805892009344 - 0.1368573320843822 * 0.1368573320843822), 0.0002691900449925075, OhPointGen::points_48},
+            {0.4970895714224235, 0.1724614851951608, constexpr_sqrt(1.0 - 0.4970895714224235 * 0.4970895714224235 - 0.1724614851951608 * 0.1724614851951608), 0.0002741275485754276, OhPointGen::points_48},
+            {0.5339505133960747, 0.2079779381416412, constexpr_sqrt(1.0 - 0.5339505133960747 * 0.5339505133960747 - 0.2079779381416412 * 0.2079779381416412), 0.0002778530970122595, OhPointGen::points_48},
+            {0.569166579253144, 0.2431385788322288, constexpr_sqrt(1.0 - 0.569166579253144 * 0.569166579253144 - 0.2431385788322288 * 0.2431385788322288), 0.0002805010567646741, OhPointGen::points_48},
+            {0.6026387682680377, 0.2776901883049853, constexpr_sqrt(1.0 - 0.6026387682680377 * 0.6026387682680377 - 0.2776901883049853 * 0.2776901883049853), 0.000282205583403104, OhPointGen::points_48},
+            {0.6342676150163307, 0.3113881356386632, constexpr_sqrt(1.0 - 0.6342676150163307 * 0.6342676150163307 - 0.3113881356386632 * 0.3113881356386632), 0.0002831016901243473, OhPointGen::points_48},
+            {0.4237951119537067, 0.03394877848664351, constexpr_sqrt(1.0 - 0.4237951119537067 * 0.4237951119537067 - 0.03394877848664351 * 0.03394877848664351), 0.0002624474901131803, OhPointGen::points_48},
+            {0.4656918683234929, 0.06880219556291448, constexpr_sqrt(1.0 - 0.4656918683234929 * 0.4656918683234929 - 0.06880219556291448 * 0.06880219556291448), 0.0002688034163039377, OhPointGen::points_48},
+            {0.505885706918598, 0.1041946859721635, constexpr_sqrt(1.0 - 0.505885706918598 * 0.505885706918598 - 0.1041946859721635 * 0.1041946859721635), 0.0002738932751287636, OhPointGen::points_48},
+            {0.5443204666713995, 0.1398039738736393, constexpr_sqrt(1.0 - 0.5443204666713995 * 0.5443204666713995 - 0.1398039738736393 * 0.1398039738736393), 0.0002777944791242523, OhPointGen::points_48},
+            {0.5809298813759742, 0.1753373381196155, constexpr_sqrt(1.0 - 0.5809298813759742 * 0.5809298813759742 - 0.1753373381196155 * 0.1753373381196155), 0.0002806011661660987, OhPointGen::points_48},
+            {0.6156416039447128, 0.210521579351401, constexpr_sqrt(1.0 - 0.6156416039447128 * 0.6156416039447128 - 0.210521579351401 * 0.210521579351401), 0.000282418145659746, OhPointGen::points_48},
+            {0.6483801351066604, 0.2450953312157051, constexpr_sqrt(1.0 - 0.6483801351066604 * 0.6483801351066604 - 0.2450953312157051 * 0.2450953312157051), 0.0002833585216577828, OhPointGen::points_48},
+            {0.5103616577251688, 0.03485560643800719, constexpr_sqrt(1.0 - 0.5103616577251688 * 0.5103616577251688 - 0.03485560643800719 * 0.03485560643800719), 0.0002738165236962878, OhPointGen::points_48},
+            {0.5506738792580681, 0.07026308631512033, constexpr_sqrt(1.0 - 0.5506738792580681 * 0.5506738792580681 - 0.07026308631512033 * 0.07026308631512033), 0.000277836520820318, OhPointGen::points_48},
+            {0.5889573040995292, 0.1059035061296403, constexpr_sqrt(1.0 - 0.5889573040995292 * 0.5889573040995292 - 0.1059035061296403 * 0.1059035061296403), 0.0002807852940418966, OhPointGen::points_48},
+            {0.625164158951693, 0.1414823925236026, constexpr_sqrt(1.0 - 0.625164158951693 * 0.625164158951693 - 0.1414823925236026 * 0.1414823925236026), 0.0002827245949674705, OhPointGen::points_48},
+            {0.6592414921570178, 0.176720790821453, constexpr_sqrt(1.0 - 0.6592414921570178 * 0.6592414921570178 - 0.176720790821453 * 0.176720790821453), 0.0002837342344829828, OhPointGen::points_48},
+            {0.5930314017533383, 0.03542189339561672, constexpr_sqrt(1.0 - 0.5930314017533383 * 0.5930314017533383 - 0.03542189339561672 * 0.03542189339561672), 0.0002809233907610981, OhPointGen::points_48},
+            {0.6309812253390175, 0.07109574040369548, constexpr_sqrt(1.0 - 0.6309812253390175 * 0.6309812253390175 - 0.07109574040369548 * 0.07109574040369548), 0.0002829930809742694, OhPointGen::points_48},
+            {0.666629601135323, 0.106725979228273, constexpr_sqrt(1.0 - 0.666629601135323 * 0.666629601135323 - 0.106725979228273 * 0.106725979228273), 0.0002841097874111479, OhPointGen::points_48},
+            {0.6703715271049921, 0.03569455268820809, constexpr_sqrt(1.0 - 0.6703715271049921 * 0.6703715271049921 - 0.03569455268820809 * 0.03569455268820809), 0.0002843455206008783, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef GENERATOR_TABLE_ORDER_4334_HPP
+#define GENERATOR_TABLE_ORDER_4334_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_4334>
+{
+    static constexpr std::array<GeneratorPoint, 110> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 1.449063022537883e-05, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.0002546377329828424, OhPointGen::points_8},
+            {0.01462896151831013, constexpr_sqrt(1.0 - 2.0 * 0.01462896151831013 * 0.01462896151831013), 0.0, 6.018432961087496e-05, OhPointGen::points_24},
+            {0.03769840812493139, constexpr_sqrt(1.0 - 2.0 * 0.03769840812493139 * 0.03769840812493139), 0.0, 0.0001002286583263673, OhPointGen::points_24},
+            {0.06524701904096891, constexpr_sqrt(1.0 - 2.0 * 0.06524701904096891 * 0.06524701904096891), 0.0, 0.0001315222931028093, OhPointGen::points_24},
+            {0.09560543416134648, constexpr_sqrt(1.0 - 2.0 * 0.09560543416134648 * 0.09560543416134648), 0.0, 0.0001564213746876724, OhPointGen::points_24},
+            {0.1278335898929198, constexpr_sqrt(1.0 - 2.0 * 0.1278335898929198 * 0.1278335898929198), 0.0, 0.0001765118841507736, OhPointGen::points_24},
+            {0.1613096104466031, constexpr_sqrt(1.0 - 2.0 * 0.1613096104466031 * 0.1613096104466031), 0.0, 0.000192873709931108, OhPointGen::points_24},
+            {0.1955806225745371, constexpr_sqrt(1.0 - 2.0 * 0.1955806225745371 * 0.1955806225745371), 0.0, 0.000206265853426327, OhPointGen::points_24},
+            {0.2302935218498028, constexpr_sqrt(1.0 - 2.0 * 0.2302935218498028 * 0.2302935218498028), 0.0, 0.0002172395445953787, OhPointGen::points_24},
+            {0.2651584344113027, constexpr_sqrt(1.0 - 2.0 * 0.2651584344113027 * 0.2651584344113027), 0.0, 0.0002262076188876047, OhPointGen::points_24},
+            {0.2999276825183209, constexpr_sqrt(1.0 - 2.0 * 0.2999276825183209 * 0.2999276825183209), 0.0, 0.0002334885699462397, OhPointGen::points_24},
+            {0.3343828669718798, constexpr_sqrt(1.0 - 2.0 * 0.3343828669718798 * 0.3343828669718798), 0.0, 0.0002393355273179203, OhPointGen::points_24},
+            {0.3683265013750518, constexpr_sqrt(1.0 - 2.0 * 0.3683265013750518 * 0.3683265013750518), 0.0, 0.0002439559200468863, OhPointGen::points_24},
+            {0.4015763206518108, constexpr_sqrt(1.0 - 2.0 * 0.4015763206518108 * 0.4015763206518108), 0.0, 0.0002475251866060002, OhPointGen::points_24},
+            {0.433961202639977, constexpr_sqrt(1.0 - 2.0 * 0.433961202639977 * 0.433961202639977), 0.0, 0.0002501965558158773, OhPointGen::points_24},
+            {0.4653180651114582, constexpr_sqrt(1.0 - 2.0 * 0.4653180651114582 * 0.4653180651114582), 0.0, 0.0002521081407925925, OhPointGen::points_24},
+            {0.4954893331080803, constexpr_sqrt(1.0 - 2.0 * 0.4954893331080803 * 0.4954893331080803), 0.0, 0.0002533881002388081, OhPointGen::points_24},
+            {0.524320706892493, constexpr_sqrt(1.0 - 2.0 * 0.524320706892493 * 0.524320706892493), 0.0, 0.0002541582900848261, OhPointGen::points_24},
+            {0.5516590479041704, constexpr_sqrt(1.0 - 2.0 * 0.5516590479041704 * 0.5516590479041704), 0.0, 0.000254536573752586, OhPointGen::points_24},
+            {0.6012371927804177, constexpr_sqrt(1.0 - 2.0 * 0.6012371927804177 * 0.6012371927804177), 0.0, 0.0002545726993066799, OhPointGen::points_24},
+            {0.6231574466449818, constexpr_sqrt(1.0 - 2.0 * 0.6231574466449818 * 0.6231574466449818), 0.0, 0.0002544456197465555, OhPointGen::points_24},
+            {0.6429416514181271, constexpr_sqrt(1.0 - 2.0 * 0.6429416514181271 * 0.6429416514181271), 0.0, 0.0002543481596881064, OhPointGen::points_24},
+            {0.6604124272943594, constexpr_sqrt(1.0 - 2.0 * 0.6604124272943594 * 0.6604124272943594), 0.0, 0.0002543506451429194, OhPointGen::points_24},
+            {0.675385147040825, constexpr_sqrt(1.0 - 2.0 * 0.675385147040825 * 0.675385147040825), 0.0, 0.0002544905675493763, OhPointGen::points_24},
+            {0.687671797062616, constexpr_sqrt(1.0 - 2.0 * 0.687671797062616 * 0.687671797062616), 0.0, 0.0002547611407344429, OhPointGen::points_24},
+            {0.6970895061319234, constexpr_sqrt(1.0 - 2.0 * 0.6970895061319234 * 0.6970895061319234), 0.0, 0.0002551060375448869, OhPointGen::points_24},
+            {0.703474691255331, constexpr_sqrt(1.0 - 2.0 * 0.703474691255331 * 0.703474691255331), 0.0, 0.0002554291933816039, OhPointGen::points_24},
+            {0.7067017217542295, constexpr_sqrt(1.0 - 2.0 * 0.7067017217542295 * 0.7067017217542295), 0.0, 0.0002556255710686343, OhPointGen::points_24},
+            {0.04382223501131123, constexpr_sqrt(1.0 - 0.04382223501131123 * 0.04382223501131123), 0.0, 9.041339695118196e-05, OhPointGen::points_24_axis},
+            {0.1117474077400006, constexpr_sqrt(1.0 - 0.1117474077400006 * 0.1117474077400006), 0.0, 0.0001438426330079022, OhPointGen::points_24_axis},
+            {0.189715325291144, constexpr_sqrt(1.0 - 0.189715325291144 * 0.189715325291144), 0.0, 0.0001802523089820518, OhPointGen::points_24_axis},
+            {0.2724023009910331, constexpr_sqrt(1.0 - 0.2724023009910331 * 0.2724023009910331), 0.0, 0.0002060052290565496, OhPointGen::points_24_axis},
+            {0.3567163308709902, constexpr_sqrt(1.0 - 0.3567163308709902 * 0.3567163308709902), 0.0, 0.0002245002248967466, OhPointGen::points_24_axis},
+            {0.4404784483028087, constexpr_sqrt(1.0 - 0.4404784483028087 * 0.4404784483028087), 0.0, 0.000237705984773115, OhPointGen::points_24_axis},
+            {0.5219833154161411, constexpr_sqrt(1.0 - 0.5219833154161411 * 0.5219833154161411), 0.0, 0.0002468118955882525, OhPointGen::points_24_axis},
+            {0.5998179868977553, constexpr_sqrt(1.0 - 0.5998179868977553 * 0.5998179868977553), 0.0, 0.0002525410872966528, OhPointGen::points_24_axis},
+            {0.6727803154548222, constexpr_sqrt(1.0 - 0.6727803154548222 * 0.6727803154548222), 0.0, 0.0002553101409933397, OhPointGen::points_24_axis},
+            {0.07476563943166085, 0.02193168509461185, constexpr_sqrt(1.0 - 0.07476563943166085 * 0.07476563943166085 - 0.02193168509461185 * 0.02193168509461185), 0.0001212879733668632, OhPointGen::points_48},
+            {0.1075341482001416, 0.04826419281533887, constexpr_sqrt(1.0 - 0.1075341482001416 * 0.1075341482001416 - 0.04826419281533887 * 0.04826419281533887), 0.0001472872881270931, OhPointGen::points_48},
+            {0.1416344885203259, 0.07751191883575742, constexpr_sqrt(1.0 - 0.1416344885203259 * 0.1416344885203259 - 0.07751191883575742 * 0.07751191883575742), 0.0001686846601010828, OhPointGen::points_48},
+            {0.1766325315388586, 0.108755813924768, constexpr_sqrt(1.0 - 0.1766325315388586 * 0.1766325315388586 - 0.108755813924768 * 0.108755813924768), 0.0001862698414660208, OhPointGen::points_48},
+            {0.2121744174481514, 0.1413661374253096, constexpr_sqrt(1.0 - 0.2121744174481514 * 0.2121744174481514 - 0.1413661374253096 * 0.1413661374253096), 0.0002007430956991861, OhPointGen::points_48},
+            {0.2479669443408145, 0.174876821425888, constexpr_sqrt(1.0 - 0.2479669443408145 * 0.2479669443408145 - 0.174876821425888 * 0.174876821425888), 0.0002126568125394796, OhPointGen::points_48},
+            {0.2837600452294113, 0.2089216406612073, constexpr_sqrt(1.0 - 0.2837600452294113 * 0.2837600452294113 - 0.2089216406612073 * 0.2089216406612073), 0.0002224394603372113, OhPointGen::points_48},
+            {0.3193344933193984, 0.2431987685545972, constexpr_sqrt(1.0 - 0.3193344933193984 * 0.3193344933193984 - 0.2431987685545972 * 0.2431987685545972), 0.0002304264522673135, OhPointGen::points_48},
+            {0.3544935442438745, 0.277449705437777, constexpr_sqrt(1.0 - 0.3544935442438745 * 0.3544935442438745 - 0.277449705437777 * 0.277449705437777), 0.0002368854288424087, OhPointGen::points_48},
+            {0.3890571932288154, 0.3114460356156915, constexpr_sqrt(1.0 - 0.3890571932288154 * 0.3890571932288154 - 0.3114460356156915 * 0.3114460356156915), 0.0002420352089461772, OhPointGen::points_48},
+            {0.422858121425909, 0.3449806851913012, constexpr_sqrt(1.0 - 0.422858121425909 * 0.422858121425909 - 0.3449806851913012 * 0.3449806851913012), 0.0002460597113081295, OhPointGen::points_48},
+            {0.4557387211304052, 0.3778618641248256, constexpr_sqrt(1.0 - 0.4557387211304052 * 0.4557387211304052 - 0.3778618641248256 * 0.3778618641248256), 0.0002491181912257687, OhPointGen::points_48},
+            {0.4875487950541643, 0.4099086391698978, constexpr_sqrt(1.0 - 0.4875487950541643 * 0.4875487950541643 - 0.4099086391698978 * 0.4099086391698978), 0.0002513528194205857, OhPointGen::points_48},
+            {0.5181436529962997, 0.4409474925853973, constexpr_sqrt(1.0 - 0.5181436529962997 * 0.5181436529962997 - 0.4409474925853973 * 0.4409474925853973), 0.000252894309669322, OhPointGen::points_48},
+            {0.5473824095600661, 0.4708094517711291, constexpr_sqrt(1.0 - 0.5473824095600661 * 0.5473824095600661 - 0.4708094517711291 * 0.4708094517711291), 0.0002538660368488136, OhPointGen::points_48},
+            {0.5751263398976174, 0.4993275140354637, constexpr_sqrt(1.0 - 0.5751263398976174 * 0.5751263398976174 - 0.4993275140354637 * 0.4993275140354637), 0.0002543868648299022, OhPointGen::points_48},
+            {0.1489515746840028, 0.02599381993267017, constexpr_sqrt(1.0 - 0.1489515746840028 * 0.1489515746840028 - 0.02599381993267017 * 0.02599381993267017), 0.0001642595537825183, OhPointGen::points_48},
+            {0.1863656444351767, 0.0547928653246219, constexpr_sqrt(1.0 - 0.1863656444351767 * 0.1863656444351767 - 0.0547928653246219 * 0.0547928653246219), 0.0001818246659849308, OhPointGen::points_48},
+            {0.2238602880356348, 0.08556763251425253, constexpr_sqrt(1.0 - 0.2238602880356348 * 0.2238602880356348 - 0.08556763251425253 * 0.08556763251425253), 0.000196656564949242, OhPointGen::points_48},
+            {0.261272337572816, 0.1177257802267011, constexpr_sqrt(1.0 - 0.261272337572816 * 0.261272337572816 - 0.1177257802267011 * 0.1177257802267011), 0.0002090677905657991, OhPointGen::points_48},
+            {0.298433299020619, 0.15081684561927, constexpr_sqrt(1.0 - 0.298433299020619 * 0.298433299020619 - 0.15081684561927 * 0.15081684561927), 0.0002193820409510504, OhPointGen::points_48},
+            {0.3351786584663333, 0.1844801892177727, constexpr_sqrt(1.0 - 0.3351786584663333 * 0.3351786584663333 - 0.1844801892177727 * 0.1844801892177727), 0.0002278870827661928, OhPointGen::points_48},
+            {0.371350552220912, 0.2184145236087598, constexpr_sqrt(1.0 - 0.371350552220912 * 0.371350552220912 - 0.2184145236087598 * 0.2184145236087598), 0.000234828319228209, OhPointGen::points_48},
+            {0.4067981098954663, 0.2523590641486229, constexpr_sqrt(1.0 - 0.4067981098954663 * 0.4067981098954663 - 0.2523590641486229 * 0.2523590641486229), 0.0002404139755581477, OhPointGen::points_48},
+            {0.4413769993687534, 0.2860812976901373, constexpr_sqrt(1.0 - 0.4413769993687534 * 0.4413769993687534 - 0.2860812976901373 * 0.2860812976901373), 0.0002448227407760734, OhPointGen::points_48},
+            {0.4749487182516394, 0.3193686757808996, constexpr_sqrt(1.0 - 0.4749487182516394 * 0.4749487182516394 - 0.3193686757808996 * 0.3193686757808996), 0.0002482110455592573, OhPointGen::points_48},
+            {0.5073798105075426, 0.3520226949547602, constexpr_sqrt(1.0 - 0.5073798105075426 * 0.5073798105075426 - 0.3520226949547602 * 0.3520226949547602), 0.0002507192397774103, OhPointGen::points_48},
+            {0.5385410448878654, 0.383854439566789, constexpr_sqrt(1.0 - 0.5385410448878654 * 0.5385410448878654 - 0.383854439566789 * 0.383854439566789), 0.000252476596853488, OhPointGen::points_48},
+            {0.568306535367053, 0.4146810037640963, constexpr_sqrt(1.0 - 0.568306535367053 * 0.568306535367053 - 0.4146810037640963 * 0.4146810037640963), 0.0002536052388539425, OhPointGen::points_48},
+            {0.596552762066351, 0.4443224094681121, constexpr_sqrt(1.0 - 0.596552762066351 * 0.596552762066351 - 0.4443224094681121 * 0.4443224094681121), 0.0002542230588033068, OhPointGen::points_48},
+            {0.2299227700856157, 0.02865757664057584, constexpr_sqrt(1.0 - 0.2299227700856157 * 0.2299227700856157 - 0.02865757664057584 * 0.02865757664057584), 0.0001944817013047896, OhPointGen::points_48},
+            {0.2695752998553267, 0.05923421684485993, constexpr_sqrt(1.0 - 0.2695752998553267 * 0.2695752998553267 - 0.05923421684485993 * 0.05923421684485993), 0.0002067862362746635, OhPointGen::points_48},
+            {0.3086178716611389, 0.09117817776057716, constexpr_sqrt(1.0 - 0.3086178716611389 * 0.3086178716611389 - 0.09117817776057716 * 0.09117817776057716), 0.0002172440734649114, OhPointGen::points_48},
+            {0.3469649871659077, 0.1240593814082605, constexpr_sqrt(1.0 - 0.3469649871659077 * 0.3469649871659077 - 0.1240593814082605 * 0.1240593814082605), 0.0002260125991723423, OhPointGen::points_48},
+            {0.3845153566319655, 0.1575272058259175, constexpr_sqrt(1.0 - 0.3845153566319655 * 0.3845153566319655 - 0.1575272058259175 * 0.1575272058259175), 0.0002332655008689523, OhPointGen::points_48},
+            {0.4211600033403215, 0.1912845163525413, constexpr_sqrt(1.0 - 0.4211600033403215 * 0.4211600033403215 - 0.1912845163525413 * 0.1912845163525413), 0.0002391699681532458, OhPointGen::points_48},
+            {0.4567867834329882, 0.2250710177858171, constexpr_sqrt(1.0 - 0.4567867834329882 * 0.4567867834329882 - 0.2250710177858171 * 0.2250710177858171), 0.0002438801528273928, OhPointGen::points_48},
+            {0.4912829319232061, 0.258652130344091, constexpr_sqrt(1.0 - 0.4912829319232061 * 0.4912829319232061 - 0.258652130344091 * 0.258652130344091), 0.0002475370504260665, OhPointGen::points_48},
+            {0.5245364793303812, 0.2918112242865407, constexpr_sqrt(1.0 - 0.5245364793303812 * 0.5245364793303812 - 0.2918112242865407 * 0.2918112242865407), 0.0002502707235640574, OhPointGen::points_48},
+            {0.5564369788915756, 0.324343923906789, constexpr_sqrt(1.0 - 0.5564369788915756 * 0.5564369788915756 - 0.324343923906789 * 0.324343923906789), 0.0002522031701054241, OhPointGen::points_48},
+            {0.5868757697775288, 0.3560536787835351, constexpr_sqrt(1.0 - 0.5868757697775288 * 0.5868757697775288 - 0.3560536787835351 * 0.3560536787835351), 0.0002534511269978784, OhPointGen::points_48},
+            {0.6157458853519617, 0.3867480821242581, constexpr_sqrt(1.0 - 0.6157458853519617 * 0.6157458853519617 - 0.3867480821242581 * 0.3867480821242581), 0.0002541284914955151, OhPointGen::points_48},
+            {0.3138461110672113, 0.03051374637507278, constexpr_sqrt(1.0 - 0.3138461110672113 * 0.3138461110672113 - 0.03051374637507278 * 0.03051374637507278), 0.0002161509250688394, OhPointGen::points_48},
+            {0.3542495872050569, 0.06237111233730755, constexpr_sqrt(1.0 - 0.3542495872050569 * 0.3542495872050569 - 0.06237111233730755 * 0.06237111233730755), 0.0002248778513437852, OhPointGen::points_48},
+            {0.3935751553120181, 0.09516223952401907, constexpr_sqrt(1.0 - 0.3935751553120181 * 0.3935751553120181 - 0.09516223952401907 * 0.09516223952401907), 0.0002322388803404617, OhPointGen::points_48},
+            {0.4317634668111147, 0.1285467341508517, constexpr_sqrt(1.0 - 0.4317634668111147 * 0.4317634668111147 - 0.1285467341508517 * 0.1285467341508517), 0.0002383265471001355, OhPointGen::points_48},
+            {0.4687413842250821, 0.1622318931656033, constexpr_sqrt(1.0 - 0.4687413842250821 * 0.4687413842250821 - 0.1622318931656033 * 0.1622318931656033), 0.0002432476675019525, OhPointGen::points_48},
+            {0.5044274237060283, 0.1959581153836453, constexpr_sqrt(1.0 - 0.5044274237060283 * 0.5044274237060283 - 0.1959581153836453 * 0.1959581153836453), 0.0002471122223750674, OhPointGen::points_48},
+            {0.5387354077925727, 0.2294888081183837, constexpr_sqrt(1.0 - 0.5387354077925727 * 0.5387354077925727 - 0.2294888081183837 * 0.2294888081183837), 0.000250029175248687, OhPointGen::points_48},
+            {0.5715768898356105, 0.2626031152713945, constexpr_sqrt(1.0 - 0.5715768898356105 * 0.5715768898356105 - 0.2626031152713945 * 0.2626031152713945), 0.0002521055942764682, OhPointGen::points_48},
+            {0.6028627200136111, 0.2950904075286713, constexpr_sqrt(1.0 - 0.6028627200136111 * 0.6028627200136111 - 0.2950904075286713 * 0.2950904075286713), 0.0002534472785575503, OhPointGen::points_48},
+            {0.6325039812653463, 0.3267458451113286, constexpr_sqrt(1.0 - 0.6325039812653463 * 0.6325039812653463 - 0.3267458451113286 * 0.3267458451113286), 0.0002541599713080121, OhPointGen::points_48},
+            {0.3981986708423407, 0.03183291458749821, constexpr_sqrt(1.0 - 0.3981986708423407 * 0.3981986708423407 - 0.03183291458749821 * 0.03183291458749821), 0.0002317380975862936, OhPointGen::points_48},
+            {0.43827911821333, 0.06459548193880908, constexpr_sqrt(1.0 - 0.43827911821333 * 0.43827911821333 - 0.06459548193880908 * 0.06459548193880908), 0.0002378550733719775, OhPointGen::points_48},
+            {0.4769233057218166, 0.09795757037087952, constexpr_sqrt(1.0 - 0.4769233057218166 * 0.4769233057218166 - 0.09795757037087952 * 0.09795757037087952), 0.0002428884456739118, OhPointGen::points_48},
+            {0.5140823911194238, 0.1316307235126655, constexpr_sqrt(1.0 - 0.5140823911194238 * 0.5140823911194238 - 0.1316307235126655 * 0.1316307235126655), 0.0002469002655757292, OhPointGen::points_48},
+            {0.5496977833862983, 0.1653556486358704, constexpr_sqrt(1.0 - 0.5496977833862983 * 0.5496977833862983 - 0.1653556486358704 * 0.1653556486358704), 0.0002499657574265851, OhPointGen::points_48},
+            {0.5837047306512727, 0.198893172412651, constexpr_sqrt(1.0 - 0.5837047306512727 * 0.5837047306512727 - 0.198893172412651 * 0.198893172412651), 0.0002521676168486082, OhPointGen::points_48},
+            {0.6160349566926879, 0.232017458143895, constexpr_sqrt(1.0 - 0.6160349566926879 * 0.6160349566926879 - 0.232017458143895 * 0.232017458143895), 0.0002535935662645334, OhPointGen::points_48},
+            {0.646618535320944, 0.2645106562168662, constexpr_sqrt(1.0 - 0.646618535320944 * 0.646618535320944 - 0.2645106562168662 * 0.2645106562168662), 0.0002543356743363214, OhPointGen::points_48},
+            {0.4810835158795404, 0.03275917807743992, constexpr_sqrt(1.0 - 0.4810835158795404 * 0.4810835158795404 - 0.03275917807743992 * 0.03275917807743992), 0.0002427353285201535, OhPointGen::points_48},
+            {0.5199925041324341, 0.06612546183967181, constexpr_sqrt(1.0 - 0.5199925041324341 * 0.5199925041324341 - 0.06612546183967181 * 0.06612546183967181), 0.0002468258039744386, OhPointGen::points_48},
+            {0.5571717692207494, 0.09981498331474144, constexpr_sqrt(1.0 - 0.5571717692207494 * 0.5571717692207494 - 0.09981498331474144 * 0.09981498331474144), 0.000250006095644031, OhPointGen::points_48},
+            {0.5925789250836379, 0.1335687001410374, constexpr_sqrt(1.0 - 0.5925789250836379 * 0.5925789250836379 - 0.1335687001410374 * 0.1335687001410374), 0.0002523238365420979, OhPointGen::points_48},
+            {0.626165852385967, 0.1671444402896463, constexpr_sqrt(1.0 - 0.626165852385967 * 0.626165852385967 - 0.1671444402896463 * 0.1671444402896463), 0.0002538399260252846, OhPointGen::points_48},
+            {0.657881112666933, 0.2003106382156076, constexpr_sqrt(1.0 - 0.657881112666933 * 0.657881112666933 - 0.2003106382156076 * 0.2003106382156076), 0.0002546255927268069, OhPointGen::points_48},
+            {0.56096246129981, 0.03337500940231335, constexpr_sqrt(1.0 - 0.56096246129981 * 0.56096246129981 - 0.03337500940231335 * 0.03337500940231335), 0.0002500583360048449, OhPointGen::points_48},
+            {0.597995965998467, 0.06708750335901803, constexpr_sqrt(1.0 - 0.597995965998467 * 0.597995965998467 - 0.06708750335901803 * 0.06708750335901803), 0.0002524777638260203, OhPointGen::points_48},
+            {0.6330523711054002, 0.100879212642485, constexpr_sqrt(1.0 - 0.6330523711054002 * 0.6330523711054002 - 0.100879212642485 * 0.100879212642485), 0.0002540951193860656, OhPointGen::points_48},
+            {0.6660960998103972, 0.1345050343171794, constexpr_sqrt(1.0 - 0.6660960998103972 * 0.6660960998103972 - 0.1345050343171794 * 0.1345050343171794), 0.0002549524085027472, OhPointGen::points_48},
+            {0.6365384364585819, 0.03372799460737052, constexpr_sqrt(1.0 - 0.6365384364585819 * 0.6365384364585819 - 0.03372799460737052 * 0.03372799460737052), 0.0002542569507009158, OhPointGen::points_48},
+            {0.6710994302899275, 0.06755249309678028, constexpr_sqrt(1.0 - 0.6710994302899275 * 0.6710994302899275 - 0.06755249309678028 * 0.06755249309678028), 0.0002552114127580376, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
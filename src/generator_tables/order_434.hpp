@@ -0,0 +1,41 @@
+#ifndef GENERATOR_TABLE_ORDER_434_HPP
+#define GENERATOR_TABLE_ORDER_434_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_434>
+{
+    static constexpr std::array<GeneratorPoint, 16> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.0005265897968224436, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.002548219972002607, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.002512317418927307, OhPointGen::points_8},
+            {0.6909346307509111, constexpr_sqrt(1.0 - 2.0 * 0.6909346307509111 * 0.6909346307509111), 0.0, 0.002530403801186355, OhPointGen::points_24},
+            {0.1774836054609158, constexpr_sqrt(1.0 - 2.0 * 0.1774836054609158 * 0.1774836054609158), 0.0, 0.002014279020918528, OhPointGen::points_24},
+            {0.4914342637784746, constexpr_sqrt(1.0 - 2.0 * 0.4914342637784746 * 0.4914342637784746), 0.0, 0.002501725168402936, OhPointGen::points_24},
+            {0.6456664707424256, constexpr_sqrt(1.0 - 2.0 * 0.6456664707424256 * 0.6456664707424256), 0.0, 0.002513267174597564, OhPointGen::points_24},
+            {0.2861289010307638, constexpr_sqrt(1.0 - 2.0 * 0.2861289010307638 * 0.2861289010307638), 0.0, 0.002302694782227416, OhPointGen::points_24},
+            {0.07568084367178018, constexpr_sqrt(1.0 - 2.0 * 0.07568084367178018 * 0.07568084367178018), 0.0, 0.001462495621594614, OhPointGen::points_24},
+            {0.3927259763368002, constexpr_sqrt(1.0 - 2.0 * 0.3927259763368002 * 0.3927259763368002), 0.0, 0.00244537343731298, OhPointGen::points_24},
+            {0.8818132877794288, constexpr_sqrt(1.0 - 0.8818132877794288 * 0.8818132877794288), 0.0, 0.002417442375638981, OhPointGen::points_24_axis},
+            {0.9776428111182648, constexpr_sqrt(1.0 - 0.9776428111182648 * 0.9776428111182648), 0.0, 0.001910951282179532, OhPointGen::points_24_axis},
+            {0.2054823696403044, 0.8689460322872412, constexpr_sqrt(1.0 - 0.2054823696403044 * 0.2054823696403044 - 0.8689460322872412 * 0.8689460322872412), 0.002416930044324775, OhPointGen::points_48},
+            {0.5905157048925271, 0.7999278543857286, constexpr_sqrt(1.0 - 0.5905157048925271 * 0.5905157048925271 - 0.7999278543857286 * 0.7999278543857286), 0.002512236854563495, OhPointGen::points_48},
+            {0.5550152361076807, 0.7717462626915901, constexpr_sqrt(1.0 - 0.5550152361076807 * 0.5550152361076807 - 0.7717462626915901 * 0.7717462626915901), 0.002496644054553086, OhPointGen::points_48},
+            {0.9371809858553722, 0.3344363145343455, constexpr_sqrt(1.0 - 0.9371809858553722 * 0.9371809858553722 - 0.3344363145343455 * 0.3344363145343455), 0.002236607760437849, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
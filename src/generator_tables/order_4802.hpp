@@ -0,0 +1,146 @@
+#ifndef GENERATOR_TABLE_ORDER_4802_HPP
+#define GENERATOR_TABLE_ORDER_4802_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_4802>
+{
+    static constexpr std::array<GeneratorPoint, 121> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 9.687521879420705e-05, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.0002307897895367918, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.0002297310852498558, OhPointGen::points_8},
+            {0.02335728608887064, constexpr_sqrt(1.0 - 2.0 * 0.02335728608887064 * 0.02335728608887064), 0.0, 7.386265944001918e-05, OhPointGen::points_24},
+            {0.04352987836550653, constexpr_sqrt(1.0 - 2.0 * 0.04352987836550653 * 0.04352987836550653), 0.0, 8.25797769854221e-05, OhPointGen::points_24},
+            {0.064392005210888, constexpr_sqrt(1.0 - 2.0 * 0.064392005210888 * 0.064392005210888), 0.0, 9.70604476205763e-05, OhPointGen::points_24},
+            {0.0900394363199318, constexpr_sqrt(1.0 - 2.0 * 0.0900394363199318 * 0.0900394363199318), 0.0, 0.0001302393847117003, OhPointGen::points_24},
+            {0.1196706615548473, constexpr_sqrt(1.0 - 2.0 * 0.1196706615548473 * 0.1196706615548473), 0.0, 0.0001541957004600968, OhPointGen::points_24},
+            {0.1511715412838134, constexpr_sqrt(1.0 - 2.0 * 0.1511715412838134 * 0.1511715412838134), 0.0, 0.0001704459770092199, OhPointGen::points_24},
+            {0.1835982828503801, constexpr_sqrt(1.0 - 2.0 * 0.1835982828503801 * 0.1835982828503801), 0.0, 0.0001827374890942906, OhPointGen::points_24},
+            {0.2165081259155405, constexpr_sqrt(1.0 - 2.0 * 0.2165081259155405 * 0.2165081259155405), 0.0, 0.0001926360817436107, OhPointGen::points_24},
+            {0.2496208720417563, constexpr_sqrt(1.0 - 2.0 * 0.2496208720417563 * 0.2496208720417563), 0.0, 0.0002008010239494833, OhPointGen::points_24},
+            {0.28272006735679, constexpr_sqrt(1.0 - 2.0 * 0.28272006735679 * 0.28272006735679), 0.0, 0.0002075635983209175, OhPointGen::points_24},
+            {0.3156190823994346, constexpr_sqrt(1.0 - 2.0 * 0.3156190823994346 * 0.3156190823994346), 0.0, 0.0002131306638690909, OhPointGen::points_24},
+            {0.3481476793749115, constexpr_sqrt(1.0 - 2.0 * 0.3481476793749115 * 0.3481476793749115), 0.0, 0.0002176562329937335, OhPointGen::points_24},
+            {0.3801466086947226, constexpr_sqrt(1.0 - 2.0 * 0.3801466086947226 * 0.3801466086947226), 0.0, 0.0002212682262991018, OhPointGen::points_24},
+            {0.4114652119634011, constexpr_sqrt(1.0 - 2.0 * 0.4114652119634011 * 0.4114652119634011), 0.0, 0.0002240799515668565, OhPointGen::points_24},
+            {0.4419598786519751, constexpr_sqrt(1.0 - 2.0 * 0.4419598786519751 * 0.4419598786519751), 0.0, 0.0002261959816187525, OhPointGen::points_24},
+            {0.4714925949329543, constexpr_sqrt(1.0 - 2.0 * 0.4714925949329543 * 0.4714925949329543), 0.0, 0.0002277156368808855, OhPointGen::points_24},
+            {0.4999293972879466, constexpr_sqrt(1.0 - 2.0 * 0.4999293972879466 * 0.4999293972879466), 0.0, 0.0002287351772128336, OhPointGen::points_24},
+            {0.5271387221431248, constexpr_sqrt(1.0 - 2.0 * 0.5271387221431248 * 0.5271387221431248), 0.0, 0.0002293490814084085, OhPointGen::points_24},
+            {0.5529896780837761, constexpr_sqrt(1.0 - 2.0 * 0.5529896780837761 * 0.5529896780837761), 0.0, 0.0002296505312376273, OhPointGen::points_24},
+            {0.6000856099481712, constexpr_sqrt(1.0 - 2.0 * 0.6000856099481712 * 0.6000856099481712), 0.0, 0.0002296793832318756, OhPointGen::points_24},
+            {0.6210562192785175, constexpr_sqrt(1.0 - 2.0 * 0.6210562192785175 * 0.6210562192785175), 0.0, 0.0002295785443842974, OhPointGen::points_24},
+            {0.640116587993424, constexpr_sqrt(1.0 - 2.0 * 0.640116587993424 * 0.640116587993424), 0.0, 0.0002295017931529102, OhPointGen::points_24},
+            {0.6571144029244333, constexpr_sqrt(1.0 - 2.0 * 0.6571144029244333 * 0.6571144029244333), 0.0, 0.0002295059638184868, OhPointGen::points_24},
+            {0.6718910821718863, constexpr_sqrt(1.0 - 2.0 * 0.6718910821718863 * 0.6718910821718863), 0.0, 0.0002296232343237362, OhPointGen::points_24},
+            {0.684284559109901, constexpr_sqrt(1.0 - 2.0 * 0.684284559109901 * 0.684284559109901), 0.0, 0.0002298530178740771, OhPointGen::points_24},
+            {0.6941353476269816, constexpr_sqrt(1.0 - 2.0 * 0.6941353476269816 * 0.6941353476269816), 0.0, 0.0002301579790280501, OhPointGen::points_24},
+            {0.7012965242212991, constexpr_sqrt(1.0 - 2.0 * 0.7012965242212991 * 0.7012965242212991), 0.0, 0.0002304690404996513, OhPointGen::points_24},
+            {0.7056471428242644, constexpr_sqrt(1.0 - 2.0 * 0.7056471428242644 * 0.7056471428242644), 0.0, 0.0002307027995907102, OhPointGen::points_24},
+            {0.04595557643585895, constexpr_sqrt(1.0 - 0.04595557643585895 * 0.04595557643585895), 0.0, 9.312274696671092e-05, OhPointGen::points_24_axis},
+            {0.1049316742435023, constexpr_sqrt(1.0 - 0.1049316742435023 * 0.1049316742435023), 0.0, 0.0001199919385876926, OhPointGen::points_24_axis},
+            {0.1773548879549274, constexpr_sqrt(1.0 - 0.1773548879549274 * 0.1773548879549274), 0.0, 0.000159803913887769, OhPointGen::points_24_axis},
+            {0.2559071411236127, constexpr_sqrt(1.0 - 0.2559071411236127 * 0.2559071411236127), 0.0, 0.00018222537635749, OhPointGen::points_24_axis},
+            {0.3358156837985898, constexpr_sqrt(1.0 - 0.3358156837985898 * 0.3358156837985898), 0.0, 0.000198857959365504, OhPointGen::points_24_axis},
+            {0.4155835743763893, constexpr_sqrt(1.0 - 0.4155835743763893 * 0.4155835743763893), 0.0, 0.0002112620102533307, OhPointGen::points_24_axis},
+            {0.4937894296167472, constexpr_sqrt(1.0 - 0.4937894296167472 * 0.4937894296167472), 0.0, 0.0002201594887699007, OhPointGen::points_24_axis},
+            {0.5691569694793316, constexpr_sqrt(1.0 - 0.5691569694793316 * 0.5691569694793316), 0.0, 0.0002261622590895036, OhPointGen::points_24_axis},
+            {0.6405840854894251, constexpr_sqrt(1.0 - 0.6405840854894251 * 0.6405840854894251), 0.0, 0.0002296458453435705, OhPointGen::points_24_axis},
+            {0.07345133894143348, 0.02177844081486067, constexpr_sqrt(1.0 - 0.07345133894143348 * 0.07345133894143348 - 0.02177844081486067 * 0.02177844081486067), 0.0001006006990267, OhPointGen::points_48},
+            {0.1009859834044931, 0.04590362185775188, constexpr_sqrt(1.0 - 0.1009859834044931 * 0.1009859834044931 - 0.04590362185775188 * 0.04590362185775188), 0.0001227676689635876, OhPointGen::points_48},
+            {0.1324289619748758, 0.07255063095690877, constexpr_sqrt(1.0 - 0.1324289619748758 * 0.1324289619748758 - 0.07255063095690877 * 0.07255063095690877), 0.0001467864280270117, OhPointGen::points_48},
+            {0.1654272109607127, 0.1017825451960684, constexpr_sqrt(1.0 - 0.1654272109607127 * 0.1654272109607127 - 0.1017825451960684 * 0.1017825451960684), 0.0001644178912101232, OhPointGen::points_48},
+            {0.1990767186776461, 0.1325652320980364, constexpr_sqrt(1.0 - 0.1990767186776461 * 0.1990767186776461 - 0.1325652320980364 * 0.1325652320980364), 0.0001777664890718961, OhPointGen::points_48},
+            {0.2330125945523278, 0.1642765374496765, constexpr_sqrt(1.0 - 0.2330125945523278 * 0.2330125945523278 - 0.1642765374496765 * 0.1642765374496765), 0.000188482566451669, OhPointGen::points_48},
+            {0.2670080611108287, 0.1965360374337889, constexpr_sqrt(1.0 - 0.2670080611108287 * 0.2670080611108287 - 0.1965360374337889 * 0.1965360374337889), 0.0001973269246453848, OhPointGen::points_48},
+            {0.3008753376294316, 0.2290726770542238, constexpr_sqrt(1.0 - 0.3008753376294316 * 0.3008753376294316 - 0.2290726770542238 * 0.2290726770542238), 0.0002046767775855328, OhPointGen::points_48},
+            {0.334447559616786, 0.2616645495370823, constexpr_sqrt(1.0 - 0.334447559616786 * 0.334447559616786 - 0.2616645495370823 * 0.2616645495370823), 0.000210760012591804, OhPointGen::points_48},
+            {0.3675709724070786, 0.2941150728843141, constexpr_sqrt(1.0 - 0.3675709724070786 * 0.3675709724070786 - 0.2941150728843141 * 0.2941150728843141), 0.0002157416362266829, OhPointGen::points_48},
+            {0.4001000887587812, 0.3262440400919066, constexpr_sqrt(1.0 - 0.4001000887587812 * 0.4001000887587812 - 0.3262440400919066 * 0.3262440400919066), 0.0002197557816920721, OhPointGen::points_48},
+            {0.4318956350436028, 0.3578835350611916, constexpr_sqrt(1.0 - 0.4318956350436028 * 0.4318956350436028 - 0.3578835350611916 * 0.3578835350611916), 0.0002229192611835437, OhPointGen::points_48},
+            {0.4628239056795531, 0.3888751854043678, constexpr_sqrt(1.0 - 0.4628239056795531 * 0.4628239056795531 - 0.3888751854043678 * 0.3888751854043678), 0.0002253385110212775, OhPointGen::points_48},
+            {0.4927563229773636, 0.419067800322284, constexpr_sqrt(1.0 - 0.4927563229773636 * 0.4927563229773636 - 0.419067800322284 * 0.419067800322284), 0.0002271137107548774, OhPointGen::points_48},
+            {0.5215687136707969, 0.4483151836883852, constexpr_sqrt(1.0 - 0.5215687136707969 * 0.5215687136707969 - 0.4483151836883852 * 0.4483151836883852), 0.0002283414092917525, OhPointGen::points_48},
+            {0.5491402346984905, 0.476474067608788, constexpr_sqrt(1.0 - 0.5491402346984905 * 0.5491402346984905 - 0.476474067608788 * 0.476474067608788), 0.0002291161673130077, OhPointGen::points_48},
+            {0.5753520160126075, 0.5034021310998277, constexpr_sqrt(1.0 - 0.5753520160126075 * 0.5753520160126075 - 0.5034021310998277 * 0.5034021310998277), 0.0002295313908576598, OhPointGen::points_48},
+            {0.1388326356417754, 0.02435436510372806, constexpr_sqrt(1.0 - 0.1388326356417754 * 0.1388326356417754 - 0.02435436510372806 * 0.02435436510372806), 0.0001438204721359031, OhPointGen::points_48},
+            {0.1743686900537244, 0.05118897057342652, constexpr_sqrt(1.0 - 0.1743686900537244 * 0.1743686900537244 - 0.05118897057342652 * 0.05118897057342652), 0.0001607738025495257, OhPointGen::points_48},
+            {0.2099737037950268, 0.08014695048539634, constexpr_sqrt(1.0 - 0.2099737037950268 * 0.2099737037950268 - 0.08014695048539634 * 0.08014695048539634), 0.0001741483853528379, OhPointGen::points_48},
+            {0.2454492590908548, 0.1105117874155699, constexpr_sqrt(1.0 - 0.2454492590908548 * 0.2454492590908548 - 0.1105117874155699 * 0.1105117874155699), 0.0001851918467519151, OhPointGen::points_48},
+            {0.2807219257864278, 0.1417950531570966, constexpr_sqrt(1.0 - 0.2807219257864278 * 0.2807219257864278 - 0.1417950531570966 * 0.1417950531570966), 0.0001944628638070613, OhPointGen::points_48},
+            {0.3156842271975842, 0.1736604945719597, constexpr_sqrt(1.0 - 0.3156842271975842 * 0.3156842271975842 - 0.1736604945719597 * 0.1736604945719597), 0.0002022495446275152, OhPointGen::points_48},
+            {0.3502090945177752, 0.2058466324693981, constexpr_sqrt(1.0 - 0.3502090945177752 * 0.3502090945177752 - 0.2058466324693981 * 0.2058466324693981), 0.0002087462382438514, OhPointGen::points_48},
+            {0.3841684849519686, 0.2381284261195919, constexpr_sqrt(1.0 - 0.3841684849519686 * 0.3841684849519686 - 0.2381284261195919 * 0.2381284261195919), 0.0002141074754818308, OhPointGen::points_48},
+            {0.4174372367906016, 0.2703031270422569, constexpr_sqrt(1.0 - 0.4174372367906016 * 0.4174372367906016 - 0.2703031270422569 * 0.2703031270422569), 0.0002184640913748162, OhPointGen::points_48},
+            {0.4498926465011892, 0.3021845683091309, constexpr_sqrt(1.0 - 0.4498926465011892 * 0.4498926465011892 - 0.3021845683091309 * 0.3021845683091309), 0.0002219309165220329, OhPointGen::points_48},
+            {0.4814146229807701, 0.333599335516572, constexpr_sqrt(1.0 - 0.4814146229807701 * 0.4814146229807701 - 0.333599335516572 * 0.333599335516572), 0.0002246123118340624, OhPointGen::points_48},
+            {0.5118863625734701, 0.3643833735518232, constexpr_sqrt(1.0 - 0.5118863625734701 * 0.5118863625734701 - 0.3643833735518232 * 0.3643833735518232), 0.0002266062766915125, OhPointGen::points_48},
+            {0.5411947455119144, 0.3943789541958179, constexpr_sqrt(1.0 - 0.5411947455119144 * 0.5411947455119144 - 0.3943789541958179 * 0.3943789541958179), 0.0002280072952230796, OhPointGen::points_48},
+            {0.5692301500357246, 0.4234320144403542, constexpr_sqrt(1.0 - 0.5692301500357246 * 0.5692301500357246 - 0.4234320144403542 * 0.4234320144403542), 0.0002289082025202583, OhPointGen::points_48},
+            {0.5958857204139576, 0.451389794741926, constexpr_sqrt(1.0 - 0.5958857204139576 * 0.5958857204139576 - 0.451389794741926 * 0.451389794741926), 0.0002294012695120025, OhPointGen::points_48},
+            {0.2156270284785766, 0.02681225755444491, constexpr_sqrt(1.0 - 0.2156270284785766 * 0.2156270284785766 - 0.02681225755444491 * 0.02681225755444491), 0.0001722434488736947, OhPointGen::points_48},
+            {0.253238505490971, 0.05557495747805614, constexpr_sqrt(1.0 - 0.253238505490971 * 0.253238505490971 - 0.05557495747805614 * 0.05557495747805614), 0.0001830237421455091, OhPointGen::points_48},
+            {0.2902564617771537, 0.08569368062950249, constexpr_sqrt(1.0 - 0.2902564617771537 * 0.2902564617771537 - 0.08569368062950249 * 0.08569368062950249), 0.0001923855349997633, OhPointGen::points_48},
+            {0.3266979823143256, 0.1167367450324135, constexpr_sqrt(1.0 - 0.3266979823143256 * 0.3266979823143256 - 0.1167367450324135 * 0.1167367450324135), 0.0002004067861936271, OhPointGen::points_48},
+            {0.3625039627493614, 0.1483861994003304, constexpr_sqrt(1.0 - 0.3625039627493614 * 0.3625039627493614 - 0.1483861994003304 * 0.1483861994003304), 0.0002071817297354263, OhPointGen::points_48},
+            {0.3975838937548699, 0.1803821503011405, constexpr_sqrt(1.0 - 0.3975838937548699 * 0.3975838937548699 - 0.1803821503011405 * 0.1803821503011405), 0.0002128250834102103, OhPointGen::points_48},
+            {0.4318396099009774, 0.2124962965666424, constexpr_sqrt(1.0 - 0.4318396099009774 * 0.4318396099009774 - 0.2124962965666424 * 0.2124962965666424), 0.0002174513719440102, OhPointGen::points_48},
+            {0.4651706555732742, 0.2445221837805913, constexpr_sqrt(1.0 - 0.4651706555732742 * 0.4651706555732742 - 0.2445221837805913 * 0.2445221837805913), 0.0002211661839150214, OhPointGen::points_48},
+            {0.4974752649620969, 0.2762701224322987, constexpr_sqrt(1.0 - 0.4974752649620969 * 0.4974752649620969 - 0.2762701224322987 * 0.2762701224322987), 0.0002240665257813102, OhPointGen::points_48},
+            {0.5286517579627517, 0.3075627775211328, constexpr_sqrt(1.0 - 0.5286517579627517 * 0.5286517579627517 - 0.3075627775211328 * 0.3075627775211328), 0.000226243951663262, OhPointGen::points_48},
+            {0.5586001195731894, 0.3382311089826877, constexpr_sqrt(1.0 - 0.5586001195731894 * 0.5586001195731894 - 0.3382311089826877 * 0.3382311089826877), 0.0002277874557231869, OhPointGen::points_48},
+            {0.5872229902021319, 0.3681108834741399, constexpr_sqrt(1.0 - 0.5872229902021319 * 0.5872229902021319 - 0.3681108834741399 * 0.3681108834741399), 0.0002287854314454994, OhPointGen::points_48},
+            {0.6144258616235123, 0.3970397446872839, constexpr_sqrt(1.0 - 0.6144258616235123 * 0.6144258616235123 - 0.3970397446872839 * 0.3970397446872839), 0.0002293268499615575, OhPointGen::points_48},
+            {0.2951676508064861, 0.02867499538750441, constexpr_sqrt(1.0 - 0.2951676508064861 * 0.2951676508064861 - 0.02867499538750441 * 0.02867499538750441), 0.0001912628201529828, OhPointGen::points_48},
+            {0.3335085485472725, 0.0586787934190351, constexpr_sqrt(1.0 - 0.3335085485472725 * 0.3335085485472725 - 0.0586787934190351 * 0.0586787934190351), 0.0001992499672238701, OhPointGen::points_48},
+            {0.3709561760636381, 0.08961099205022284, constexpr_sqrt(1.0 - 0.3709561760636381 * 0.3709561760636381 - 0.08961099205022284 * 0.08961099205022284), 0.0002061275533454027, OhPointGen::points_48},
+            {0.4074722861667498, 0.1211627927626297, constexpr_sqrt(1.0 - 0.4074722861667498 * 0.4074722861667498 - 0.1211627927626297 * 0.1211627927626297), 0.0002119318215968572, OhPointGen::points_48},
+            {0.4429923648839117, 0.1530748903554898, constexpr_sqrt(1.0 - 0.4429923648839117 * 0.4429923648839117 - 0.1530748903554898 * 0.1530748903554898), 0.0002167416581882652, OhPointGen::points_48},
+            {0.4774428052721736, 0.1851176436721877, constexpr_sqrt(1.0 - 0.4774428052721736 * 0.4774428052721736 - 0.1851176436721877 * 0.1851176436721877), 0.00022064307305166, OhPointGen::points_48},
+            {0.5107446539535904, 0.2170829107658179, constexpr_sqrt(1.0 - 0.5107446539535904 * 0.5107446539535904 - 0.2170829107658179 * 0.2170829107658179), 0.0002237186938699523, OhPointGen::points_48},
+            {0.5428151370542935, 0.2487786689026271, constexpr_sqrt(1.0 - 0.5428151370542935 * 0.5428151370542935 - 0.2487786689026271 * 0.2487786689026271), 0.0002260480075032884, OhPointGen::points_48},
+            {0.5735699292556964, 0.2800239952795016, constexpr_sqrt(1.0 - 0.5735699292556964 * 0.5735699292556964 - 0.2800239952795016 * 0.2800239952795016), 0.0002277098884558542, OhPointGen::points_48},
+            {0.6029253794562865, 0.3106445702878119, constexpr_sqrt(1.0 - 0.6029253794562865 * 0.6029253794562865 - 0.3106445702878119 * 0.3106445702878119), 0.0002287845715109671, OhPointGen::points_48},
+            {0.6307998987073145, 0.3404689500841194, constexpr_sqrt(1.0 - 0.6307998987073145 * 0.6307998987073145 - 0.3404689500841194 * 0.3404689500841194), 0.0002293547268236294, OhPointGen::points_48},
+            {0.3752652273692719, 0.02997145098184479, constexpr_sqrt(1.0 - 0.3752652273692719 * 0.3752652273692719 - 0.02997145098184479 * 0.02997145098184479), 0.0002056073839852528, OhPointGen::points_48},
+            {0.4135383879344028, 0.06086725898678011, constexpr_sqrt(1.0 - 0.4135383879344028 * 0.4135383879344028 - 0.06086725898678011 * 0.06086725898678011), 0.0002114235865831876, OhPointGen::points_48},
+            {0.4506113885153907, 0.09238849548435644, constexpr_sqrt(1.0 - 0.4506113885153907 * 0.4506113885153907 - 0.09238849548435644 * 0.09238849548435644), 0.0002163175629770551, OhPointGen::points_48},
+            {0.4864401554606072, 0.1242786603851851, constexpr_sqrt(1.0 - 0.4864401554606072 * 0.4864401554606072 - 0.1242786603851851 * 0.1242786603851851), 0.000220339215811165, OhPointGen::points_48},
+            {0.5209708076611709, 0.1563086731483386, constexpr_sqrt(1.0 - 0.5209708076611709 * 0.5209708076611709 - 0.1563086731483386 * 0.1563086731483386), 0.0002235473176847839, OhPointGen::points_48},
+            {0.5541422135830122, 0.1882696509388506, constexpr_sqrt(1.0 - 0.5541422135830122 * 0.5541422135830122 - 0.1882696509388506 * 0.1882696509388506), 0.0002260024141501235, OhPointGen::points_48},
+            {0.5858880915113817, 0.2199672979126059, constexpr_sqrt(1.0 - 0.5858880915113817 * 0.5858880915113817 - 0.2199672979126059 * 0.2199672979126059), 0.0002277675929329182, OhPointGen::points_48},
+            {0.6161399390603444, 0.2512165482924867, constexpr_sqrt(1.0 - 0.6161399390603444 * 0.6161399390603444 - 0.2512165482924867 * 0.2512165482924867), 0.0002289102112284834, OhPointGen::points_48},
+            {0.644829648225509, 0.2818368701871888, constexpr_sqrt(1.0 - 0.644829648225509 * 0.644829648225509 - 0.2818368701871888 * 0.2818368701871888), 0.0002295027954625118, OhPointGen::points_48},
+            {0.4544796274917948, 0.03088970405060312, constexpr_sqrt(1.0 - 0.4544796274917948 * 0.4544796274917948 - 0.03088970405060312 * 0.03088970405060312), 0.0002161281589879992, OhPointGen::points_48},
+            {0.4919389072146628, 0.06240947677636835, constexpr_sqrt(1.0 - 0.4919389072146628 * 0.4919389072146628 - 0.06240947677636835 * 0.06240947677636835), 0.0002201980477395102, OhPointGen::points_48},
+            {0.5279313026985183, 0.09430706144280313, constexpr_sqrt(1.0 - 0.5279313026985183 * 0.5279313026985183 - 0.09430706144280313 * 0.09430706144280313), 0.0002234952066593166, OhPointGen::points_48},
+            {0.5624169925571135, 0.1263547818770374, constexpr_sqrt(1.0 - 0.5624169925571135 * 0.5624169925571135 - 0.1263547818770374 * 0.1263547818770374), 0.0002260540098520838, OhPointGen::points_48},
+            {0.5953484627093287, 0.1583430788822594, constexpr_sqrt(1.0 - 0.5953484627093287 * 0.5953484627093287 - 0.1583430788822594 * 0.1583430788822594), 0.0002279157981899988, OhPointGen::points_48},
+            {0.6266730715339185, 0.1900748462555988, constexpr_sqrt(1.0 - 0.6266730715339185 * 0.6266730715339185 - 0.1900748462555988 * 0.1900748462555988), 0.0002291296918565571, OhPointGen::points_48},
+            {0.6563363204278871, 0.2213599519592567, constexpr_sqrt(1.0 - 0.6563363204278871 * 0.6563363204278871 - 0.2213599519592567 * 0.2213599519592567), 0.0002297533752536649, OhPointGen::points_48},
+            {0.5314574716585696, 0.03152508811515374, constexpr_sqrt(1.0 - 0.5314574716585696 * 0.5314574716585696 - 0.03152508811515374 * 0.03152508811515374), 0.0002234927356465995, OhPointGen::points_48},
+            {0.5674614932298185, 0.06343865291465561, constexpr_sqrt(1.0 - 0.5674614932298185 * 0.5674614932298185 - 0.06343865291465561 * 0.06343865291465561), 0.0002261288012985219, OhPointGen::points_48},
+            {0.6017706004970264, 0.09551503504223952, constexpr_sqrt(1.0 - 0.6017706004970264 * 0.6017706004970264 - 0.09551503504223952 * 0.09551503504223952), 0.0002280818160923688, OhPointGen::points_48},
+            {0.6343471270264178, 0.1275440099801196, constexpr_sqrt(1.0 - 0.6343471270264178 * 0.6343471270264178 - 0.1275440099801196 * 0.1275440099801196), 0.0002293773295180159, OhPointGen::points_48},
+            {0.6651494599127802, 0.159325203767196, constexpr_sqrt(1.0 - 0.6651494599127802 * 0.6651494599127802 - 0.159325203767196 * 0.159325203767196), 0.0002300528767338634, OhPointGen::points_48},
+            {0.6050184986005704, 0.03192538338496105, constexpr_sqrt(1.0 - 0.6050184986005704 * 0.6050184986005704 - 0.03192538338496105 * 0.03192538338496105), 0.0002281893855065666, OhPointGen::points_48},
+            {0.63901635508804, 0.06402824353962305, constexpr_sqrt(1.0 - 0.63901635508804 * 0.63901635508804 - 0.06402824353962305 * 0.06402824353962305), 0.0002295720444840727, OhPointGen::points_48},
+            {0.6711199107088448, 0.09609805077002909, constexpr_sqrt(1.0 - 0.6711199107088448 * 0.6711199107088448 - 0.09609805077002909 * 0.09609805077002909), 0.0002303227649026753, OhPointGen::points_48},
+            {0.6741354429572275, 0.03211853196273233, constexpr_sqrt(1.0 - 0.6741354429572275 * 0.6741354429572275 - 0.03211853196273233 * 0.03211853196273233), 0.0002304831913227114, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
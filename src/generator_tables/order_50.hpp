@@ -0,0 +1,29 @@
+#ifndef GENERATOR_TABLE_ORDER_50_HPP
+#define GENERATOR_TABLE_ORDER_50_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_50>
+{
+    static constexpr std::array<GeneratorPoint, 4> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.0126984126984127, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.02257495590828924, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.02109375, OhPointGen::points_8},
+            {0.3015113445777636, constexpr_sqrt(1.0 - 2.0 * 0.3015113445777636 * 0.3015113445777636), 0.0, 0.02017333553791887, OhPointGen::points_24}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
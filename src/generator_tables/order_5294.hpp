@@ -0,0 +1,157 @@
+#ifndef GENERATOR_TABLE_ORDER_5294_HPP
+#define GENERATOR_TABLE_ORDER_5294_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_5294>
+{
+    static constexpr std::array<GeneratorPoint, 132> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 9.080510764308165e-05, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.0002084824361987793, OhPointGen::points_8},
+            {0.0230326168626145, constexpr_sqrt(1.0 - 2.0 * 0.0230326168626145 * 0.0230326168626145), 0.0, 5.011105657239616e-05, OhPointGen::points_24},
+            {0.03757208620162394, constexpr_sqrt(1.0 - 2.0 * 0.03757208620162394 * 0.03757208620162394), 0.0, 5.942520409683854e-05, OhPointGen::points_24},
+            {0.05821912033821852, constexpr_sqrt(1.0 - 2.0 * 0.05821912033821852 * 0.05821912033821852), 0.0, 9.56439482610972e-05, OhPointGen::points_24},
+            {0.08403127529194872, constexpr_sqrt(1.0 - 2.0 * 0.08403127529194872 * 0.08403127529194872), 0.0, 0.0001185530657126338, OhPointGen::points_24},
+            {0.1122927798060578, constexpr_sqrt(1.0 - 2.0 * 0.1122927798060578 * 0.1122927798060578), 0.0, 0.0001364510114230331, OhPointGen::points_24},
+            {0.1420125319192987, constexpr_sqrt(1.0 - 2.0 * 0.1420125319192987 * 0.1420125319192987), 0.0, 0.0001505828825605415, OhPointGen::points_24},
+            {0.1726396437341978, constexpr_sqrt(1.0 - 2.0 * 0.1726396437341978 * 0.1726396437341978), 0.0, 0.0001619298749867023, OhPointGen::points_24},
+            {0.2038170058115696, constexpr_sqrt(1.0 - 2.0 * 0.2038170058115696 * 0.2038170058115696), 0.0, 0.0001712450504267789, OhPointGen::points_24},
+            {0.2352849892876508, constexpr_sqrt(1.0 - 2.0 * 0.2352849892876508 * 0.2352849892876508), 0.0, 0.0001789891098164999, OhPointGen::points_24},
+            {0.2668363354312461, constexpr_sqrt(1.0 - 2.0 * 0.2668363354312461 * 0.2668363354312461), 0.0, 0.0001854474955629795, OhPointGen::points_24},
+            {0.2982941279900452, constexpr_sqrt(1.0 - 2.0 * 0.2982941279900452 * 0.2982941279900452), 0.0, 0.0001908148636673661, OhPointGen::points_24},
+            {0.3295002922087076, constexpr_sqrt(1.0 - 2.0 * 0.3295002922087076 * 0.3295002922087076), 0.0, 0.0001952377405281833, OhPointGen::points_24},
+            {0.3603094918363593, constexpr_sqrt(1.0 - 2.0 * 0.3603094918363593 * 0.3603094918363593), 0.0, 0.0001988349254282232, OhPointGen::points_24},
+            {0.390585789517392, constexpr_sqrt(1.0 - 2.0 * 0.390585789517392 * 0.390585789517392), 0.0, 0.000201707980716005, OhPointGen::points_24},
+            {0.4202005758160837, constexpr_sqrt(1.0 - 2.0 * 0.4202005758160837 * 0.4202005758160837), 0.0, 0.0002039473082709094, OhPointGen::points_24},
+            {0.4490310061597227, constexpr_sqrt(1.0 - 2.0 * 0.4490310061597227 * 0.4490310061597227), 0.0, 0.0002056360279288953, OhPointGen::points_24},
+            {0.4769586160311491, constexpr_sqrt(1.0 - 2.0 * 0.4769586160311491 * 0.4769586160311491), 0.0, 0.0002068525823066865, OhPointGen::points_24},
+            {0.503867988704975, constexpr_sqrt(1.0 - 2.0 * 0.503867988704975 * 0.503867988704975), 0.0, 0.0002076724877534488, OhPointGen::points_24},
+            {0.5296454286519962, constexpr_sqrt(1.0 - 2.0 * 0.5296454286519962 * 0.5296454286519962), 0.0, 0.0002081694278237885, OhPointGen::points_24},
+            {0.554177620716485, constexpr_sqrt(1.0 - 2.0 * 0.554177620716485 * 0.554177620716485), 0.0, 0.0002084157631219326, OhPointGen::points_24},
+            {0.5990467321921213, constexpr_sqrt(1.0 - 2.0 * 0.5990467321921213 * 0.5990467321921213), 0.0, 0.0002084381531128593, OhPointGen::points_24},
+            {0.6191467096294587, constexpr_sqrt(1.0 - 2.0 * 0.6191467096294587 * 0.6191467096294587), 0.0, 0.0002083476277129307, OhPointGen::points_24},
+            {0.6375251212901849, constexpr_sqrt(1.0 - 2.0 * 0.6375251212901849 * 0.6375251212901849), 0.0, 0.0002082686194459732, OhPointGen::points_24},
+            {0.6540514381131168, constexpr_sqrt(1.0 - 2.0 * 0.6540514381131168 * 0.6540514381131168), 0.0, 0.0002082475686112415, OhPointGen::points_24},
+            {0.668589906439151, constexpr_sqrt(1.0 - 2.0 * 0.668589906439151 * 0.668589906439151), 0.0, 0.0002083139860289915, OhPointGen::points_24},
+            {0.6810013009681648, constexpr_sqrt(1.0 - 2.0 * 0.6810013009681648 * 0.6810013009681648), 0.0, 0.0002084745561831237, OhPointGen::points_24},
+            {0.691146957873034, constexpr_sqrt(1.0 - 2.0 * 0.691146957873034 * 0.691146957873034), 0.0, 0.000208709131337589, OhPointGen::points_24},
+            {0.6988956915141736, constexpr_sqrt(1.0 - 2.0 * 0.6988956915141736 * 0.6988956915141736), 0.0, 0.0002089718413297697, OhPointGen::points_24},
+            {0.704133579486872, constexpr_sqrt(1.0 - 2.0 * 0.704133579486872 * 0.704133579486872), 0.0, 0.0002092003303479793, OhPointGen::points_24},
+            {0.7067754398018568, constexpr_sqrt(1.0 - 2.0 * 0.7067754398018568 * 0.7067754398018568), 0.0, 0.0002093336148263241, OhPointGen::points_24},
+            {0.03840368707853623, constexpr_sqrt(1.0 - 0.03840368707853623 * 0.03840368707853623), 0.0, 7.591708117365266e-05, OhPointGen::points_24_axis},
+            {0.098354859541174, constexpr_sqrt(1.0 - 0.098354859541174 * 0.098354859541174), 0.0, 0.0001083383968169186, OhPointGen::points_24_axis},
+            {0.1665774947612998, constexpr_sqrt(1.0 - 0.1665774947612998 * 0.1665774947612998), 0.0, 0.000140301939529251, OhPointGen::points_24_axis},
+            {0.240570233536291, constexpr_sqrt(1.0 - 0.240570233536291 * 0.240570233536291), 0.0, 0.0001615970179286436, OhPointGen::points_24_axis},
+            {0.3165270770189046, constexpr_sqrt(1.0 - 0.3165270770189046 * 0.3165270770189046), 0.0, 0.0001771144187504911, OhPointGen::points_24_axis},
+            {0.3927386145645443, constexpr_sqrt(1.0 - 0.3927386145645443 * 0.3927386145645443), 0.0, 0.0001887760022988168, OhPointGen::points_24_axis},
+            {0.4678825918374656, constexpr_sqrt(1.0 - 0.4678825918374656 * 0.4678825918374656), 0.0, 0.0001973474670768214, OhPointGen::points_24_axis},
+            {0.5408022024266935, constexpr_sqrt(1.0 - 0.5408022024266935 * 0.5408022024266935), 0.0, 0.0002033787661234659, OhPointGen::points_24_axis},
+            {0.6104967445752438, constexpr_sqrt(1.0 - 0.6104967445752438 * 0.6104967445752438), 0.0, 0.0002072343626517331, OhPointGen::points_24_axis},
+            {0.6760910702685738, constexpr_sqrt(1.0 - 0.6760910702685738 * 0.6760910702685738), 0.0, 0.0002091177834226918, OhPointGen::points_24_axis},
+            {0.06655644120217392, 0.01936508874588424, constexpr_sqrt(1.0 - 0.06655644120217392 * 0.06655644120217392 - 0.01936508874588424 * 0.01936508874588424), 9.316684484675566e-05, OhPointGen::points_48},
+            {0.09446246161270182, 0.04252442002115869, constexpr_sqrt(1.0 - 0.09446246161270182 * 0.09446246161270182 - 0.04252442002115869 * 0.04252442002115869), 0.0001116193688682976, OhPointGen::points_48},
+            {0.1242651925452509, 0.06806529315354375, constexpr_sqrt(1.0 - 0.1242651925452509 * 0.1242651925452509 - 0.06806529315354375 * 0.06806529315354375), 0.0001298623551559414, OhPointGen::points_48},
+            {0.1553438064846751, 0.09560957491205369, constexpr_sqrt(1.0 - 0.1553438064846751 * 0.1553438064846751 - 0.09560957491205369 * 0.09560957491205369), 0.0001450236832456426, OhPointGen::points_48},
+            {0.187113711054267, 0.1245931657452888, constexpr_sqrt(1.0 - 0.187113711054267 * 0.187113711054267 - 0.1245931657452888 * 0.1245931657452888), 0.0001572719958149914, OhPointGen::points_48},
+            {0.2192612628836257, 0.1545385828778978, constexpr_sqrt(1.0 - 0.2192612628836257 * 0.2192612628836257 - 0.1545385828778978 * 0.1545385828778978), 0.0001673234785867195, OhPointGen::points_48},
+            {0.2515682807206955, 0.1851004249723368, constexpr_sqrt(1.0 - 0.2515682807206955 * 0.2515682807206955 - 0.1851004249723368 * 0.1851004249723368), 0.0001756860118725188, OhPointGen::points_48},
+            {0.283853586628729, 0.2160182608272384, constexpr_sqrt(1.0 - 0.283853586628729 * 0.283853586628729 - 0.2160182608272384 * 0.2160182608272384), 0.0001826776290439367, OhPointGen::points_48},
+            {0.3159578817528521, 0.2470799012277111, constexpr_sqrt(1.0 - 0.3159578817528521 * 0.3159578817528521 - 0.2470799012277111 * 0.2470799012277111), 0.0001885116347992865, OhPointGen::points_48},
+            {0.3477370882791392, 0.2781014208986402, constexpr_sqrt(1.0 - 0.3477370882791392 * 0.3477370882791392 - 0.2781014208986402 * 0.2781014208986402), 0.0001933457860170574, OhPointGen::points_48},
+            {0.379057696089054, 0.3089172523515731, constexpr_sqrt(1.0 - 0.379057696089054 * 0.379057696089054 - 0.3089172523515731 * 0.3089172523515731), 0.0001973060671902064, OhPointGen::points_48},
+            {0.40979383178102, 0.3393750055472244, constexpr_sqrt(1.0 - 0.40979383178102 * 0.40979383178102 - 0.3393750055472244 * 0.3393750055472244), 0.0002004987099616311, OhPointGen::points_48},
+            {0.4398256572859637, 0.369332247098773, constexpr_sqrt(1.0 - 0.4398256572859637 * 0.4398256572859637 - 0.369332247098773 * 0.369332247098773), 0.0002030170909281499, OhPointGen::points_48},
+            {0.469038411471848, 0.3986541005609877, constexpr_sqrt(1.0 - 0.469038411471848 * 0.469038411471848 - 0.3986541005609877 * 0.3986541005609877), 0.000204946146011908, OhPointGen::points_48},
+            {0.4973216048301053, 0.4272112491408562, constexpr_sqrt(1.0 - 0.4973216048301053 * 0.4973216048301053 - 0.4272112491408562 * 0.4272112491408562), 0.0002063653565200186, OhPointGen::points_48},
+            {0.5245681526132446, 0.4548781735309936, constexpr_sqrt(1.0 - 0.5245681526132446 * 0.5245681526132446 - 0.4548781735309936 * 0.4548781735309936), 0.0002073507927381027, OhPointGen::points_48},
+            {0.5506733911803888, 0.4815315355023251, constexpr_sqrt(1.0 - 0.5506733911803888 * 0.5506733911803888 - 0.4815315355023251 * 0.4815315355023251), 0.0002079764593256122, OhPointGen::points_48},
+            {0.5755339829522474, 0.5070486445801855, constexpr_sqrt(1.0 - 0.5755339829522474 * 0.5755339829522474 - 0.5070486445801855 * 0.5070486445801855), 0.0002083150534968778, OhPointGen::points_48},
+            {0.1305472386056362, 0.02284970375722366, constexpr_sqrt(1.0 - 0.1305472386056362 * 0.1305472386056362 - 0.02284970375722366 * 0.02284970375722366), 0.0001262715121590664, OhPointGen::points_48},
+            {0.1637327908216477, 0.04812254338288384, constexpr_sqrt(1.0 - 0.1637327908216477 * 0.1637327908216477 - 0.04812254338288384 * 0.04812254338288384), 0.0001414386128545972, OhPointGen::points_48},
+            {0.1972734634149637, 0.07531734457511935, constexpr_sqrt(1.0 - 0.1972734634149637 * 0.1972734634149637 - 0.07531734457511935 * 0.07531734457511935), 0.0001538740401313898, OhPointGen::points_48},
+            {0.230869465311013, 0.1039043639882017, constexpr_sqrt(1.0 - 0.230869465311013 * 0.230869465311013 - 0.1039043639882017 * 0.1039043639882017), 0.0001642434942331432, OhPointGen::points_48},
+            {0.264389921833816, 0.1334526587117626, constexpr_sqrt(1.0 - 0.264389921833816 * 0.264389921833816 - 0.1334526587117626 * 0.1334526587117626), 0.0001729790609237496, OhPointGen::points_48},
+            {0.2977171599622171, 0.1636414868936382, constexpr_sqrt(1.0 - 0.2977171599622171 * 0.2977171599622171 - 0.1636414868936382 * 0.1636414868936382), 0.0001803505190260828, OhPointGen::points_48},
+            {0.330729390303231, 0.1942195406166568, constexpr_sqrt(1.0 - 0.330729390303231 * 0.330729390303231 - 0.1942195406166568 * 0.1942195406166568), 0.0001865475350079657, OhPointGen::points_48},
+            {0.3633069198219073, 0.2249752879943753, constexpr_sqrt(1.0 - 0.3633069198219073 * 0.3633069198219073 - 0.2249752879943753 * 0.2249752879943753), 0.0001917182669679069, OhPointGen::points_48},
+            {0.3953346955922727, 0.2557218821820032, constexpr_sqrt(1.0 - 0.3953346955922727 * 0.3953346955922727 - 0.2557218821820032 * 0.2557218821820032), 0.0001959851709034382, OhPointGen::points_48},
+            {0.4267018394184914, 0.2862897925213193, constexpr_sqrt(1.0 - 0.4267018394184914 * 0.4267018394184914 - 0.2862897925213193 * 0.2862897925213193), 0.0001994529548117882, OhPointGen::points_48},
+            {0.4573009622571704, 0.3165224536636518, constexpr_sqrt(1.0 - 0.4573009622571704 * 0.4573009622571704 - 0.3165224536636518 * 0.3165224536636518), 0.0002022138911146548, OhPointGen::points_48},
+            {0.4870279559856109, 0.3462730221636496, constexpr_sqrt(1.0 - 0.4870279559856109 * 0.4870279559856109 - 0.3462730221636496 * 0.3462730221636496), 0.0002043518024208592, OhPointGen::points_48},
+            {0.5157819581450322, 0.3754016870282835, constexpr_sqrt(1.0 - 0.5157819581450322 * 0.5157819581450322 - 0.3754016870282835 * 0.3754016870282835), 0.000205945031301811, OhPointGen::points_48},
+            {0.5434651666465393, 0.4037733784993613, constexpr_sqrt(1.0 - 0.5434651666465393 * 0.5434651666465393 - 0.4037733784993613 * 0.4037733784993613), 0.0002070685715318472, OhPointGen::points_48},
+            {0.5699823887764627, 0.4312557784139123, constexpr_sqrt(1.0 - 0.5699823887764627 * 0.5699823887764627 - 0.4312557784139123 * 0.4312557784139123), 0.0002077955310694373, OhPointGen::points_48},
+            {0.5952403350947741, 0.457717536712211, constexpr_sqrt(1.0 - 0.5952403350947741 * 0.5952403350947741 - 0.457717536712211 * 0.457717536712211), 0.0002081980387824712, OhPointGen::points_48},
+            {0.2025152599210369, 0.02520253617719557, constexpr_sqrt(1.0 - 0.2025152599210369 * 0.2025152599210369 - 0.02520253617719557 * 0.02520253617719557), 0.0001521318610377956, OhPointGen::points_48},
+            {0.2381066653274425, 0.05223254506119, constexpr_sqrt(1.0 - 0.2381066653274425 * 0.2381066653274425 - 0.05223254506119 * 0.05223254506119), 0.0001622772720185755, OhPointGen::points_48},
+            {0.2732823383651612, 0.0806066968858862, constexpr_sqrt(1.0 - 0.2732823383651612 * 0.2732823383651612 - 0.0806066968858862 * 0.0806066968858862), 0.0001710498139420709, OhPointGen::points_48},
+            {0.3080137692611118, 0.1099335754081255, constexpr_sqrt(1.0 - 0.3080137692611118 * 0.3080137692611118 - 0.1099335754081255 * 0.1099335754081255), 0.0001785911149448736, OhPointGen::points_48},
+            {0.3422405614587601, 0.1399120955959857, constexpr_sqrt(1.0 - 0.3422405614587601 * 0.3422405614587601 - 0.1399120955959857 * 0.1399120955959857), 0.0001850125313687736, OhPointGen::points_48},
+            {0.375880877389042, 0.1702977801651705, constexpr_sqrt(1.0 - 0.375880877389042 * 0.375880877389042 - 0.1702977801651705 * 0.1702977801651705), 0.0001904229703933298, OhPointGen::points_48},
+            {0.4088458383438932, 0.200879925660168, constexpr_sqrt(1.0 - 0.4088458383438932 * 0.4088458383438932 - 0.200879925660168 * 0.200879925660168), 0.0001949259956121987, OhPointGen::points_48},
+            {0.4410450550841152, 0.2314703052180836, constexpr_sqrt(1.0 - 0.4410450550841152 * 0.4410450550841152 - 0.2314703052180836 * 0.2314703052180836), 0.000198616154536396, OhPointGen::points_48},
+            {0.4723879420561312, 0.2618972111375892, constexpr_sqrt(1.0 - 0.4723879420561312 * 0.4723879420561312 - 0.2618972111375892 * 0.2618972111375892), 0.000201579058564137, OhPointGen::points_48},
+            {0.5027843561874343, 0.292001319560027, constexpr_sqrt(1.0 - 0.5027843561874343 * 0.5027843561874343 - 0.292001319560027 * 0.292001319560027), 0.0002038934198707418, OhPointGen::points_48},
+            {0.5321453674452458, 0.3216322555190551, constexpr_sqrt(1.0 - 0.5321453674452458 * 0.5321453674452458 - 0.3216322555190551 * 0.3216322555190551), 0.0002056334060538251, OhPointGen::points_48},
+            {0.560383911383403, 0.3506456615934198, constexpr_sqrt(1.0 - 0.560383911383403 * 0.560383911383403 - 0.3506456615934198 * 0.3506456615934198), 0.0002068705959462289, OhPointGen::points_48},
+            {0.5874150706875146, 0.3789007181306267, constexpr_sqrt(1.0 - 0.5874150706875146 * 0.5874150706875146 - 0.3789007181306267 * 0.3789007181306267), 0.0002076753906106002, OhPointGen::points_48},
+            {0.6131559381660038, 0.4062580170572782, constexpr_sqrt(1.0 - 0.6131559381660038 * 0.6131559381660038 - 0.4062580170572782 * 0.4062580170572782), 0.0002081179391734803, OhPointGen::points_48},
+            {0.2778497016394506, 0.02696271276876226, constexpr_sqrt(1.0 - 0.2778497016394506 * 0.2778497016394506 - 0.02696271276876226 * 0.02696271276876226), 0.0001700345216228943, OhPointGen::points_48},
+            {0.3143733562261912, 0.05523469316960465, constexpr_sqrt(1.0 - 0.3143733562261912 * 0.3143733562261912 - 0.05523469316960465 * 0.05523469316960465), 0.000177490677999041, OhPointGen::points_48},
+            {0.3501485810261827, 0.08445193201626464, constexpr_sqrt(1.0 - 0.3501485810261827 * 0.3501485810261827 - 0.08445193201626464 * 0.08445193201626464), 0.0001839659377002642, OhPointGen::points_48},
+            {0.3851430322303653, 0.1143263119336083, constexpr_sqrt(1.0 - 0.3851430322303653 * 0.3851430322303653 - 0.1143263119336083 * 0.1143263119336083), 0.0001894987462975169, OhPointGen::points_48},
+            {0.4193013979470415, 0.1446177898344475, constexpr_sqrt(1.0 - 0.4193013979470415 * 0.4193013979470415 - 0.1446177898344475 * 0.1446177898344475), 0.0001941548809452595, OhPointGen::points_48},
+            {0.4525585960458567, 0.1751165438438091, constexpr_sqrt(1.0 - 0.4525585960458567 * 0.4525585960458567 - 0.1751165438438091 * 0.1751165438438091), 0.0001980078427252384, OhPointGen::points_48},
+            {0.4848447779622947, 0.205633830674566, constexpr_sqrt(1.0 - 0.4848447779622947 * 0.4848447779622947 - 0.205633830674566 * 0.205633830674566), 0.0002011296284744488, OhPointGen::points_48},
+            {0.5160871208276894, 0.2359965487229226, constexpr_sqrt(1.0 - 0.5160871208276894 * 0.5160871208276894 - 0.2359965487229226 * 0.2359965487229226), 0.0002035888456966776, OhPointGen::points_48},
+            {0.5462112185696926, 0.2660430223139146, constexpr_sqrt(1.0 - 0.5462112185696926 * 0.5462112185696926 - 0.2660430223139146 * 0.2660430223139146), 0.0002054516325352142, OhPointGen::points_48},
+            {0.5751425068101756, 0.2956193664498032, constexpr_sqrt(1.0 - 0.5751425068101756 * 0.5751425068101756 - 0.2956193664498032 * 0.2956193664498032), 0.0002067831033092635, OhPointGen::points_48},
+            {0.6028073872853597, 0.3245763905312779, constexpr_sqrt(1.0 - 0.6028073872853597 * 0.6028073872853597 - 0.3245763905312779 * 0.3245763905312779), 0.0002076485320284876, OhPointGen::points_48},
+            {0.6291338275278409, 0.3527670026206972, constexpr_sqrt(1.0 - 0.6291338275278409 * 0.6291338275278409 - 0.3527670026206972 * 0.3527670026206972), 0.0002081141439525255, OhPointGen::points_48},
+            {0.3541797528439391, 0.0282385347943555, constexpr_sqrt(1.0 - 0.3541797528439391 * 0.3541797528439391 - 0.0282385347943555 * 0.0282385347943555), 0.0001834383015469222, OhPointGen::points_48},
+            {0.3908234972074657, 0.05741296374713106, constexpr_sqrt(1.0 - 0.3908234972074657 * 0.3908234972074657 - 0.05741296374713106 * 0.05741296374713106), 0.0001889540591777677, OhPointGen::points_48},
+            {0.426440845010759, 0.08724646633650199, constexpr_sqrt(1.0 - 0.426440845010759 * 0.426440845010759 - 0.08724646633650199 * 0.08724646633650199), 0.0001936677023597375, OhPointGen::points_48},
+            {0.4609949666553286, 0.1175034422915616, constexpr_sqrt(1.0 - 0.4609949666553286 * 0.4609949666553286 - 0.1175034422915616 * 0.1175034422915616), 0.0001976176495066504, OhPointGen::points_48},
+            {0.4944389496536006, 0.1479755652628428, constexpr_sqrt(1.0 - 0.4944389496536006 * 0.4944389496536006 - 0.1479755652628428 * 0.1479755652628428), 0.0002008536004560983, OhPointGen::points_48},
+            {0.5267194884346086, 0.1784740659484352, constexpr_sqrt(1.0 - 0.5267194884346086 * 0.5267194884346086 - 0.1784740659484352 * 0.1784740659484352), 0.0002034280351712291, OhPointGen::points_48},
+            {0.557778781022099, 0.2088245700431244, constexpr_sqrt(1.0 - 0.557778781022099 * 0.557778781022099 - 0.2088245700431244 * 0.2088245700431244), 0.0002053944466027758, OhPointGen::points_48},
+            {0.587556376353667, 0.2388628136570763, constexpr_sqrt(1.0 - 0.587556376353667 * 0.587556376353667 - 0.2388628136570763 * 0.2388628136570763), 0.000206807764288236, OhPointGen::points_48},
+            {0.6159910016391269, 0.2684308928769185, constexpr_sqrt(1.0 - 0.6159910016391269 * 0.6159910016391269 - 0.2684308928769185 * 0.2684308928769185), 0.0002077250949661599, OhPointGen::points_48},
+            {0.6430219602956267, 0.2973740761960252, constexpr_sqrt(1.0 - 0.6430219602956267 * 0.6430219602956267 - 0.2973740761960252 * 0.2973740761960252), 0.000208206244070532, OhPointGen::points_48},
+            {0.4300647036213646, 0.02916399920493977, constexpr_sqrt(1.0 - 0.4300647036213646 * 0.4300647036213646 - 0.02916399920493977 * 0.02916399920493977), 0.0001934374486546626, OhPointGen::points_48},
+            {0.4661486308935531, 0.05898803024755659, constexpr_sqrt(1.0 - 0.4661486308935531 * 0.4661486308935531 - 0.05898803024755659 * 0.05898803024755659), 0.00019741070104843, OhPointGen::points_48},
+            {0.5009658555287261, 0.08924162698525409, constexpr_sqrt(1.0 - 0.5009658555287261 * 0.5009658555287261 - 0.08924162698525409 * 0.08924162698525409), 0.0002007129290388658, OhPointGen::points_48},
+            {0.5344824270447704, 0.1197185199637321, constexpr_sqrt(1.0 - 0.5344824270447704 * 0.5344824270447704 - 0.1197185199637321 * 0.1197185199637321), 0.0002033736947471293, OhPointGen::points_48},
+            {0.5666575997416371, 0.1502300756161382, constexpr_sqrt(1.0 - 0.5666575997416371 * 0.5666575997416371 - 0.1502300756161382 * 0.1502300756161382), 0.0002054287125902493, OhPointGen::points_48},
+            {0.5974457471404752, 0.1806004191913564, constexpr_sqrt(1.0 - 0.5974457471404752 * 0.5974457471404752 - 0.1806004191913564 * 0.1806004191913564), 0.0002069184936818894, OhPointGen::points_48},
+            {0.6267984444116886, 0.2106621764786252, constexpr_sqrt(1.0 - 0.6267984444116886 * 0.6267984444116886 - 0.2106621764786252 * 0.2106621764786252), 0.0002078883689808782, OhPointGen::points_48},
+            {0.6546664713575417, 0.2402526932671914, constexpr_sqrt(1.0 - 0.6546664713575417 * 0.6546664713575417 - 0.2402526932671914 * 0.2402526932671914), 0.0002083886366116359, OhPointGen::points_48},
+            {0.5042711004437253, 0.02982529203607657, constexpr_sqrt(1.0 - 0.5042711004437253 * 0.5042711004437253 - 0.02982529203607657 * 0.02982529203607657), 0.0002006593275470817, OhPointGen::points_48},
+            {0.539212745677438, 0.06008728062339922, constexpr_sqrt(1.0 - 0.539212745677438 * 0.539212745677438 - 0.06008728062339922 * 0.06008728062339922), 0.0002033728426135397, OhPointGen::points_48},
+            {0.5726819437668618, 0.09058227674571398, constexpr_sqrt(1.0 - 0.5726819437668618 * 0.5726819437668618 - 0.09058227674571398 * 0.09058227674571398), 0.0002055008781377608, OhPointGen::points_48},
+            {0.6046469254207278, 0.12112192358034, constexpr_sqrt(1.0 - 0.6046469254207278 * 0.6046469254207278 - 0.12112192358034 * 0.12112192358034), 0.0002070651783518502, OhPointGen::points_48},
+            {0.6350716157434952, 0.151528640479158, constexpr_sqrt(1.0 - 0.6350716157434952 * 0.6350716157434952 - 0.151528640479158 * 0.151528640479158), 0.000208095333509432, OhPointGen::points_48},
+            {0.6639177679185454, 0.1816314681255552, constexpr_sqrt(1.0 - 0.6639177679185454 * 0.6639177679185454 - 0.1816314681255552 * 0.1816314681255552), 0.0002086284998988521, OhPointGen::points_48},
+            {0.5757276040972253, 0.0302699175257544, constexpr_sqrt(1.0 - 0.5757276040972253 * 0.5757276040972253 - 0.0302699175257544 * 0.0302699175257544), 0.0002055549387644668, OhPointGen::points_48},
+            {0.6090265823139756, 0.0607840229787077, constexpr_sqrt(1.0 - 0.6090265823139756 * 0.6090265823139756 - 0.0607840229787077 * 0.0607840229787077), 0.0002071871850267654, OhPointGen::points_48},
+            {0.6406735344387661, 0.09135459984176636, constexpr_sqrt(1.0 - 0.6406735344387661 * 0.6406735344387661 - 0.09135459984176636 * 0.09135459984176636), 0.0002082856600431965, OhPointGen::points_48},
+            {0.6706397927793709, 0.121802415596659, constexpr_sqrt(1.0 - 0.6706397927793709 * 0.6706397927793709 - 0.121802415596659 * 0.121802415596659), 0.0002088705858819358, OhPointGen::points_48},
+            {0.6435019674426665, 0.03052608357660639, constexpr_sqrt(1.0 - 0.6435019674426665 * 0.6435019674426665 - 0.03052608357660639 * 0.03052608357660639), 0.0002083995867536322, OhPointGen::points_48},
+            {0.6747218676375681, 0.06112185773983089, constexpr_sqrt(1.0 - 0.6747218676375681 * 0.6747218676375681 - 0.06112185773983089 * 0.06112185773983089), 0.0002090509712889637, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
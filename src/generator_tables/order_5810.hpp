@@ -0,0 +1,169 @@
+#ifndef GENERATOR_TABLE_ORDER_5810_HPP
+#define GENERATOR_TABLE_ORDER_5810_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_5810>
+{
+    static constexpr std::array<GeneratorPoint, 144> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 9.735347946175486e-06, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.0001907581241803167, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.0001901059546737578, OhPointGen::points_8},
+            {0.01182361662400277, constexpr_sqrt(1.0 - 2.0 * 0.01182361662400277 * 0.01182361662400277), 0.0, 3.926424538919212e-05, OhPointGen::points_24},
+            {0.03062145009138958, constexpr_sqrt(1.0 - 2.0 * 0.03062145009138958 * 0.03062145009138958), 0.0, 6.667905467294381e-05, OhPointGen::points_24},
+            {0.05329794036834243, constexpr_sqrt(1.0 - 2.0 * 0.05329794036834243 * 0.05329794036834243), 0.0, 8.868891315019136e-05, OhPointGen::points_24},
+            {0.0784816553286222, constexpr_sqrt(1.0 - 2.0 * 0.0784816553286222 * 0.0784816553286222), 0.0, 0.0001066306000958872, OhPointGen::points_24},
+            {0.1054038157636201, constexpr_sqrt(1.0 - 2.0 * 0.1054038157636201 * 0.1054038157636201), 0.0, 0.0001214506743336128, OhPointGen::points_24},
+            {0.1335577797766211, constexpr_sqrt(1.0 - 2.0 * 0.1335577797766211 * 0.1335577797766211), 0.0, 0.0001338054681640871, OhPointGen::points_24},
+            {0.1625769955502252, constexpr_sqrt(1.0 - 2.0 * 0.1625769955502252 * 0.1625769955502252), 0.0, 0.0001441677023628504, OhPointGen::points_24},
+            {0.1921787193412792, constexpr_sqrt(1.0 - 2.0 * 0.1921787193412792 * 0.1921787193412792), 0.0, 0.0001528880200826557, OhPointGen::points_24},
+            {0.2221340534690548, constexpr_sqrt(1.0 - 2.0 * 0.2221340534690548 * 0.2221340534690548), 0.0, 0.0001602330623773609, OhPointGen::points_24},
+            {0.2522504912791132, constexpr_sqrt(1.0 - 2.0 * 0.2522504912791132 * 0.2522504912791132), 0.0, 0.0001664102653445244, OhPointGen::points_24},
+            {0.2823610860679697, constexpr_sqrt(1.0 - 2.0 * 0.2823610860679697 * 0.2823610860679697), 0.0, 0.0001715845854011323, OhPointGen::points_24},
+            {0.312317396626756, constexpr_sqrt(1.0 - 2.0 * 0.312317396626756 * 0.312317396626756), 0.0, 0.0001758901000133069, OhPointGen::points_24},
+            {0.3419847036953789, constexpr_sqrt(1.0 - 2.0 * 0.3419847036953789 * 0.3419847036953789), 0.0, 0.0001794382485256736, OhPointGen::points_24},
+            {0.3712386456999758, constexpr_sqrt(1.0 - 2.0 * 0.3712386456999758 * 0.3712386456999758), 0.0, 0.0001823238106757407, OhPointGen::points_24},
+            {0.3999627649876828, constexpr_sqrt(1.0 - 2.0 * 0.3999627649876828 * 0.3999627649876828), 0.0, 0.0001846293252959976, OhPointGen::points_24},
+            {0.4280466458648093, constexpr_sqrt(1.0 - 2.0 * 0.4280466458648093 * 0.4280466458648093), 0.0, 0.0001864284079323098, OhPointGen::points_24},
+            {0.4553844360185711, constexpr_sqrt(1.0 - 2.0 * 0.4553844360185711 * 0.4553844360185711), 0.0, 0.0001877882694626914, OhPointGen::points_24},
+            {0.4818736094437834, constexpr_sqrt(1.0 - 2.0 * 0.4818736094437834 * 0.4818736094437834), 0.0, 0.0001887716321852025, OhPointGen::points_24},
+            {0.5074138709260629, constexpr_sqrt(1.0 - 2.0 * 0.5074138709260629 * 0.5074138709260629), 0.0, 0.0001894381638175673, OhPointGen::points_24},
+            {0.5319061304570707, constexpr_sqrt(1.0 - 2.0 * 0.5319061304570707 * 0.5319061304570707), 0.0, 0.0001898454899533629, OhPointGen::points_24},
+            {0.5552514978677286, constexpr_sqrt(1.0 - 2.0 * 0.5552514978677286 * 0.5552514978677286), 0.0, 0.0001900497929577815, OhPointGen::points_24},
+            {0.5981009025246183, constexpr_sqrt(1.0 - 2.0 * 0.5981009025246183 * 0.5981009025246183), 0.0, 0.0001900671501924092, OhPointGen::points_24},
+            {0.6173990192228116, constexpr_sqrt(1.0 - 2.0 * 0.6173990192228116 * 0.6173990192228116), 0.0, 0.000189983755553351, OhPointGen::points_24},
+            {0.6351365239411131, constexpr_sqrt(1.0 - 2.0 * 0.6351365239411131 * 0.6351365239411131), 0.0, 0.0001899014113156229, OhPointGen::points_24},
+            {0.65120102282272, constexpr_sqrt(1.0 - 2.0 * 0.65120102282272 * 0.65120102282272), 0.0, 0.0001898581257705106, OhPointGen::points_24},
+            {0.665475836394812, constexpr_sqrt(1.0 - 2.0 * 0.665475836394812 * 0.665475836394812), 0.0, 0.0001898804756095753, OhPointGen::points_24},
+            {0.677841041485337, constexpr_sqrt(1.0 - 2.0 * 0.677841041485337 * 0.677841041485337), 0.0, 0.0001899793610426402, OhPointGen::points_24},
+            {0.688176088748411, constexpr_sqrt(1.0 - 2.0 * 0.688176088748411 * 0.688176088748411), 0.0, 0.0001901464554844117, OhPointGen::points_24},
+            {0.6963645267094598, constexpr_sqrt(1.0 - 2.0 * 0.6963645267094598 * 0.6963645267094598), 0.0, 0.0001903533246259542, OhPointGen::points_24},
+            {0.7023010617153579, constexpr_sqrt(1.0 - 2.0 * 0.7023010617153579 * 0.7023010617153579), 0.0, 0.0001905556158463228, OhPointGen::points_24},
+            {0.7059004636628753, constexpr_sqrt(1.0 - 2.0 * 0.7059004636628753 * 0.7059004636628753), 0.0, 0.0001907037155663528, OhPointGen::points_24},
+            {0.03552470312472575, constexpr_sqrt(1.0 - 0.03552470312472575 * 0.03552470312472575), 0.0, 5.992997844249967e-05, OhPointGen::points_24_axis},
+            {0.09151176620841284, constexpr_sqrt(1.0 - 0.09151176620841284 * 0.09151176620841284), 0.0, 9.749059382456977e-05, OhPointGen::points_24_axis},
+            {0.156619793006898, constexpr_sqrt(1.0 - 0.156619793006898 * 0.156619793006898), 0.0, 0.0001241680804599158, OhPointGen::points_24_axis},
+            {0.2265467599271907, constexpr_sqrt(1.0 - 0.2265467599271907 * 0.2265467599271907), 0.0, 0.000143762615429936, OhPointGen::points_24_axis},
+            {0.2988242318581361, constexpr_sqrt(1.0 - 0.2988242318581361 * 0.2988242318581361), 0.0, 0.0001584200054793902, OhPointGen::points_24_axis},
+            {0.3717482419703886, constexpr_sqrt(1.0 - 0.3717482419703886 * 0.3717482419703886), 0.0, 0.0001694436550982744, OhPointGen::points_24_axis},
+            {0.4440094491758889, constexpr_sqrt(1.0 - 0.4440094491758889 * 0.4440094491758889), 0.0, 0.0001776617014018108, OhPointGen::points_24_axis},
+            {0.5145337096756643, constexpr_sqrt(1.0 - 0.5145337096756643 * 0.5145337096756643), 0.0, 0.0001836132434440077, OhPointGen::points_24_axis},
+            {0.582405367286023, constexpr_sqrt(1.0 - 0.582405367286023 * 0.582405367286023), 0.0, 0.0001876494727075983, OhPointGen::points_24_axis},
+            {0.646828396104337, constexpr_sqrt(1.0 - 0.646828396104337 * 0.646828396104337), 0.0, 0.0001899906535336482, OhPointGen::points_24_axis},
+            {0.06095964259104373, 0.01787828275342931, constexpr_sqrt(1.0 - 0.06095964259104373 * 0.06095964259104373 - 0.01787828275342931 * 0.01787828275342931), 8.14325282076735e-05, OhPointGen::points_48},
+            {0.08811962270959388, 0.03953888740792096, constexpr_sqrt(1.0 - 0.08811962270959388 * 0.08811962270959388 - 0.03953888740792096 * 0.03953888740792096), 9.998859890887728e-05, OhPointGen::points_48},
+            {0.1165936722428831, 0.0637812179772299, constexpr_sqrt(1.0 - 0.1165936722428831 * 0.1165936722428831 - 0.0637812179772299 * 0.0637812179772299), 0.0001156199403068359, OhPointGen::points_48},
+            {0.1460232857031785, 0.08985890813745037, constexpr_sqrt(1.0 - 0.1460232857031785 * 0.1460232857031785 - 0.08985890813745037 * 0.08985890813745037), 0.0001287632092635513, OhPointGen::points_48},
+            {0.1761197110181755, 0.1172606510576162, constexpr_sqrt(1.0 - 0.1761197110181755 * 0.1761197110181755 - 0.1172606510576162 * 0.1172606510576162), 0.0001398378643365139, OhPointGen::points_48},
+            {0.2066471190463718, 0.1456102876970995, constexpr_sqrt(1.0 - 0.2066471190463718 * 0.2066471190463718 - 0.1456102876970995 * 0.1456102876970995), 0.0001491876468417391, OhPointGen::points_48},
+            {0.2374076026328152, 0.1746153823011775, constexpr_sqrt(1.0 - 0.2374076026328152 * 0.2374076026328152 - 0.1746153823011775 * 0.1746153823011775), 0.0001570855679175456, OhPointGen::points_48},
+            {0.2682305474337051, 0.2040383070295584, constexpr_sqrt(1.0 - 0.2682305474337051 * 0.2682305474337051 - 0.2040383070295584 * 0.2040383070295584), 0.0001637483948103775, OhPointGen::points_48},
+            {0.2989653312142369, 0.2336788634003698, constexpr_sqrt(1.0 - 0.2989653312142369 * 0.2989653312142369 - 0.2336788634003698 * 0.2336788634003698), 0.0001693500566632843, OhPointGen::points_48},
+            {0.3294762752772209, 0.2633632752654219, constexpr_sqrt(1.0 - 0.3294762752772209 * 0.3294762752772209 - 0.2633632752654219 * 0.2633632752654219), 0.0001740322769393633, OhPointGen::points_48},
+            {0.3596390887276086, 0.2929369098051601, constexpr_sqrt(1.0 - 0.3596390887276086 * 0.3596390887276086 - 0.2929369098051601 * 0.2929369098051601), 0.0001779126637278296, OhPointGen::points_48},
+            {0.3893383046398812, 0.3222592785275512, constexpr_sqrt(1.0 - 0.3893383046398812 * 0.3893383046398812 - 0.3222592785275512 * 0.3222592785275512), 0.0001810908108835412, OhPointGen::points_48},
+            {0.4184653789358347, 0.3512004791195743, constexpr_sqrt(1.0 - 0.4184653789358347 * 0.4184653789358347 - 0.3512004791195743 * 0.3512004791195743), 0.000183652913260019, OhPointGen::points_48},
+            {0.4469172319076166, 0.3796385677684537, constexpr_sqrt(1.0 - 0.4469172319076166 * 0.4469172319076166 - 0.3796385677684537 * 0.3796385677684537), 0.0001856752841777379, OhPointGen::points_48},
+            {0.4745950813276976, 0.4074575378263879, constexpr_sqrt(1.0 - 0.4745950813276976 * 0.4745950813276976 - 0.4074575378263879 * 0.4074575378263879), 0.0001872270566606832, OhPointGen::points_48},
+            {0.5014034601410262, 0.4345456906027828, constexpr_sqrt(1.0 - 0.5014034601410262 * 0.5014034601410262 - 0.4345456906027828 * 0.4345456906027828), 0.0001883722645591307, OhPointGen::points_48},
+            {0.527249340455124, 0.4607942515205134, constexpr_sqrt(1.0 - 0.527249340455124 * 0.527249340455124 - 0.4607942515205134 * 0.4607942515205134), 0.0001891714324525297, OhPointGen::points_48},
+            {0.5520413051846366, 0.486096128418172, constexpr_sqrt(1.0 - 0.5520413051846366 * 0.5520413051846366 - 0.486096128418172 * 0.486096128418172), 0.0001896827480450146, OhPointGen::points_48},
+            {0.5756887237503077, 0.510344739534279, constexpr_sqrt(1.0 - 0.5756887237503077 * 0.5756887237503077 - 0.510344739534279 * 0.510344739534279), 0.0001899628417059528, OhPointGen::points_48},
+            {0.1225039430588352, 0.02136455922655793, constexpr_sqrt(1.0 - 0.1225039430588352 * 0.1225039430588352 - 0.02136455922655793 * 0.02136455922655793), 0.0001123301829001669, OhPointGen::points_48},
+            {0.1539113217321372, 0.04520926166137188, constexpr_sqrt(1.0 - 0.1539113217321372 * 0.1539113217321372 - 0.04520926166137188 * 0.04520926166137188), 0.0001253698826711277, OhPointGen::points_48},
+            {0.1856213098637712, 0.07086468177864819, constexpr_sqrt(1.0 - 0.1856213098637712 * 0.1856213098637712 - 0.07086468177864819 * 0.07086468177864819), 0.0001366266117678531, OhPointGen::points_48},
+            {0.2174998728035131, 0.09785239488772918, constexpr_sqrt(1.0 - 0.2174998728035131 * 0.2174998728035131 - 0.09785239488772918 * 0.09785239488772918), 0.0001462736856106918, OhPointGen::points_48},
+            {0.249412833693833, 0.125810639626721, constexpr_sqrt(1.0 - 0.249412833693833 * 0.249412833693833 - 0.125810639626721 * 0.125810639626721), 0.0001545076466685412, OhPointGen::points_48},
+            {0.281232156214348, 0.1544529125047001, constexpr_sqrt(1.0 - 0.281232156214348 * 0.281232156214348 - 0.1544529125047001 * 0.1544529125047001), 0.0001615096280814007, OhPointGen::points_48},
+            {0.3128372276456111, 0.1835433512202753, constexpr_sqrt(1.0 - 0.3128372276456111 * 0.3128372276456111 - 0.1835433512202753 * 0.1835433512202753), 0.0001674366639741759, OhPointGen::points_48},
+            {0.3441145160177973, 0.2128813258619585, constexpr_sqrt(1.0 - 0.3441145160177973 * 0.3441145160177973 - 0.2128813258619585 * 0.2128813258619585), 0.00017242250024379, OhPointGen::points_48},
+            {0.374956771485351, 0.2422913734880829, constexpr_sqrt(1.0 - 0.374956771485351 * 0.374956771485351 - 0.2422913734880829 * 0.2422913734880829), 0.0001765810822987288, OhPointGen::points_48},
+            {0.405262173201561, 0.2716163748391453, constexpr_sqrt(1.0 - 0.405262173201561 * 0.405262173201561 - 0.2716163748391453 * 0.2716163748391453), 0.0001800104126010751, OhPointGen::points_48},
+            {0.4349335453522385, 0.300712767124028, constexpr_sqrt(1.0 - 0.4349335453522385 * 0.4349335453522385 - 0.300712767124028 * 0.300712767124028), 0.0001827960437331284, OhPointGen::points_48},
+            {0.4638776641524965, 0.3294470677216479, constexpr_sqrt(1.0 - 0.4638776641524965 * 0.4638776641524965 - 0.3294470677216479 * 0.3294470677216479), 0.0001850140300716308, OhPointGen::points_48},
+            {0.4920046410462687, 0.3576932543699155, constexpr_sqrt(1.0 - 0.4920046410462687 * 0.4920046410462687 - 0.3576932543699155 * 0.3576932543699155), 0.0001867333507394938, OhPointGen::points_48},
+            {0.5192273554861704, 0.3853307059757764, constexpr_sqrt(1.0 - 0.5192273554861704 * 0.5192273554861704 - 0.3853307059757764 * 0.3853307059757764), 0.0001880178688638289, OhPointGen::points_48},
+            {0.5454609081136522, 0.4122425044452694, constexpr_sqrt(1.0 - 0.5454609081136522 * 0.5454609081136522 - 0.4122425044452694 * 0.4122425044452694), 0.0001889278925654758, OhPointGen::points_48},
+            {0.570622066142414, 0.4383139587781027, constexpr_sqrt(1.0 - 0.570622066142414 * 0.570622066142414 - 0.4383139587781027 * 0.4383139587781027), 0.0001895213832507346, OhPointGen::points_48},
+            {0.5946286755181518, 0.4634312536300553, constexpr_sqrt(1.0 - 0.5946286755181518 * 0.5946286755181518 - 0.4634312536300553 * 0.4634312536300553), 0.000189854827739742, OhPointGen::points_48},
+            {0.1905370790924295, 0.02371311537781979, constexpr_sqrt(1.0 - 0.1905370790924295 * 0.1905370790924295 - 0.02371311537781979 * 0.02371311537781979), 0.0001349105935937341, OhPointGen::points_48},
+            {0.2242518717748009, 0.04917878059254806, constexpr_sqrt(1.0 - 0.2242518717748009 * 0.2242518717748009 - 0.04917878059254806 * 0.04917878059254806), 0.0001444060068369326, OhPointGen::points_48},
+            {0.2577190808025936, 0.07595498960495142, constexpr_sqrt(1.0 - 0.2577190808025936 * 0.2577190808025936 - 0.07595498960495142 * 0.07595498960495142), 0.0001526797390930008, OhPointGen::points_48},
+            {0.2908724534927187, 0.10369910831911, constexpr_sqrt(1.0 - 0.2908724534927187 * 0.2908724534927187 - 0.10369910831911 * 0.10369910831911), 0.0001598208771406474, OhPointGen::points_48},
+            {0.3236354020056219, 0.1321348584450234, constexpr_sqrt(1.0 - 0.3236354020056219 * 0.3236354020056219 - 0.1321348584450234 * 0.1321348584450234), 0.0001659354368615331, OhPointGen::points_48},
+            {0.3559267359304543, 0.1610316571314789, constexpr_sqrt(1.0 - 0.3559267359304543 * 0.3559267359304543 - 0.1610316571314789 * 0.1610316571314789), 0.000171127991094644, OhPointGen::points_48},
+            {0.3876637123676956, 0.1901912080395707, constexpr_sqrt(1.0 - 0.3876637123676956 * 0.3876637123676956 - 0.1901912080395707 * 0.1901912080395707), 0.000175495272560144, OhPointGen::points_48},
+            {0.4187636705218842, 0.219438495013795, constexpr_sqrt(1.0 - 0.4187636705218842 * 0.4187636705218842 - 0.219438495013795 * 0.219438495013795), 0.0001791247850802529, OhPointGen::points_48},
+            {0.4491449019883107, 0.2486155334763858, constexpr_sqrt(1.0 - 0.4491449019883107 * 0.4491449019883107 - 0.2486155334763858 * 0.2486155334763858), 0.0001820954300877716, OhPointGen::points_48},
+            {0.4787270932425445, 0.2775768931812335, constexpr_sqrt(1.0 - 0.4787270932425445 * 0.4787270932425445 - 0.2775768931812335 * 0.2775768931812335), 0.0001844788524548449, OhPointGen::points_48},
+            {0.5074315153055574, 0.306186378659112, constexpr_sqrt(1.0 - 0.5074315153055574 * 0.5074315153055574 - 0.306186378659112 * 0.306186378659112), 0.000186340948170622, OhPointGen::points_48},
+            {0.5351810507738336, 0.3343144718152556, constexpr_sqrt(1.0 - 0.5351810507738336 * 0.5351810507738336 - 0.3343144718152556 * 0.3343144718152556), 0.0001877433008795068, OhPointGen::points_48},
+            {0.5619001025975381, 0.3618362729028427, constexpr_sqrt(1.0 - 0.5619001025975381 * 0.5619001025975381 - 0.3618362729028427 * 0.3618362729028427), 0.0001887444543705232, OhPointGen::points_48},
+            {0.5875144035268046, 0.3886297583620408, constexpr_sqrt(1.0 - 0.5875144035268046 * 0.5875144035268046 - 0.3886297583620408 * 0.3886297583620408), 0.0001894009829375006, OhPointGen::points_48},
+            {0.6119507308734495, 0.4145742277792031, constexpr_sqrt(1.0 - 0.6119507308734495 * 0.6119507308734495 - 0.4145742277792031 * 0.4145742277792031), 0.0001897683345035198, OhPointGen::points_48},
+            {0.2619733870119463, 0.02540047186389353, constexpr_sqrt(1.0 - 0.2619733870119463 * 0.2619733870119463 - 0.02540047186389353 * 0.02540047186389353), 0.0001517327037467653, OhPointGen::points_48},
+            {0.2968149743237949, 0.05208107018543989, constexpr_sqrt(1.0 - 0.2968149743237949 * 0.2968149743237949 - 0.05208107018543989 * 0.05208107018543989), 0.0001587740557483543, OhPointGen::points_48},
+            {0.3310451504860488, 0.07971828470885599, constexpr_sqrt(1.0 - 0.3310451504860488 * 0.3310451504860488 - 0.07971828470885599 * 0.07971828470885599), 0.0001649093382274097, OhPointGen::points_48},
+            {0.3646215567376676, 0.1080465999177927, constexpr_sqrt(1.0 - 0.3646215567376676 * 0.3646215567376676 - 0.1080465999177927 * 0.1080465999177927), 0.0001701915216193265, OhPointGen::points_48},
+            {0.397491678527936, 0.1368413849366629, constexpr_sqrt(1.0 - 0.397491678527936 * 0.397491678527936 - 0.1368413849366629 * 0.1368413849366629), 0.0001746847753144065, OhPointGen::points_48},
+            {0.4295967403772029, 0.1659073184763559, constexpr_sqrt(1.0 - 0.4295967403772029 * 0.4295967403772029 - 0.1659073184763559 * 0.1659073184763559), 0.000178455551200757, OhPointGen::points_48},
+            {0.4608742854473447, 0.1950703730454614, constexpr_sqrt(1.0 - 0.4608742854473447 * 0.4608742854473447 - 0.1950703730454614 * 0.1950703730454614), 0.0001815687562112174, OhPointGen::points_48},
+            {0.4912598858949903, 0.2241721144376724, constexpr_sqrt(1.0 - 0.4912598858949903 * 0.4912598858949903 - 0.2241721144376724 * 0.2241721144376724), 0.0001840864370663302, OhPointGen::points_48},
+            {0.5206882758945558, 0.2530655255406489, constexpr_sqrt(1.0 - 0.5206882758945558 * 0.5206882758945558 - 0.2530655255406489 * 0.2530655255406489), 0.0001860676785390006, OhPointGen::points_48},
+            {0.549094091401982, 0.2816118409731066, constexpr_sqrt(1.0 - 0.549094091401982 * 0.549094091401982 - 0.2816118409731066 * 0.2816118409731066), 0.0001875690583743703, OhPointGen::points_48},
+            {0.5764123302025542, 0.3096780504593238, constexpr_sqrt(1.0 - 0.5764123302025542 * 0.5764123302025542 - 0.3096780504593238 * 0.3096780504593238), 0.0001886453236347225, OhPointGen::points_48},
+            {0.6025786004213506, 0.3371348366394987, constexpr_sqrt(1.0 - 0.6025786004213506 * 0.6025786004213506 - 0.3371348366394987 * 0.3371348366394987), 0.0001893501123329645, OhPointGen::points_48},
+            {0.6275291964794956, 0.3638547827694396, constexpr_sqrt(1.0 - 0.6275291964794956 * 0.6275291964794956 - 0.3638547827694396 * 0.3638547827694396), 0.0001897366184519868, OhPointGen::points_48},
+            {0.3348189479861771, 0.02664841935537443, constexpr_sqrt(1.0 - 0.3348189479861771 * 0.3348189479861771 - 0.02664841935537443 * 0.02664841935537443), 0.0001643908815152736, OhPointGen::points_48},
+            {0.3699515545855295, 0.05424000066843495, constexpr_sqrt(1.0 - 0.3699515545855295 * 0.3699515545855295 - 0.05424000066843495 * 0.05424000066843495), 0.0001696300350907768, OhPointGen::points_48},
+            {0.4042003071474669, 0.08251992715430854, constexpr_sqrt(1.0 - 0.4042003071474669 * 0.4042003071474669 - 0.08251992715430854 * 0.08251992715430854), 0.0001741553103844483, OhPointGen::points_48},
+            {0.4375320100182624, 0.111269518248371, constexpr_sqrt(1.0 - 0.4375320100182624 * 0.4375320100182624 - 0.111269518248371 * 0.111269518248371), 0.0001780015282386092, OhPointGen::points_48},
+            {0.4699054490335947, 0.1402964116467816, constexpr_sqrt(1.0 - 0.4699054490335947 * 0.4699054490335947 - 0.1402964116467816 * 0.1402964116467816), 0.0001812116787077125, OhPointGen::points_48},
+            {0.5012739879431952, 0.1694275117584291, constexpr_sqrt(1.0 - 0.5012739879431952 * 0.5012739879431952 - 0.1694275117584291 * 0.1694275117584291), 0.0001838323158085421, OhPointGen::points_48},
+            {0.5315874883754966, 0.1985038235312689, constexpr_sqrt(1.0 - 0.5315874883754966 * 0.5315874883754966 - 0.1985038235312689 * 0.1985038235312689), 0.0001859113119837737, OhPointGen::points_48},
+            {0.5607937109622116, 0.2273765660020893, constexpr_sqrt(1.0 - 0.5607937109622116 * 0.5607937109622116 - 0.2273765660020893 * 0.2273765660020893), 0.0001874969220221698, OhPointGen::points_48},
+            {0.588839322349552, 0.2559041492849764, constexpr_sqrt(1.0 - 0.588839322349552 * 0.588839322349552 - 0.2559041492849764 * 0.2559041492849764), 0.0001886375612681076, OhPointGen::points_48},
+            {0.6156705979160163, 0.2839497251976899, constexpr_sqrt(1.0 - 0.6156705979160163 * 0.6156705979160163 - 0.2839497251976899 * 0.2839497251976899), 0.0001893819575809276, OhPointGen::points_48},
+            {0.6412338809078123, 0.311379106050069, constexpr_sqrt(1.0 - 0.6412338809078123 * 0.6412338809078123 - 0.311379106050069 * 0.311379106050069), 0.0001897794748256767, OhPointGen::points_48},
+            {0.4076051259257167, 0.02757792290858463, constexpr_sqrt(1.0 - 0.4076051259257167 * 0.4076051259257167 - 0.02757792290858463 * 0.02757792290858463), 0.0001738963926584846, OhPointGen::points_48},
+            {0.442378812579152, 0.05584136834984293, constexpr_sqrt(1.0 - 0.442378812579152 * 0.442378812579152 - 0.05584136834984293 * 0.05584136834984293), 0.0001777442359873466, OhPointGen::points_48},
+            {0.4760480917328258, 0.08457772087727143, constexpr_sqrt(1.0 - 0.4760480917328258 * 0.4760480917328258 - 0.08457772087727143 * 0.08457772087727143), 0.0001810010815068719, OhPointGen::points_48},
+            {0.5085838725946297, 0.1135975846359248, constexpr_sqrt(1.0 - 0.5085838725946297 * 0.5085838725946297 - 0.1135975846359248 * 0.1135975846359248), 0.0001836920318248129, OhPointGen::points_48},
+            {0.5399513637391218, 0.1427286904765053, constexpr_sqrt(1.0 - 0.5399513637391218 * 0.5399513637391218 - 0.1427286904765053 * 0.1427286904765053), 0.0001858489473214328, OhPointGen::points_48},
+            {0.570111843363638, 0.1718112740057635, constexpr_sqrt(1.0 - 0.570111843363638 * 0.570111843363638 - 0.1718112740057635 * 0.1718112740057635), 0.0001875079342496592, OhPointGen::points_48},
+            {0.5990240530606021, 0.2006944855985351, constexpr_sqrt(1.0 - 0.5990240530606021 * 0.5990240530606021 - 0.2006944855985351 * 0.2006944855985351), 0.000188708023910231, OhPointGen::points_48},
+            {0.6266452685139695, 0.2292335090598907, constexpr_sqrt(1.0 - 0.6266452685139695 * 0.6266452685139695 - 0.2292335090598907 * 0.2292335090598907), 0.0001894905752176822, OhPointGen::points_48},
+            {0.6529320971415942, 0.2572871512353714, constexpr_sqrt(1.0 - 0.6529320971415942 * 0.6529320971415942 - 0.2572871512353714 * 0.2572871512353714), 0.0001898991061200695, OhPointGen::points_48},
+            {0.4791583834610126, 0.02826094197735932, constexpr_sqrt(1.0 - 0.4791583834610126 * 0.4791583834610126 - 0.02826094197735932 * 0.02826094197735932), 0.0001809065016458791, OhPointGen::points_48},
+            {0.513037395279694, 0.05699871359683649, constexpr_sqrt(1.0 - 0.513037395279694 * 0.513037395279694 - 0.05699871359683649 * 0.05699871359683649), 0.0001836297121596799, OhPointGen::points_48},
+            {0.5456252429628476, 0.08602712528554395, constexpr_sqrt(1.0 - 0.5456252429628476 * 0.5456252429628476 - 0.08602712528554395 * 0.08602712528554395), 0.0001858426916241869, OhPointGen::points_48},
+            {0.5768956329682385, 0.1151748137221281, constexpr_sqrt(1.0 - 0.5768956329682385 * 0.5768956329682385 - 0.1151748137221281 * 0.1151748137221281), 0.0001875654101134641, OhPointGen::points_48},
+            {0.6068186944699046, 0.1442811654136362, constexpr_sqrt(1.0 - 0.6068186944699046 * 0.6068186944699046 - 0.1442811654136362 * 0.1442811654136362), 0.0001888240751833503, OhPointGen::points_48},
+            {0.6353622248024907, 0.173193032165768, constexpr_sqrt(1.0 - 0.6353622248024907 * 0.6353622248024907 - 0.173193032165768 * 0.173193032165768), 0.0001896497383866979, OhPointGen::points_48},
+            {0.6624927035731797, 0.2017619958756061, constexpr_sqrt(1.0 - 0.6624927035731797 * 0.6624927035731797 - 0.2017619958756061 * 0.2017619958756061), 0.0001900775530219121, OhPointGen::points_48},
+            {0.5484933508028488, 0.02874219755907391, constexpr_sqrt(1.0 - 0.5484933508028488 * 0.5484933508028488 - 0.02874219755907391 * 0.02874219755907391), 0.0001858525041478814, OhPointGen::points_48},
+            {0.5810207682142106, 0.05778312123713695, constexpr_sqrt(1.0 - 0.5810207682142106 * 0.5810207682142106 - 0.05778312123713695 * 0.05778312123713695), 0.0001876248690077947, OhPointGen::points_48},
+            {0.6120955197181353, 0.08695262371439526, constexpr_sqrt(1.0 - 0.6120955197181353 * 0.6120955197181353 - 0.08695262371439526 * 0.08695262371439526), 0.0001889404439064607, OhPointGen::points_48},
+            {0.6416944284294319, 0.1160893767057166, constexpr_sqrt(1.0 - 0.6416944284294319 * 0.6416944284294319 - 0.1160893767057166 * 0.1160893767057166), 0.000189816853926529, OhPointGen::points_48},
+            {0.669792639173126, 0.1450378826743251, constexpr_sqrt(1.0 - 0.669792639173126 * 0.669792639173126 - 0.1450378826743251 * 0.1450378826743251), 0.0001902779940661772, OhPointGen::points_48},
+            {0.6147594390585488, 0.02904957622341456, constexpr_sqrt(1.0 - 0.6147594390585488 * 0.6147594390585488 - 0.02904957622341456 * 0.02904957622341456), 0.0001890125641731815, OhPointGen::points_48},
+            {0.6455390026356783, 0.05823809152617197, constexpr_sqrt(1.0 - 0.6455390026356783 * 0.6455390026356783 - 0.05823809152617197 * 0.05823809152617197), 0.0001899434637795751, OhPointGen::points_48},
+            {0.6747258588365477, 0.08740384899884715, constexpr_sqrt(1.0 - 0.6747258588365477 * 0.6747258588365477 - 0.08740384899884715 * 0.08740384899884715), 0.0001904520856831751, OhPointGen::points_48},
+            {0.6772135750395347, 0.02919946135808105, constexpr_sqrt(1.0 - 0.6772135750395347 * 0.6772135750395347 - 0.02919946135808105 * 0.02919946135808105), 0.0001905534498734563, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
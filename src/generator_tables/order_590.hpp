@@ -0,0 +1,45 @@
+#ifndef GENERATOR_TABLE_ORDER_590_HPP
+#define GENERATOR_TABLE_ORDER_590_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_590>
+{
+    static constexpr std::array<GeneratorPoint, 20> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.0003095121295306187, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.001852379698597489, OhPointGen::points_8},
+            {0.7040954938227469, constexpr_sqrt(1.0 - 2.0 * 0.7040954938227469 * 0.7040954938227469), 0.0, 0.001871790639277744, OhPointGen::points_24},
+            {0.6807744066455244, constexpr_sqrt(1.0 - 2.0 * 0.6807744066455244 * 0.6807744066455244), 0.0, 0.001858812585438317, OhPointGen::points_24},
+            {0.6372546939258752, constexpr_sqrt(1.0 - 2.0 * 0.6372546939258752 * 0.6372546939258752), 0.0, 0.001852028828296213, OhPointGen::points_24},
+            {0.5044419707800358, constexpr_sqrt(1.0 - 2.0 * 0.5044419707800358 * 0.5044419707800358), 0.0, 0.001846715956151242, OhPointGen::points_24},
+            {0.4215761784010967, constexpr_sqrt(1.0 - 2.0 * 0.4215761784010967 * 0.4215761784010967), 0.0, 0.001818471778162769, OhPointGen::points_24},
+            {0.3317920736472123, constexpr_sqrt(1.0 - 2.0 * 0.3317920736472123 * 0.3317920736472123), 0.0, 0.001749564657281154, OhPointGen::points_24},
+            {0.2384736701421887, constexpr_sqrt(1.0 - 2.0 * 0.2384736701421887 * 0.2384736701421887), 0.0, 0.001617210647254411, OhPointGen::points_24},
+            {0.1459036449157763, constexpr_sqrt(1.0 - 2.0 * 0.1459036449157763 * 0.1459036449157763), 0.0, 0.001384737234851692, OhPointGen::points_24},
+            {0.06095034115507196, constexpr_sqrt(1.0 - 2.0 * 0.06095034115507196 * 0.06095034115507196), 0.0, 0.000976433116505105, OhPointGen::points_24},
+            {0.6116843442009876, constexpr_sqrt(1.0 - 0.6116843442009876 * 0.6116843442009876), 0.0, 0.001857161196774078, OhPointGen::points_24_axis},
+            {0.3964755348199858, constexpr_sqrt(1.0 - 0.3964755348199858 * 0.3964755348199858), 0.0, 0.001705153996395864, OhPointGen::points_24_axis},
+            {0.1724782009907724, constexpr_sqrt(1.0 - 0.1724782009907724 * 0.1724782009907724), 0.0, 0.001300321685886048, OhPointGen::points_24_axis},
+            {0.561026380862206, 0.3518280927733519, constexpr_sqrt(1.0 - 0.561026380862206 * 0.561026380862206 - 0.3518280927733519 * 0.3518280927733519), 0.001842866472905286, OhPointGen::points_48},
+            {0.474239284255198, 0.263471665593795, constexpr_sqrt(1.0 - 0.474239284255198 * 0.474239284255198 - 0.263471665593795 * 0.263471665593795), 0.001802658934377451, OhPointGen::points_48},
+            {0.598412649788538, 0.1816640840360209, constexpr_sqrt(1.0 - 0.598412649788538 * 0.598412649788538 - 0.1816640840360209 * 0.1816640840360209), 0.00184983056044366, OhPointGen::points_48},
+            {0.3791035407695563, 0.1720795225656878, constexpr_sqrt(1.0 - 0.3791035407695563 * 0.3791035407695563 - 0.1720795225656878 * 0.1720795225656878), 0.001713904507106709, OhPointGen::points_48},
+            {0.2778673190586244, 0.08213021581932511, constexpr_sqrt(1.0 - 0.2778673190586244 * 0.2778673190586244 - 0.08213021581932511 * 0.08213021581932511), 0.001555213603396808, OhPointGen::points_48},
+            {0.5033564271075117, 0.08999205842074876, constexpr_sqrt(1.0 - 0.5033564271075117 * 0.5033564271075117 - 0.08999205842074876 * 0.08999205842074876), 0.001802239128008525, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
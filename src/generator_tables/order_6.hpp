@@ -0,0 +1,26 @@
+#ifndef GENERATOR_TABLE_ORDER_6_HPP
+#define GENERATOR_TABLE_ORDER_6_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_6>
+{
+    static constexpr std::array<GeneratorPoint, 1> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.1666666666666667, OhPointGen::points_6}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef GENERATOR_TABLE_ORDER_74_HPP
+#define GENERATOR_TABLE_ORDER_74_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_74>
+{
+    static constexpr std::array<GeneratorPoint, 5> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.0005130671797338464, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.01660406956574204, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, -0.02958603896103896, OhPointGen::points_8},
+            {0.4803844614152614, constexpr_sqrt(1.0 - 2.0 * 0.4803844614152614 * 0.4803844614152614), 0.0, 0.02657620708215946, OhPointGen::points_24},
+            {0.3207726489807764, constexpr_sqrt(1.0 - 0.3207726489807764 * 0.3207726489807764), 0.0, 0.01652217099371571, OhPointGen::points_24_axis}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
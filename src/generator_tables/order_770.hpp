@@ -0,0 +1,50 @@
+#ifndef GENERATOR_TABLE_ORDER_770_HPP
+#define GENERATOR_TABLE_ORDER_770_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_770>
+{
+    static constexpr std::array<GeneratorPoint, 25> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.0002192942088181184, OhPointGen::points_6},
+            {constexpr_sqrt(0.5), 0.0, 0.0, 0.00143643361731908, OhPointGen::points_12},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.001421940344335877, OhPointGen::points_8},
+            {0.0508720441050236, constexpr_sqrt(1.0 - 2.0 * 0.0508720441050236 * 0.0508720441050236), 0.0, 0.0006798123511050502, OhPointGen::points_24},
+            {0.1228198790178831, constexpr_sqrt(1.0 - 2.0 * 0.1228198790178831 * 0.1228198790178831), 0.0, 0.0009913184235294911, OhPointGen::points_24},
+            {0.2026890814408786, constexpr_sqrt(1.0 - 2.0 * 0.2026890814408786 * 0.2026890814408786), 0.0, 0.001180207833238949, OhPointGen::points_24},
+            {0.2847745156464294, constexpr_sqrt(1.0 - 2.0 * 0.2847745156464294 * 0.2847745156464294), 0.0, 0.001296599602080921, OhPointGen::points_24},
+            {0.3656719078978026, constexpr_sqrt(1.0 - 2.0 * 0.3656719078978026 * 0.3656719078978026), 0.0, 0.001365871427428316, OhPointGen::points_24},
+            {0.4428264886713469, constexpr_sqrt(1.0 - 2.0 * 0.4428264886713469 * 0.4428264886713469), 0.0, 0.001402988604775325, OhPointGen::points_24},
+            {0.5140619627249735, constexpr_sqrt(1.0 - 2.0 * 0.5140619627249735 * 0.5140619627249735), 0.0, 0.001418645563595609, OhPointGen::points_24},
+            {0.6306401219166803, constexpr_sqrt(1.0 - 2.0 * 0.6306401219166803 * 0.6306401219166803), 0.0, 0.001421376741851662, OhPointGen::points_24},
+            {0.6716883332022612, constexpr_sqrt(1.0 - 2.0 * 0.6716883332022612 * 0.6716883332022612), 0.0, 0.001423996475490962, OhPointGen::points_24},
+            {0.6979792685336881, constexpr_sqrt(1.0 - 2.0 * 0.6979792685336881 * 0.6979792685336881), 0.0, 0.001431554042178567, OhPointGen::points_24},
+            {0.1446865674195309, constexpr_sqrt(1.0 - 0.1446865674195309 * 0.1446865674195309), 0.0, 0.0009254401499865368, OhPointGen::points_24_axis},
+            {0.3390263475411216, constexpr_sqrt(1.0 - 0.3390263475411216 * 0.3390263475411216), 0.0, 0.001250239995053509, OhPointGen::points_24_axis},
+            {0.5335804651263506, constexpr_sqrt(1.0 - 0.5335804651263506 * 0.5335804651263506), 0.0, 0.00139436584332923, OhPointGen::points_24_axis},
+            {0.06944024393349413, 0.2355187894242326, constexpr_sqrt(1.0 - 0.06944024393349413 * 0.06944024393349413 - 0.2355187894242326 * 0.2355187894242326), 0.001127089094671749, OhPointGen::points_48},
+            {0.226900410952946, 0.410218247404573, constexpr_sqrt(1.0 - 0.226900410952946 * 0.226900410952946 - 0.410218247404573 * 0.410218247404573), 0.00134575376091067, OhPointGen::points_48},
+            {0.08025574607775339, 0.6214302417481605, constexpr_sqrt(1.0 - 0.08025574607775339 * 0.08025574607775339 - 0.6214302417481605 * 0.6214302417481605), 0.001424957283316783, OhPointGen::points_48},
+            {0.1467999527896572, 0.3245284345717394, constexpr_sqrt(1.0 - 0.1467999527896572 * 0.1467999527896572 - 0.3245284345717394 * 0.3245284345717394), 0.00126152334123775, OhPointGen::points_48},
+            {0.1571507769824727, 0.522448218969663, constexpr_sqrt(1.0 - 0.1571507769824727 * 0.1571507769824727 - 0.522448218969663 * 0.522448218969663), 0.001392547106052696, OhPointGen::points_48},
+            {0.2365702993157246, 0.6017546634089558, constexpr_sqrt(1.0 - 0.2365702993157246 * 0.2365702993157246 - 0.6017546634089558 * 0.6017546634089558), 0.001418761677877656, OhPointGen::points_48},
+            {0.07714815866765733, 0.4346575516141163, constexpr_sqrt(1.0 - 0.07714815866765733 * 0.07714815866765733 - 0.4346575516141163 * 0.4346575516141163), 0.001338366684479554, OhPointGen::points_48},
+            {0.306293666621073, 0.4908826589037616, constexpr_sqrt(1.0 - 0.306293666621073 * 0.306293666621073 - 0.4908826589037616 * 0.4908826589037616), 0.001393700862676131, OhPointGen::points_48},
+            {0.3822477379524787, 0.56487681490995, constexpr_sqrt(1.0 - 0.3822477379524787 * 0.3822477379524787 - 0.56487681490995 * 0.56487681490995), 0.001415914757466932, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef GENERATOR_TABLE_ORDER_86_HPP
+#define GENERATOR_TABLE_ORDER_86_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_86>
+{
+    static constexpr std::array<GeneratorPoint, 5> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.01154401154401154, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.01194390908585628, OhPointGen::points_8},
+            {0.3696028464541502, constexpr_sqrt(1.0 - 2.0 * 0.3696028464541502 * 0.3696028464541502), 0.0, 0.0111105557106034, OhPointGen::points_24},
+            {0.6943540066026664, constexpr_sqrt(1.0 - 2.0 * 0.6943540066026664 * 0.6943540066026664), 0.0, 0.01187650129453714, OhPointGen::points_24},
+            {0.3742430390903412, constexpr_sqrt(1.0 - 0.3742430390903412 * 0.3742430390903412), 0.0, 0.01181230374690448, OhPointGen::points_24_axis}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef GENERATOR_TABLE_ORDER_974_HPP
+#define GENERATOR_TABLE_ORDER_974_HPP
+
+#include "../generator_table.hpp"
+#include "../generator_point.hpp"
+#include "../quadrature_order.hpp"
+#include "../constexpr_math.hpp"
+
+#include <array>
+
+namespace lebedev {
+
+template <>
+struct GeneratorTable<QuadratureOrder::order_974>
+{
+    static constexpr std::array<GeneratorPoint, 30> generator_points()
+    {
+        return {{
+            {1.0, 0.0, 0.0, 0.0001438294190527431, OhPointGen::points_6},
+            {constexpr_sqrt(1.0/3.0), 0.0, 0.0, 0.001125772288287004, OhPointGen::points_8},
+            {0.04292963545341347, constexpr_sqrt(1.0 - 2.0 * 0.04292963545341347 * 0.04292963545341347), 0.0, 0.0004948029341949241, OhPointGen::points_24},
+            {0.1051426854086404, constexpr_sqrt(1.0 - 2.0 * 0.1051426854086404 * 0.1051426854086404), 0.0, 0.000735799010912547, OhPointGen::points_24},
+            {0.1750024867623087, constexpr_sqrt(1.0 - 2.0 * 0.1750024867623087 * 0.1750024867623087), 0.0, 0.0008889132771304384, OhPointGen::points_24},
+            {0.2477653379650257, constexpr_sqrt(1.0 - 2.0 * 0.2477653379650257 * 0.2477653379650257), 0.0, 0.0009888347838921435, OhPointGen::points_24},
+            {0.3206567123955957, constexpr_sqrt(1.0 - 2.0 * 0.3206567123955957 * 0.3206567123955957), 0.0, 0.001053299681709471, OhPointGen::points_24},
+            {0.3916520749849983, constexpr_sqrt(1.0 - 2.0 * 0.3916520749849983 * 0.3916520749849983), 0.0, 0.001092778807014578, OhPointGen::points_24},
+            {0.4590825874187624, constexpr_sqrt(1.0 - 2.0 * 0.4590825874187624 * 0.4590825874187624), 0.0, 0.001114389394063227, OhPointGen::points_24},
+            {0.5214563888415861, constexpr_sqrt(1.0 - 2.0 * 0.5214563888415861 * 0.5214563888415861), 0.0, 0.001123724788051555, OhPointGen::points_24},
+            {0.6253170244654199, constexpr_sqrt(1.0 - 2.0 * 0.6253170244654199 * 0.6253170244654199), 0.0, 0.001125239325243814, OhPointGen::points_24},
+            {0.663792674452317, constexpr_sqrt(1.0 - 2.0 * 0.663792674452317 * 0.663792674452317), 0.0, 0.001126153271815905, OhPointGen::points_24},
+            {0.6910410398498301, constexpr_sqrt(1.0 - 2.0 * 0.6910410398498301 * 0.6910410398498301), 0.0, 0.001130286931123841, OhPointGen::points_24},
+            {0.705290700745776, constexpr_sqrt(1.0 - 2.0 * 0.705290700745776 * 0.705290700745776), 0.0, 0.001134986534363955, OhPointGen::points_24},
+            {0.123668676265799, constexpr_sqrt(1.0 - 0.123668676265799 * 0.123668676265799), 0.0, 0.0006823367927109931, OhPointGen::points_24_axis},
+            {0.2940777114468387, constexpr_sqrt(1.0 - 0.2940777114468387 * 0.2940777114468387), 0.0, 0.0009454158160447096, OhPointGen::points_24_axis},
+            {0.4697753849207649, constexpr_sqrt(1.0 - 0.4697753849207649 * 0.4697753849207649), 0.0, 0.001074429975385679, OhPointGen::points_24_axis},
+            {0.6334563241139567, constexpr_sqrt(1.0 - 0.6334563241139567 * 0.6334563241139567), 0.0, 0.001129300086569132, OhPointGen::points_24_axis},
+            {0.05974048614181342, 0.2029128752777523, constexpr_sqrt(1.0 - 0.05974048614181342 * 0.05974048614181342 - 0.2029128752777523 * 0.2029128752777523), 0.0008436884500901954, OhPointGen::points_48},
+            {0.1375760408473636, 0.4602621942484054, constexpr_sqrt(1.0 - 0.1375760408473636 * 0.1375760408473636 - 0.4602621942484054 * 0.4602621942484054), 0.001075255720448885, OhPointGen::points_48},
+            {0.3391016526336286, 0.5030673999662036, constexpr_sqrt(1.0 - 0.3391016526336286 * 0.3391016526336286 - 0.5030673999662036 * 0.5030673999662036), 0.001108577236864462, OhPointGen::points_48},
+            {0.127167519143982, 0.2817606422442134, constexpr_sqrt(1.0 - 0.127167519143982 * 0.127167519143982 - 0.2817606422442134 * 0.2817606422442134), 0.0009566475323783356, OhPointGen::points_48},
+            {0.2693120740413512, 0.4331561291720157, constexpr_sqrt(1.0 - 0.2693120740413512 * 0.2693120740413512 - 0.4331561291720157 * 0.4331561291720157), 0.001080663250717391, OhPointGen::points_48},
+            {0.1419786452601918, 0.6256167358580814, constexpr_sqrt(1.0 - 0.1419786452601918 * 0.1419786452601918 - 0.6256167358580814 * 0.6256167358580814), 0.001126797131196295, OhPointGen::points_48},
+            {0.06709284600738255, 0.3798395216859157, constexpr_sqrt(1.0 - 0.06709284600738255 * 0.06709284600738255 - 0.3798395216859157 * 0.3798395216859157), 0.001022568715358061, OhPointGen::points_48},
+            {0.07057738183256172, 0.551750542142352, constexpr_sqrt(1.0 - 0.07057738183256172 * 0.07057738183256172 - 0.551750542142352 * 0.551750542142352), 0.001108960267713108, OhPointGen::points_48},
+            {0.2783888477882155, 0.6029619156159187, constexpr_sqrt(1.0 - 0.2783888477882155 * 0.2783888477882155 - 0.6029619156159187 * 0.6029619156159187), 0.001122790653435766, OhPointGen::points_48},
+            {0.1979578938917407, 0.3589606329589096, constexpr_sqrt(1.0 - 0.1979578938917407 * 0.1979578938917407 - 0.3589606329589096 * 0.3589606329589096), 0.00103240184711746, OhPointGen::points_48},
+            {0.2087307061103274, 0.5348666438135476, constexpr_sqrt(1.0 - 0.2087307061103274 * 0.2087307061103274 - 0.5348666438135476 * 0.5348666438135476), 0.001107249382283854, OhPointGen::points_48},
+            {0.4055122137872836, 0.5674997546074373, constexpr_sqrt(1.0 - 0.4055122137872836 * 0.4055122137872836 - 0.5674997546074373 * 0.5674997546074373), 0.001121780048519972, OhPointGen::points_48}
+        }};
+    }
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef INTEGRATION_WORKSPACE_HPP
+#define INTEGRATION_WORKSPACE_HPP
+
+#include "preprocessor.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace lebedev {
+
+/**
+ * \brief Scratch space which integrands write their values into, so that
+ * repeated integrations do not allocate.
+ *
+ * The buffer only grows, so once it has been used with the largest rule
+ * needed (or was constructed with room for it), integrating never touches
+ * the heap.
+ * A workspace must not be shared between threads which integrate at the
+ * same time; give each thread its own.
+ */
+class IntegrationWorkspace
+{
+public:
+    /** \brief Creates an empty workspace, which grows on first use */
+    IntegrationWorkspace() = default;
+
+    /** \brief Creates a workspace with room for the values at `n_points` points */
+    explicit IntegrationWorkspace(std::size_t n_points);
+
+    /** \brief Returns buffer with room for `n_points` values, growing it if needed */
+    double* get_values(std::size_t n_points);
+
+    /** \brief Returns number of values there is room for without growing */
+    std::size_t capacity() const;
+
+private:
+    /** \brief Buffer for integrand values */
+    std::vector<double> values;
+};
+
+} // namespace lebedev
+
+#endif
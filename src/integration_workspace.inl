@@ -0,0 +1,30 @@
+#include "preprocessor.hpp"
+#include "integration_workspace.hpp"
+
+namespace lebedev {
+
+LEBEDEV_EXTERNAL_LINKAGE
+IntegrationWorkspace::IntegrationWorkspace(std::size_t n_points)
+    : values(n_points)
+{}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+double* IntegrationWorkspace::get_values(std::size_t n_points)
+{
+    if (values.size() < n_points)
+        values.resize(n_points);
+
+    return values.data();
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t IntegrationWorkspace::capacity() const
+{
+    return values.size();
+}
+
+} // namespace lebedev
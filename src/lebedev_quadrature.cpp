@@ -0,0 +1,6 @@
+// Implementation of the compiled library targets. The generator points of
+// each order are compiled separately, from generator_table_instantiation.cpp.in
+
+#define LEBEDEV_IMPLEMENTATION 1
+#define LEBEDEV_SPLIT_TABLES 1
+#include "lebedev_quadrature.hpp"
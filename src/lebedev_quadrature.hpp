@@ -5,15 +5,36 @@
 #define LEBEDEV_HEADER_ONLY 1
 #endif
 
+#include "weighted_sum.hpp"
+#include "integration_workspace.hpp"
+#include "thread_pool.hpp"
 #include "quadrature_points.hpp"
 #include "quadrature_order.hpp"
 #include "generator_point.hpp"
+#include "quadrature_points_view.hpp"
+#include "rotated_quadrature_points.hpp"
+#include "rule_pack.hpp"
+#include "csv_table.hpp"
+#include "compressed_quadrature_points.hpp"
+#include "float_quadrature_points.hpp"
+#include "spherical_harmonics.hpp"
+#include "cubic_harmonics.hpp"
 
 #if LEBEDEV_HEADER_ONLY || LEBEDEV_IMPLEMENTATION
 
+#include "weighted_sum.inl"
+#include "integration_workspace.inl"
+#include "thread_pool.inl"
 #include "quadrature_points.inl"
 #include "quadrature_order.inl"
 #include "generator_point.inl"
+#include "quadrature_points_view.inl"
+#include "rotated_quadrature_points.inl"
+#include "rule_pack.inl"
+#include "csv_table.inl"
+#include "compressed_quadrature_points.inl"
+#include "spherical_harmonics.inl"
+#include "cubic_harmonics.inl"
 
 #endif
 
@@ -2,6 +2,7 @@
 #define QUADRATURE_ORDER_HPP
 
 #include "preprocessor.hpp"
+#include "generator_point.hpp"
 
 #include <array>
 
@@ -9,6 +10,37 @@ namespace lebedev {
 
 enum class QuadratureOrder : unsigned int;
 
+/** \brief Number of rules, whether or not they are available */
+constexpr unsigned int number_of_rules = 65;
+
+/**
+ * \brief Everything known about a quadrature rule, gathered in one table
+ * entry. See `get_rule_descriptor`.
+ */
+struct RuleDescriptor
+{
+    /** \brief Order enum of the rule */
+    QuadratureOrder order;
+    /** \brief Number of quadrature points */
+    unsigned int n_points;
+    /** \brief Highest degree of polynomial that can be integrated exactly */
+    unsigned int precision;
+    /** \brief Whether the rule is tabulated in this library */
+    bool available;
+    /** \brief Number of generator points with each generating rule, indexed by `OctahedralPointGeneration` */
+    unsigned int n_orbits[n_generating_rules];
+    /** \brief Number of generator points */
+    unsigned int n_generators;
+    /** \brief Returns tabulated generator points, or is `nullptr` if the rule is not available */
+    const GeneratorPoint* (*get_generator_points)();
+};
+
+/** \brief Gets descriptor of a rule from rule number, in constant time */
+const RuleDescriptor& get_rule_descriptor(unsigned int rule_number);
+
+/** \brief Gets descriptor of a rule from order enum, in constant time */
+const RuleDescriptor& get_rule_descriptor(QuadratureOrder quad_order);
+
 /** \brief Gets order enum from rule number. See README for rule number to order translation */
 QuadratureOrder get_rule_order(unsigned int rule_number);
 
@@ -18,6 +50,9 @@ bool get_rule_availability(unsigned int rule_number);
 /** \brief Returns the highest degree of polynomial that can be integrated exactly */
 unsigned int get_rule_precision(unsigned int rule_number);
 
+/** \brief Gets rule number from order enum. Inverse of `get_rule_order` */
+unsigned int get_rule_number(QuadratureOrder quad_order);
+
 /** \brief Gets `QuadratureOrder` enum value from a corresponding unsigned int */
 QuadratureOrder get_order_enum(unsigned int quadrature_order);
 
@@ -1,113 +1,222 @@
 #include "preprocessor.hpp"
 #include "quadrature_order.hpp"
+#include "generator_point.hpp"
+
+#if LEBEDEV_SPLIT_TABLES
+#include "generator_table.hpp"
+#else
+#include "generator_tables.hpp"
+#endif
 
 #include <stdexcept>
 
 namespace lebedev
 {
 
-constexpr unsigned int number_of_rules = 65;
-
-constexpr unsigned int n_orders = 65;
-constexpr std::array<bool, n_orders> rule_availability_table
-    = {true,    true,    true,    true,    true,    true,    true,    true,    true,    true,
-       true,    true,    true,    true,    true,    false,   true,    false,   false,   true, 
-       false,   false,   true,    false,   false,   true,    false,   false,   true,    false,
-       false,   true,    false,   false,   true,    false,   false,   true,    false,   false,
-       true,    false,   false,   true,    false,   false,   true,    false,   false,   true,
-       false,   false,   true,    false,   false,   true,    false,   false,   true,    false,
-       false,   true,    false,   false,   true };
-
-
-
-constexpr std::array<unsigned int, n_orders> rule_precision_table
-    = {   3,   5,   7,   9,  11,  13,  15,  17,  19,  21,
-         23,  25,  27,  29,  31,  33,  35,  37,  39,  41,
-         43,  45,  47,  49,  51,  53,  55,  57,  59,  61,
-         63,  65,  67,  69,  71,  73,  75,  77,  79,  81,
-         83,  85,  87,  89,  91,  93,  95,  97,  99, 101,
-        103, 105, 107, 109, 111, 113, 115, 117, 119, 121, 
-        123, 125, 127, 129, 131 };
-
-
-
-constexpr std::array<QuadratureOrder, n_orders> order_enum_table
-    = { QuadratureOrder::order_6,
-        QuadratureOrder::order_14,
-        QuadratureOrder::order_26,
-        QuadratureOrder::order_38,
-        QuadratureOrder::order_50,
-        QuadratureOrder::order_74,
-        QuadratureOrder::order_86,
-        QuadratureOrder::order_110,
-        QuadratureOrder::order_146,
-        QuadratureOrder::order_170,
-        QuadratureOrder::order_194,
-        QuadratureOrder::order_230,
-        QuadratureOrder::order_266,
-        QuadratureOrder::order_302,
-        QuadratureOrder::order_350,
-        QuadratureOrder::order_386,
-        QuadratureOrder::order_434,
-        QuadratureOrder::order_482,
-        QuadratureOrder::order_530,
-        QuadratureOrder::order_590,
-        QuadratureOrder::order_650,
-        QuadratureOrder::order_698,
-        QuadratureOrder::order_770,
-        QuadratureOrder::order_830,
-        QuadratureOrder::order_890,
-        QuadratureOrder::order_974,
-        QuadratureOrder::order_1046,
-        QuadratureOrder::order_1118,
-        QuadratureOrder::order_1202,
-        QuadratureOrder::order_1274,
-        QuadratureOrder::order_1358,
-        QuadratureOrder::order_1454,
-        QuadratureOrder::order_1538,
-        QuadratureOrder::order_1622,
-        QuadratureOrder::order_1730,
-        QuadratureOrder::order_1814,
-        QuadratureOrder::order_1910,
-        QuadratureOrder::order_2030,
-        QuadratureOrder::order_2126,
-        QuadratureOrder::order_2222,
-        QuadratureOrder::order_2354,
-        QuadratureOrder::order_2450,
-        QuadratureOrder::order_2558,
-        QuadratureOrder::order_2702,
-        QuadratureOrder::order_2810,
-        QuadratureOrder::order_2930,
-        QuadratureOrder::order_3074,
-        QuadratureOrder::order_3182,
-        QuadratureOrder::order_3314,
-        QuadratureOrder::order_3470,
-        QuadratureOrder::order_3590,
-        QuadratureOrder::order_3722,
-        QuadratureOrder::order_3890,
-        QuadratureOrder::order_4010,
-        QuadratureOrder::order_4154,
-        QuadratureOrder::order_4334,
-        QuadratureOrder::order_4466,
-        QuadratureOrder::order_4610,
-        QuadratureOrder::order_4802,
-        QuadratureOrder::order_4934,
-        QuadratureOrder::order_5090,
-        QuadratureOrder::order_5294,
-        QuadratureOrder::order_5438,
-        QuadratureOrder::order_5606,
-        QuadratureOrder::order_5810 
+#if LEBEDEV_SPLIT_TABLES
+/*
+ * The generator points of each order are compiled in their own translation
+ * unit (see `src/CMakeLists.txt`), so they must not be instantiated here.
+ */
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_6>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_14>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_26>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_38>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_50>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_74>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_86>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_110>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_146>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_170>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_194>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_230>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_266>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_302>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_350>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_434>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_590>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_770>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_974>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_1202>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_1454>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_1730>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_2030>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_2354>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_2702>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_3074>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_3470>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_3890>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_4334>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_4802>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_5294>();
+extern template const GeneratorPoint* get_generator_points<QuadratureOrder::order_5810>();
+#endif
+
+
+
+/**
+ * \brief Descriptors of all rules, indexed by rule number.
+ *
+ * Orbit counts are written out (rather than counted from the tables) so that
+ * this does not depend on the tabulated data, which may live in other
+ * translation units.
+ * Columns are: order, number of points, precision, availability, orbit counts
+ * in `OctahedralPointGeneration` order (6, 12, 8, 24, 24_axis, 48), number of
+ * generator points, and accessor for the generator points.
+ */
+constexpr std::array<RuleDescriptor, number_of_rules> rule_descriptor_table
+    = {{ {QuadratureOrder::order_6, 6, 3, true, {1, 0, 0, 0, 0, 0}, 1, &get_generator_points<QuadratureOrder::order_6>},
+        {QuadratureOrder::order_14, 14, 5, true, {1, 0, 1, 0, 0, 0}, 2, &get_generator_points<QuadratureOrder::order_14>},
+        {QuadratureOrder::order_26, 26, 7, true, {1, 1, 1, 0, 0, 0}, 3, &get_generator_points<QuadratureOrder::order_26>},
+        {QuadratureOrder::order_38, 38, 9, true, {1, 0, 1, 0, 1, 0}, 3, &get_generator_points<QuadratureOrder::order_38>},
+        {QuadratureOrder::order_50, 50, 11, true, {1, 1, 1, 1, 0, 0}, 4, &get_generator_points<QuadratureOrder::order_50>},
+        {QuadratureOrder::order_74, 74, 13, true, {1, 1, 1, 1, 1, 0}, 5, &get_generator_points<QuadratureOrder::order_74>},
+        {QuadratureOrder::order_86, 86, 15, true, {1, 0, 1, 2, 1, 0}, 5, &get_generator_points<QuadratureOrder::order_86>},
+        {QuadratureOrder::order_110, 110, 17, true, {1, 0, 1, 3, 1, 0}, 6, &get_generator_points<QuadratureOrder::order_110>},
+        {QuadratureOrder::order_146, 146, 19, true, {1, 1, 1, 3, 0, 1}, 7, &get_generator_points<QuadratureOrder::order_146>},
+        {QuadratureOrder::order_170, 170, 21, true, {1, 1, 1, 3, 1, 1}, 8, &get_generator_points<QuadratureOrder::order_170>},
+        {QuadratureOrder::order_194, 194, 23, true, {1, 1, 1, 4, 1, 1}, 9, &get_generator_points<QuadratureOrder::order_194>},
+        {QuadratureOrder::order_230, 230, 25, true, {1, 0, 1, 5, 2, 1}, 10, &get_generator_points<QuadratureOrder::order_230>},
+        {QuadratureOrder::order_266, 266, 27, true, {1, 1, 1, 5, 1, 2}, 11, &get_generator_points<QuadratureOrder::order_266>},
+        {QuadratureOrder::order_302, 302, 29, true, {1, 0, 1, 6, 2, 2}, 12, &get_generator_points<QuadratureOrder::order_302>},
+        {QuadratureOrder::order_350, 350, 31, true, {1, 0, 1, 6, 2, 3}, 13, &get_generator_points<QuadratureOrder::order_350>},
+        {QuadratureOrder::order_386, 386, 33, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_434, 434, 35, true, {1, 1, 1, 7, 2, 4}, 16, &get_generator_points<QuadratureOrder::order_434>},
+        {QuadratureOrder::order_482, 482, 37, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_530, 530, 39, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_590, 590, 41, true, {1, 0, 1, 9, 3, 6}, 20, &get_generator_points<QuadratureOrder::order_590>},
+        {QuadratureOrder::order_650, 650, 43, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_698, 698, 45, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_770, 770, 47, true, {1, 1, 1, 10, 3, 9}, 25, &get_generator_points<QuadratureOrder::order_770>},
+        {QuadratureOrder::order_830, 830, 49, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_890, 890, 51, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_974, 974, 53, true, {1, 0, 1, 12, 4, 12}, 30, &get_generator_points<QuadratureOrder::order_974>},
+        {QuadratureOrder::order_1046, 1046, 55, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_1118, 1118, 57, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_1202, 1202, 59, true, {1, 1, 1, 13, 4, 16}, 36, &get_generator_points<QuadratureOrder::order_1202>},
+        {QuadratureOrder::order_1274, 1274, 61, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_1358, 1358, 63, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_1454, 1454, 65, true, {1, 0, 1, 15, 5, 20}, 42, &get_generator_points<QuadratureOrder::order_1454>},
+        {QuadratureOrder::order_1538, 1538, 67, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_1622, 1622, 69, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_1730, 1730, 71, true, {1, 1, 1, 16, 5, 25}, 49, &get_generator_points<QuadratureOrder::order_1730>},
+        {QuadratureOrder::order_1814, 1814, 73, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_1910, 1910, 75, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_2030, 2030, 77, true, {1, 0, 1, 18, 6, 30}, 56, &get_generator_points<QuadratureOrder::order_2030>},
+        {QuadratureOrder::order_2126, 2126, 79, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_2222, 2222, 81, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_2354, 2354, 83, true, {1, 1, 1, 19, 6, 36}, 64, &get_generator_points<QuadratureOrder::order_2354>},
+        {QuadratureOrder::order_2450, 2450, 85, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_2558, 2558, 87, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_2702, 2702, 89, true, {1, 0, 1, 21, 7, 42}, 72, &get_generator_points<QuadratureOrder::order_2702>},
+        {QuadratureOrder::order_2810, 2810, 91, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_2930, 2930, 93, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_3074, 3074, 95, true, {1, 1, 1, 22, 7, 49}, 81, &get_generator_points<QuadratureOrder::order_3074>},
+        {QuadratureOrder::order_3182, 3182, 97, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_3314, 3314, 99, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_3470, 3470, 101, true, {1, 0, 1, 24, 8, 56}, 90, &get_generator_points<QuadratureOrder::order_3470>},
+        {QuadratureOrder::order_3590, 3590, 103, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_3722, 3722, 105, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_3890, 3890, 107, true, {1, 1, 1, 25, 8, 64}, 100, &get_generator_points<QuadratureOrder::order_3890>},
+        {QuadratureOrder::order_4010, 4010, 109, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_4154, 4154, 111, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_4334, 4334, 113, true, {1, 0, 1, 27, 9, 72}, 110, &get_generator_points<QuadratureOrder::order_4334>},
+        {QuadratureOrder::order_4466, 4466, 115, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_4610, 4610, 117, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_4802, 4802, 119, true, {1, 1, 1, 28, 9, 81}, 121, &get_generator_points<QuadratureOrder::order_4802>},
+        {QuadratureOrder::order_4934, 4934, 121, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_5090, 5090, 123, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_5294, 5294, 125, true, {1, 0, 1, 30, 10, 90}, 132, &get_generator_points<QuadratureOrder::order_5294>},
+        {QuadratureOrder::order_5438, 5438, 127, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_5606, 5606, 129, false, {0, 0, 0, 0, 0, 0}, 0, nullptr},
+        {QuadratureOrder::order_5810, 5810, 131, true, {1, 1, 1, 31, 10, 100}, 144, &get_generator_points<QuadratureOrder::order_5810>} }};
+
+
+
+/** \brief Largest number of points of any rule */
+constexpr unsigned int max_n_points = 5810;
+
+/** \brief Marks an order which does not correspond to any rule */
+constexpr unsigned char no_rule_number = 255;
+
+/**
+ * \brief Rule number of each order, indexed by half the number of points
+ * (all orders are even), or `no_rule_number` if there is no such rule.
+ */
+struct RuleNumberTable
+{
+    unsigned char rule_numbers[max_n_points / 2 + 1];
 };
 
 
 
+constexpr RuleNumberTable make_rule_number_table()
+{
+    RuleNumberTable table{};
+    for (unsigned int i = 0; i <= max_n_points / 2; ++i)
+        table.rule_numbers[i] = no_rule_number;
+
+    for (unsigned int rule_number = 0; rule_number < number_of_rules; ++rule_number)
+        table.rule_numbers[rule_descriptor_table[rule_number].n_points / 2] 
+            = static_cast<unsigned char>(rule_number);
+
+    return table;
+}
+
+constexpr RuleNumberTable rule_number_table = make_rule_number_table();
+
+
+
+/** \brief Rule number of order with `n_points` points, or `no_rule_number` */
+LEBEDEV_INTERNAL_LINKAGE
+unsigned int find_rule_number(unsigned int n_points)
+{
+    if (n_points > max_n_points || n_points % 2 != 0)
+        return no_rule_number;
+
+    return rule_number_table.rule_numbers[n_points / 2];
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+const RuleDescriptor& get_rule_descriptor(unsigned int rule_number)
+{
+    if (rule_number >= number_of_rules)
+        throw std::invalid_argument("Requested descriptor of a rule which exceeds number of rules");
+
+    return rule_descriptor_table[rule_number];
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+const RuleDescriptor& get_rule_descriptor(QuadratureOrder quad_order)
+{
+    return rule_descriptor_table[get_rule_number(quad_order)];
+}
+
+
+
 LEBEDEV_EXTERNAL_LINKAGE
 QuadratureOrder get_rule_order(unsigned int rule_number)
 {
     if (rule_number >= number_of_rules)
         throw std::invalid_argument("Requested order of a rule which exceeds number of rules");
 
-    return order_enum_table[rule_number];
+    return rule_descriptor_table[rule_number].order;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+unsigned int get_rule_number(QuadratureOrder quad_order)
+{
+    const unsigned int rule_number = find_rule_number(static_cast<unsigned int>(quad_order));
+    if (rule_number == no_rule_number)
+        throw std::invalid_argument("Requested rule number of order which does not exist");
+
+    return rule_number;
 }
 
 
@@ -118,7 +227,7 @@ bool get_rule_availability(unsigned int rule_number)
     if (rule_number >= number_of_rules)
         throw std::invalid_argument("Requested availability of a rule which exceeds number of rules");
 
-    return rule_availability_table[rule_number];
+    return rule_descriptor_table[rule_number].available;
 }
 
 
@@ -129,7 +238,7 @@ unsigned int get_rule_precision(unsigned int rule_number)
     if (rule_number >= number_of_rules)
         throw std::invalid_argument("Requested precision of a rule which exceeds number of rules");
     
-    return rule_precision_table[rule_number];
+    return rule_descriptor_table[rule_number].precision;
 }
 
 
@@ -137,138 +246,11 @@ unsigned int get_rule_precision(unsigned int rule_number)
 LEBEDEV_EXTERNAL_LINKAGE
 QuadratureOrder get_order_enum(unsigned int quadrature_order)
 {
-    if (quadrature_order == 6)
-        return QuadratureOrder::order_6; 
-    else if (quadrature_order == 14)
-        return QuadratureOrder::order_14; 
-    else if (quadrature_order == 26)
-        return QuadratureOrder::order_26; 
-    else if (quadrature_order == 38)
-        return QuadratureOrder::order_38; 
-    else if (quadrature_order == 50)
-        return QuadratureOrder::order_50; 
-    else if (quadrature_order == 74)
-        return QuadratureOrder::order_74; 
-    else if (quadrature_order == 86)
-        return QuadratureOrder::order_86; 
-    else if (quadrature_order == 110)
-        return QuadratureOrder::order_110; 
-    else if (quadrature_order == 146)
-        return QuadratureOrder::order_146; 
-    else if (quadrature_order == 170)
-        return QuadratureOrder::order_170; 
-    else if (quadrature_order == 194)
-        return QuadratureOrder::order_194; 
-    else if (quadrature_order == 230)
-        return QuadratureOrder::order_230; 
-    else if (quadrature_order == 266)
-        return QuadratureOrder::order_266; 
-    else if (quadrature_order == 302)
-        return QuadratureOrder::order_302; 
-    else if (quadrature_order == 350)
-        return QuadratureOrder::order_350; 
-    else if (quadrature_order == 386)
-        return QuadratureOrder::order_386; 
-    else if (quadrature_order == 434)
-        return QuadratureOrder::order_434; 
-    else if (quadrature_order == 482)
-        return QuadratureOrder::order_482; 
-    else if (quadrature_order == 530)
-        return QuadratureOrder::order_530; 
-    else if (quadrature_order == 590)
-        return QuadratureOrder::order_590; 
-    else if (quadrature_order == 650)
-        return QuadratureOrder::order_650; 
-    else if (quadrature_order == 698)
-        return QuadratureOrder::order_698; 
-    else if (quadrature_order == 770)
-        return QuadratureOrder::order_770; 
-    else if (quadrature_order == 830)
-        return QuadratureOrder::order_830; 
-    else if (quadrature_order == 890)
-        return QuadratureOrder::order_890; 
-    else if (quadrature_order == 974)
-        return QuadratureOrder::order_974; 
-    else if (quadrature_order == 1046)
-        return QuadratureOrder::order_1046; 
-    else if (quadrature_order == 1118)
-        return QuadratureOrder::order_1118; 
-    else if (quadrature_order == 1202)
-        return QuadratureOrder::order_1202; 
-    else if (quadrature_order == 1274)
-        return QuadratureOrder::order_1274; 
-    else if (quadrature_order == 1358)
-        return QuadratureOrder::order_1358; 
-    else if (quadrature_order == 1454)
-        return QuadratureOrder::order_1454; 
-    else if (quadrature_order == 1538)
-        return QuadratureOrder::order_1538; 
-    else if (quadrature_order == 1622)
-        return QuadratureOrder::order_1622; 
-    else if (quadrature_order == 1730)
-        return QuadratureOrder::order_1730; 
-    else if (quadrature_order == 1814)
-        return QuadratureOrder::order_1814; 
-    else if (quadrature_order == 1910)
-        return QuadratureOrder::order_1910; 
-    else if (quadrature_order == 2030)
-        return QuadratureOrder::order_2030; 
-    else if (quadrature_order == 2126)
-        return QuadratureOrder::order_2126; 
-    else if (quadrature_order == 2222)
-        return QuadratureOrder::order_2222; 
-    else if (quadrature_order == 2354)
-        return QuadratureOrder::order_2354; 
-    else if (quadrature_order == 2450)
-        return QuadratureOrder::order_2450; 
-    else if (quadrature_order == 2558)
-        return QuadratureOrder::order_2558; 
-    else if (quadrature_order == 2702)
-        return QuadratureOrder::order_2702; 
-    else if (quadrature_order == 2810)
-        return QuadratureOrder::order_2810; 
-    else if (quadrature_order == 2930)
-        return QuadratureOrder::order_2930; 
-    else if (quadrature_order == 3074)
-        return QuadratureOrder::order_3074; 
-    else if (quadrature_order == 3182)
-        return QuadratureOrder::order_3182; 
-    else if (quadrature_order == 3314)
-        return QuadratureOrder::order_3314; 
-    else if (quadrature_order == 3470)
-        return QuadratureOrder::order_3470; 
-    else if (quadrature_order == 3590)
-        return QuadratureOrder::order_3590; 
-    else if (quadrature_order == 3722)
-        return QuadratureOrder::order_3722; 
-    else if (quadrature_order == 3890)
-        return QuadratureOrder::order_3890; 
-    else if (quadrature_order == 4010)
-        return QuadratureOrder::order_4010; 
-    else if (quadrature_order == 4154)
-        return QuadratureOrder::order_4154; 
-    else if (quadrature_order == 4334)
-        return QuadratureOrder::order_4334; 
-    else if (quadrature_order == 4466)
-        return QuadratureOrder::order_4466; 
-    else if (quadrature_order == 4610)
-        return QuadratureOrder::order_4610; 
-    else if (quadrature_order == 4802)
-        return QuadratureOrder::order_4802; 
-    else if (quadrature_order == 4934)
-        return QuadratureOrder::order_4934; 
-    else if (quadrature_order == 5090)
-        return QuadratureOrder::order_5090; 
-    else if (quadrature_order == 5294)
-        return QuadratureOrder::order_5294; 
-    else if (quadrature_order == 5438)
-        return QuadratureOrder::order_5438; 
-    else if (quadrature_order == 5606)
-        return QuadratureOrder::order_5606; 
-    else if (quadrature_order == 5810)
-        return QuadratureOrder::order_5810;
-    else
+    const unsigned int rule_number = find_rule_number(quadrature_order);
+    if (rule_number == no_rule_number)
         throw std::invalid_argument("Requested enum for lebedev order which does not exist");
+
+    return rule_descriptor_table[rule_number].order;
 }
 
 } // namespace lebedev
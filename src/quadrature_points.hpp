@@ -3,9 +3,20 @@
 
 #include "preprocessor.hpp"
 #include "quadrature_order.hpp"
+#include "generator_point.hpp"
+#include "weighted_sum.hpp"
+#include "integration_workspace.hpp"
+#include "thread_pool.hpp"
+#include "quadrature_points_view.hpp"
 
 #include <vector>
+#include <complex>
 #include <functional>
+#include <memory>
+#include <cstddef>
+#include <cmath>
+#include <type_traits>
+#include <utility>
 
 /**
  * \namespace lebedev
@@ -26,10 +37,43 @@ public:
     using scalar_function = std::function<double(double, double, double)>;
     /** \brief vector of doubles */
     using vector_function = std::function<vec(const vec&, const vec&, const vec&)>;
+    /** \brief function writing its values at `n` points into caller-provided storage */
+    using output_function = std::function<void(const double*, const double*, const double*, 
+                                               std::size_t, double*)>;
+    /** \brief function writing the values of several integrands at one point */
+    using multi_function = std::function<void(double, double, double, double*)>;
+    /** \brief complex-valued scalar_function */
+    using complex_function = std::function<std::complex<double>(double, double, double)>;
+    /** \brief complex-valued vector_function */
+    using complex_vector_function 
+        = std::function<std::vector<std::complex<double>>(const vec&, const vec&, const vec&)>;
 
     /** \brief Calculates set of quadrature points based on integration order */
     QuadraturePoints(QuadratureOrder quad_order);
 
+    /** \brief Calculates set of quadrature points from generator points
+     *
+     * This allows rules which are read at runtime (see `read_generator_table`)
+     * to be used in the same way as the tabulated ones.
+     */
+    explicit QuadraturePoints(const std::vector<GeneratorPoint> &generator_points);
+
+    /** \brief Returns a handle to a process-wide, immutable copy of a rule.
+     *
+     * Each order is only calculated on first request, and every later call
+     * (from any thread) returns a handle to that same object.
+     * Handles are cheap to copy, so this is preferable to constructing a
+     * `QuadraturePoints` wherever the same rule is needed many times.
+     */
+    static std::shared_ptr<const QuadraturePoints> 
+    shared(QuadratureOrder quad_order);
+
+    /** \brief Returns number of bytes held by the rules created by `shared` */
+    static std::size_t shared_memory_usage();
+
+    /** \brief Returns number of bytes held by this set of quadrature points */
+    std::size_t memory_usage() const;
+
     /** \brief Calculates spherical integral given a function object.
      *
      * The function object `integrand_at_point` takes three doubles `x`, `y`, `z`
@@ -46,10 +90,275 @@ public:
      * at which the integrand will be evaluated.
      * It should return a vector of doubles corresponding to the integrand 
      * evaluated at all of the quadrature points.
+     * The weighted sum of these uses the SIMD kernels of `weighted_sum`.
      */
     double 
     evaluate_spherical_integral(const vector_function& integrand_at_points) const;
 
+    /** \brief Calculates spherical integral of a complex-valued function
+     * object, evaluating it once per point.
+     *
+     * The real and imaginary parts are summed in separate accumulators,
+     * rather than integrating each part with its own pass over the points.
+     */
+    std::complex<double> 
+    evaluate_spherical_integral(const complex_function& integrand_at_point) const;
+
+    /** \brief Calculates spherical integral of a complex-valued function
+     * object which returns the integrand at all of the quadrature points.
+     *
+     * The weighted sum uses the SIMD kernels of `complex_weighted_sum`.
+     */
+    std::complex<double> 
+    evaluate_spherical_integral(const complex_vector_function& integrand_at_points) const;
+
+    /** \brief Calculates spherical integral given any callable.
+     *
+     * Same as the `scalar_function` overload, but `integrand_at_point` is
+     * called directly rather than through a `std::function`, so that it can
+     * be inlined into the summation loop.
+     * `std::function` arguments still go to the non-template overload.
+     */
+    template <typename ScalarFunction>
+    auto evaluate_spherical_integral(const ScalarFunction &integrand_at_point) const
+        -> decltype(static_cast<double>(integrand_at_point(0.0, 0.0, 0.0)))
+    {
+        return QuadraturePointsView(*this).evaluate_spherical_integral(integrand_at_point);
+    }
+
+    /** \brief Calculates spherical integral given any callable, with the
+     * points split across the threads of `pool`.
+     *
+     * Worthwhile for large orders with integrands that are expensive to
+     * evaluate; the points are taken `grain_size` at a time, and no threads
+     * are involved if there are no more than `grain_size` points.
+     * See `parallel_weighted_sum`.
+     * `integrand_at_point` is called from several threads at once.
+     */
+    template <typename ScalarFunction>
+    auto evaluate_spherical_integral(const ScalarFunction &integrand_at_point,
+                                     ThreadPool &pool,
+                                     std::size_t grain_size = default_grain_size) const
+        -> decltype(static_cast<double>(integrand_at_point(0.0, 0.0, 0.0)))
+    {
+        return QuadraturePointsView(*this).evaluate_spherical_integral(integrand_at_point, pool,
+                                                                       grain_size);
+    }
+
+    /** \brief Calculates spherical integral of each component of an
+     * array-valued integrand, in one pass.
+     *
+     * `integrand_at_point` may be any callable which takes three doubles
+     * `x`, `y`, `z` and returns a `std::array<double, K>` (e.g. the
+     * independent components of a tensor), which is called once per point,
+     * so any work shared between components is only done once.
+     * Returns the integrals of the components.
+     */
+    template <typename ArrayFunction>
+    auto evaluate_spherical_integral(const ArrayFunction &integrand_at_point) const
+        -> typename array_integrand_result<
+               typename std::decay<decltype(integrand_at_point(0.0, 0.0, 0.0))>::type>::type
+    {
+        return QuadraturePointsView(*this).evaluate_spherical_integral(integrand_at_point);
+    }
+
+    /** \brief Calculates spherical integral given any callable.
+     *
+     * Same as the `vector_function` overload, but `integrand_at_points` may
+     * be any callable returning a contiguous container of doubles (with
+     * `data()` and `size()`, e.g. `std::vector<double>`), which is called
+     * directly rather than through a `std::function`.
+     */
+    template <typename VectorFunction>
+    auto evaluate_spherical_integral(const VectorFunction &integrand_at_points) const
+        -> decltype(static_cast<double>(integrand_at_points(std::declval<const vec&>(),
+                                                            std::declval<const vec&>(),
+                                                            std::declval<const vec&>())[0]))
+    {
+        const auto integrand_vals = integrand_at_points(x, y, z);
+
+        return 4 * M_PI * weighted_sum(integrand_vals.data(), weights.data(), integrand_vals.size());
+    }
+
+    /** \brief Calculates spherical integral given any callable returning
+     * `std::complex<double>`, called directly.
+     */
+    template <typename ComplexFunction>
+    auto evaluate_spherical_integral(const ComplexFunction &integrand_at_point) const
+        -> typename complex_integrand_result<
+               typename std::decay<decltype(integrand_at_point(0.0, 0.0, 0.0))>::type>::type
+    {
+        return QuadraturePointsView(*this).evaluate_spherical_integral(integrand_at_point);
+    }
+
+    /** \brief Calculates spherical integral given any callable returning a
+     * contiguous container of `std::complex<double>` (e.g.
+     * `std::vector<std::complex<double>>`) at all of the quadrature points.
+     */
+    template <typename ComplexVectorFunction>
+    auto evaluate_spherical_integral(const ComplexVectorFunction &integrand_at_points) const
+        -> typename complex_integrand_result<
+               typename std::decay<decltype(integrand_at_points(std::declval<const vec&>(),
+                                                                std::declval<const vec&>(),
+                                                                std::declval<const vec&>())[0])>::type>::type
+    {
+        const auto integrand_vals = integrand_at_points(x, y, z);
+
+        return 4 * M_PI * complex_weighted_sum(integrand_vals.data(), weights.data(), 
+                                               integrand_vals.size());
+    }
+
+    /** \brief Calculates spherical integral given a function object which
+     * writes its values into `values`, without allocating.
+     *
+     * The function object `integrand_at_points` takes pointers to the
+     * coordinates `x`, `y`, `z` of the quadrature points, their number `n`,
+     * and a pointer `values` to `n` doubles, into which it should write the
+     * integrand evaluated at each of the points.
+     * `values` must have room for a value at every quadrature point.
+     */
+    double 
+    evaluate_spherical_integral(const output_function& integrand_at_points,
+                                double *values) const;
+
+    /** \brief Calculates spherical integral given a function object which
+     * writes its values into `workspace`, without allocating once 
+     * `workspace` is large enough for this rule.
+     */
+    double 
+    evaluate_spherical_integral(const output_function& integrand_at_points,
+                                IntegrationWorkspace &workspace) const;
+
+    /** \brief Calculates spherical integral given any callable which writes
+     * its values into `values`.
+     *
+     * Same as the `output_function` overload, but `integrand_at_points` is
+     * called directly, which also avoids the allocation that wrapping a
+     * lambda with large captures in a `std::function` may make.
+     */
+    template <typename OutputFunction>
+    auto evaluate_spherical_integral(const OutputFunction &integrand_at_points,
+                                     double *values) const
+        -> decltype(integrand_at_points(std::declval<const double*>(), std::declval<const double*>(),
+                                        std::declval<const double*>(), std::size_t(), values), 
+                    double())
+    {
+        return QuadraturePointsView(*this).evaluate_spherical_integral(integrand_at_points, values);
+    }
+
+    /** \brief Calculates spherical integral given any callable which writes
+     * its values into `workspace`.
+     */
+    template <typename OutputFunction>
+    auto evaluate_spherical_integral(const OutputFunction &integrand_at_points,
+                                     IntegrationWorkspace &workspace) const
+        -> decltype(integrand_at_points(std::declval<const double*>(), std::declval<const double*>(),
+                                        std::declval<const double*>(), std::size_t(), 
+                                        workspace.get_values(0)), 
+                    double())
+    {
+        return QuadraturePointsView(*this).evaluate_spherical_integral(integrand_at_points, 
+                                                                       workspace);
+    }
+
+    /** \brief Calculates spherical integral given a function object
+     * returning the integrand at all points, adding up the weighted values
+     * according to `summation`.
+     *
+     * The more accurate policies recover the digits a naive sum loses when
+     * the integrand has large values which cancel, without moving to a
+     * larger rule.
+     */
+    double 
+    evaluate_spherical_integral(const vector_function& integrand_at_points,
+                                Summation summation) const;
+
+    /** \brief Calculates spherical integral given a function object which
+     * writes its values into `workspace`, adding them up according to
+     * `summation`.
+     */
+    double 
+    evaluate_spherical_integral(const output_function& integrand_at_points,
+                                IntegrationWorkspace &workspace,
+                                Summation summation) const;
+
+    /** \brief Calculates spherical integral given any callable returning the
+     * integrand at all points, adding up the values according to `summation`.
+     */
+    template <typename VectorFunction>
+    auto evaluate_spherical_integral(const VectorFunction &integrand_at_points,
+                                     Summation summation) const
+        -> decltype(static_cast<double>(integrand_at_points(std::declval<const vec&>(),
+                                                            std::declval<const vec&>(),
+                                                            std::declval<const vec&>())[0]))
+    {
+        const auto integrand_vals = integrand_at_points(x, y, z);
+
+        return 4 * M_PI * weighted_sum(summation, integrand_vals.data(), 
+                                       weights.data(), integrand_vals.size());
+    }
+
+    /** \brief Calculates spherical integral given any callable which writes
+     * its values into `workspace`, adding them up according to `summation`.
+     */
+    template <typename OutputFunction>
+    auto evaluate_spherical_integral(const OutputFunction &integrand_at_points,
+                                     IntegrationWorkspace &workspace,
+                                     Summation summation) const
+        -> decltype(integrand_at_points(std::declval<const double*>(), std::declval<const double*>(),
+                                        std::declval<const double*>(), std::size_t(), 
+                                        workspace.get_values(0)), 
+                    double())
+    {
+        return QuadraturePointsView(*this).evaluate_spherical_integral(integrand_at_points, 
+                                                                       workspace, summation);
+    }
+
+    /** \brief Calculates the spherical integrals of `n_integrands` functions
+     * at once, given their values.
+     *
+     * `values` holds the values of each function at all of the quadrature
+     * points, one function after another (i.e. an `n_integrands` by `size`
+     * row-major matrix), and the integrals are written to `integrals`.
+     * This is a matrix-vector product, blocked so that the weights are only
+     * read from memory once for all of the functions.
+     */
+    void 
+    evaluate_spherical_integrals(const double *values, 
+                                 std::size_t n_integrands, 
+                                 double *integrals) const;
+
+    /** \brief Calculates the spherical integrals of `n_integrands` functions
+     * at once, given a function object which evaluates all of them.
+     *
+     * The function object `integrands_at_point` takes three doubles `x`, `y`,
+     * `z` corresponding to the coordinates of the evaluation point, and a 
+     * pointer `values` to `n_integrands` doubles, into which it should write
+     * each function evaluated at that point.
+     * Points are handled in blocks of `integration_block_size`, whose values
+     * are kept in `workspace`, and the integrals are written to `integrals`.
+     */
+    void 
+    evaluate_spherical_integrals(const multi_function& integrands_at_point,
+                                 std::size_t n_integrands, 
+                                 double *integrals,
+                                 IntegrationWorkspace &workspace) const;
+
+    /** \brief Calculates the spherical integrals of `n_integrands` functions
+     * at once, given any callable which evaluates all of them, called
+     * directly.
+     */
+    template <typename MultiFunction>
+    auto evaluate_spherical_integrals(const MultiFunction& integrands_at_point,
+                                      std::size_t n_integrands, 
+                                      double *integrals,
+                                      IntegrationWorkspace &workspace) const
+        -> decltype(integrands_at_point(0.0, 0.0, 0.0, integrals), void())
+    {
+        QuadraturePointsView(*this).evaluate_spherical_integrals(integrands_at_point, n_integrands,
+                                                                 integrals, workspace);
+    }
+
     /** \brief Returns const reference to vector of x-coordinates of quadrature points */
     const vec& get_x() const;
     /** \brief Returns const reference to vector of y-coordinates of quadrature points */
@@ -71,6 +380,36 @@ private:
     vec weights;
 };
 
+/**
+ * \brief Writes the points and weights of a rule straight into caller-provided
+ * arrays, without allocating.
+ *
+ * Each of `x`, `y`, `z`, and `weights` must have room for 
+ * `get_rule_descriptor(quad_order).n_points` doubles.
+ * They may all point into one block of memory (e.g. `x`, `x + n`, `x + 2*n`, 
+ * `x + 3*n`), so that a rule takes a single allocation.
+ * The points are in the same order as those of `QuadraturePoints`.
+ */
+void generate_quadrature_points(QuadratureOrder quad_order, 
+                                double *x, 
+                                double *y, 
+                                double *z, 
+                                double *weights);
+
+/**
+ * \brief Writes the points and weights generated by `n_generators` generator
+ * points straight into caller-provided arrays, without allocating.
+ *
+ * Each of `x`, `y`, `z`, and `weights` must have room for the sum of
+ * `n_points()` of the generator points.
+ */
+void generate_quadrature_points(const GeneratorPoint *generator_points,
+                                std::size_t n_generators,
+                                double *x, 
+                                double *y, 
+                                double *z, 
+                                double *weights);
+
 } // namespace lebedev
 
 #endif
@@ -0,0 +1,289 @@
+#ifndef QUADRATURE_POINTS_VIEW_HPP
+#define QUADRATURE_POINTS_VIEW_HPP
+
+#include "preprocessor.hpp"
+#include "integration_workspace.hpp"
+#include "weighted_sum.hpp"
+#include "thread_pool.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace lebedev {
+
+class QuadraturePoints;
+
+/**
+ * \brief Non-owning view of quadrature points and weights which are stored
+ * elsewhere (e.g. in a `QuadraturePoints`, caller-provided buffers, or a
+ * memory-mapped `RulePack`).
+ *
+ * The view is only valid as long as the storage it refers to.
+ * The integration loops over contiguous points are all written here, and
+ * `QuadraturePoints` forwards to a view of its own points.
+ */
+class QuadraturePointsView
+{
+public:
+    /** \brief scalar_function, as `QuadraturePoints::scalar_function` */
+    using scalar_function = std::function<double(double, double, double)>;
+    /** \brief output_function, as `QuadraturePoints::output_function` */
+    using output_function = std::function<void(const double*, const double*, const double*, 
+                                               std::size_t, double*)>;
+    /** \brief multi_function, as `QuadraturePoints::multi_function` */
+    using multi_function = std::function<void(double, double, double, double*)>;
+    /** \brief complex_function, as `QuadraturePoints::complex_function` */
+    using complex_function = std::function<std::complex<double>(double, double, double)>;
+
+    /** \brief Views `n_points` points and weights stored in the given arrays */
+    QuadraturePointsView(const double *x, 
+                         const double *y, 
+                         const double *z, 
+                         const double *weights, 
+                         std::size_t n_points);
+
+    /** \brief Views the points and weights of `quad_points` */
+    QuadraturePointsView(const QuadraturePoints &quad_points);
+
+    /** \brief Calculates spherical integral given a function object.
+     *
+     * The function object `integrand_at_point` takes three doubles `x`, `y`, `z`
+     * corresponding to the coordinates of the evaluation point.
+     * It should return a double corresponding to the integrand evaluated at that point.
+     */
+    double 
+    evaluate_spherical_integral(const scalar_function& integrand_at_point) const;
+
+    /** \brief Calculates spherical integral of a complex-valued function
+     * object, evaluating it once per point and summing the real and
+     * imaginary parts in separate accumulators.
+     */
+    std::complex<double> 
+    evaluate_spherical_integral(const complex_function& integrand_at_point) const;
+
+    /** \brief Calculates spherical integral given any callable.
+     *
+     * Same as the `scalar_function` overload, but `integrand_at_point` is
+     * called directly, so that it can be inlined into the summation loop.
+     */
+    template <typename ScalarFunction>
+    auto evaluate_spherical_integral(const ScalarFunction &integrand_at_point) const
+        -> decltype(static_cast<double>(integrand_at_point(0.0, 0.0, 0.0)))
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < n_points; ++i)
+            sum += integrand_at_point(x[i], y[i], z[i]) * weights[i];
+
+        return 4 * M_PI * sum;
+    }
+
+    /** \brief Calculates spherical integral given any callable, with the
+     * points split across the threads of `pool`.
+     *
+     * Worthwhile for large orders with integrands that are expensive to
+     * evaluate; the points are taken `grain_size` at a time, and no threads
+     * are involved if there are no more than `grain_size` points.
+     * See `parallel_weighted_sum`.
+     * `integrand_at_point` is called from several threads at once.
+     */
+    template <typename ScalarFunction>
+    auto evaluate_spherical_integral(const ScalarFunction &integrand_at_point,
+                                     ThreadPool &pool,
+                                     std::size_t grain_size = default_grain_size) const
+        -> decltype(static_cast<double>(integrand_at_point(0.0, 0.0, 0.0)))
+    {
+        return 4 * M_PI * parallel_weighted_sum(integrand_at_point, x, y, z, weights, n_points, 
+                                                pool, grain_size);
+    }
+
+    /** \brief Calculates spherical integral of each component of an
+     * array-valued integrand, in one pass.
+     *
+     * `integrand_at_point` may be any callable which takes three doubles
+     * `x`, `y`, `z` and returns a `std::array<double, K>` (e.g. the
+     * independent components of a tensor), which is called once per point,
+     * so any work shared between components is only done once.
+     * Returns the integrals of the components.
+     */
+    template <typename ArrayFunction>
+    auto evaluate_spherical_integral(const ArrayFunction &integrand_at_point) const
+        -> typename array_integrand_result<
+               typename std::decay<decltype(integrand_at_point(0.0, 0.0, 0.0))>::type>::type
+    {
+        typename std::decay<decltype(integrand_at_point(0.0, 0.0, 0.0))>::type sum = {};
+        for (std::size_t i = 0; i < n_points; ++i)
+            accumulate_weighted(sum, weights[i], integrand_at_point(x[i], y[i], z[i]));
+
+        for (double &component : sum)
+            component *= 4 * M_PI;
+
+        return sum;
+    }
+
+    /** \brief Calculates spherical integral given any callable returning
+     * `std::complex<double>`, called directly.
+     */
+    template <typename ComplexFunction>
+    auto evaluate_spherical_integral(const ComplexFunction &integrand_at_point) const
+        -> typename complex_integrand_result<
+               typename std::decay<decltype(integrand_at_point(0.0, 0.0, 0.0))>::type>::type
+    {
+        double real_sum = 0;
+        double imag_sum = 0;
+        for (std::size_t i = 0; i < n_points; ++i)
+        {
+            const std::complex<double> value = integrand_at_point(x[i], y[i], z[i]);
+            real_sum += value.real() * weights[i];
+            imag_sum += value.imag() * weights[i];
+        }
+
+        return {4 * M_PI * real_sum, 4 * M_PI * imag_sum};
+    }
+
+    /** \brief Calculates spherical integral given a function object which
+     * writes its values into `values`, without allocating.
+     *
+     * See `QuadraturePoints::evaluate_spherical_integral` for the arguments
+     * `integrand_at_points` is called with.
+     * `values` must have room for a value at every quadrature point.
+     */
+    double 
+    evaluate_spherical_integral(const output_function& integrand_at_points,
+                                double *values) const;
+
+    /** \brief Calculates spherical integral given a function object which
+     * writes its values into `workspace`, without allocating once 
+     * `workspace` is large enough for this rule.
+     */
+    double 
+    evaluate_spherical_integral(const output_function& integrand_at_points,
+                                IntegrationWorkspace &workspace) const;
+
+    /** \brief Calculates spherical integral given any callable which writes
+     * its values into `values`, called directly.
+     */
+    template <typename OutputFunction>
+    auto evaluate_spherical_integral(const OutputFunction &integrand_at_points,
+                                     double *values) const
+        -> decltype(integrand_at_points(std::declval<const double*>(), std::declval<const double*>(),
+                                        std::declval<const double*>(), std::size_t(), values), 
+                    double())
+    {
+        integrand_at_points(x, y, z, n_points, values);
+
+        return 4 * M_PI * weighted_sum(values, weights, n_points);
+    }
+
+    /** \brief Calculates spherical integral given any callable which writes
+     * its values into `workspace`, called directly.
+     */
+    template <typename OutputFunction>
+    auto evaluate_spherical_integral(const OutputFunction &integrand_at_points,
+                                     IntegrationWorkspace &workspace) const
+        -> decltype(integrand_at_points(std::declval<const double*>(), std::declval<const double*>(),
+                                        std::declval<const double*>(), std::size_t(), 
+                                        workspace.get_values(0)), 
+                    double())
+    {
+        return evaluate_spherical_integral(integrand_at_points, workspace.get_values(n_points));
+    }
+
+    /** \brief Calculates spherical integral given a function object which
+     * writes its values into `workspace`, adding them up according to
+     * `summation`.
+     */
+    double 
+    evaluate_spherical_integral(const output_function& integrand_at_points,
+                                IntegrationWorkspace &workspace,
+                                Summation summation) const;
+
+    /** \brief Calculates spherical integral given any callable which writes
+     * its values into `workspace`, adding them up according to `summation`.
+     */
+    template <typename OutputFunction>
+    auto evaluate_spherical_integral(const OutputFunction &integrand_at_points,
+                                     IntegrationWorkspace &workspace,
+                                     Summation summation) const
+        -> decltype(integrand_at_points(std::declval<const double*>(), std::declval<const double*>(),
+                                        std::declval<const double*>(), std::size_t(), 
+                                        workspace.get_values(0)), 
+                    double())
+    {
+        double *values = workspace.get_values(n_points);
+        integrand_at_points(x, y, z, n_points, values);
+
+        return 4 * M_PI * weighted_sum(summation, values, weights, n_points);
+    }
+
+    /** \brief Calculates the spherical integrals of `n_integrands` functions
+     * at once, given their values.
+     *
+     * See `QuadraturePoints::evaluate_spherical_integrals`.
+     */
+    void 
+    evaluate_spherical_integrals(const double *values, 
+                                 std::size_t n_integrands, 
+                                 double *integrals) const;
+
+    /** \brief Calculates the spherical integrals of `n_integrands` functions
+     * at once, given a function object which evaluates all of them.
+     *
+     * See `QuadraturePoints::evaluate_spherical_integrals`.
+     */
+    void 
+    evaluate_spherical_integrals(const multi_function& integrands_at_point,
+                                 std::size_t n_integrands, 
+                                 double *integrals,
+                                 IntegrationWorkspace &workspace) const;
+
+    /** \brief Calculates the spherical integrals of `n_integrands` functions
+     * at once, given any callable which evaluates all of them, called
+     * directly.
+     */
+    template <typename MultiFunction>
+    auto evaluate_spherical_integrals(const MultiFunction& integrands_at_point,
+                                      std::size_t n_integrands, 
+                                      double *integrals,
+                                      IntegrationWorkspace &workspace) const
+        -> decltype(integrands_at_point(0.0, 0.0, 0.0, integrals), void())
+    {
+        weighted_sums_at_points(integrands_at_point, x, y, z, weights, n_points, n_integrands, 
+                                workspace.get_values(integration_block_size * n_integrands),
+                                integrals);
+        for (std::size_t k = 0; k < n_integrands; ++k)
+            integrals[k] *= 4 * M_PI;
+    }
+
+    /** \brief Returns number of quadrature points */
+    std::size_t size() const;
+
+    /** \brief Returns pointer to x-coordinates of quadrature points */
+    const double* get_x() const;
+    /** \brief Returns pointer to y-coordinates of quadrature points */
+    const double* get_y() const;
+    /** \brief Returns pointer to z-coordinates of quadrature points */
+    const double* get_z() const;
+    /** \brief Returns pointer to weights of quadrature points */
+    const double* get_weights() const;
+
+private:
+
+    /** \brief x-coordinates of quadrature points */
+    const double *x;
+    /** \brief y-coordinates of quadrature points */
+    const double *y;
+    /** \brief z-coordinates of quadrature points */
+    const double *z;
+    /** \brief weights of quadrature points */
+    const double *weights;
+    /** \brief number of quadrature points */
+    std::size_t n_points;
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,138 @@
+#include "preprocessor.hpp"
+#include "quadrature_points_view.hpp"
+#include "quadrature_points.hpp"
+
+#include <cmath>
+
+namespace lebedev {
+
+LEBEDEV_EXTERNAL_LINKAGE
+QuadraturePointsView::QuadraturePointsView(const double *x, 
+                                           const double *y, 
+                                           const double *z, 
+                                           const double *weights, 
+                                           std::size_t n_points)
+    : x(x), y(y), z(z), weights(weights), n_points(n_points)
+{}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+QuadraturePointsView::QuadraturePointsView(const QuadraturePoints &quad_points)
+    : QuadraturePointsView(quad_points.get_x().data(),
+                           quad_points.get_y().data(),
+                           quad_points.get_z().data(),
+                           quad_points.get_weights().data(),
+                           quad_points.get_weights().size())
+{}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+double QuadraturePointsView::evaluate_spherical_integral(const scalar_function& integrand_at_point) const
+{
+    return evaluate_spherical_integral<scalar_function>(integrand_at_point);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+std::complex<double> 
+QuadraturePointsView::evaluate_spherical_integral(const complex_function& integrand_at_point) const
+{
+    return evaluate_spherical_integral<complex_function>(integrand_at_point);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+double QuadraturePointsView::evaluate_spherical_integral(const output_function& integrand_at_points,
+                                                         double *values) const
+{
+    return evaluate_spherical_integral<output_function>(integrand_at_points, values);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+double QuadraturePointsView::evaluate_spherical_integral(const output_function& integrand_at_points,
+                                                         IntegrationWorkspace &workspace) const
+{
+    return evaluate_spherical_integral<output_function>(integrand_at_points, workspace);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+double QuadraturePointsView::evaluate_spherical_integral(const output_function& integrand_at_points,
+                                                         IntegrationWorkspace &workspace,
+                                                         Summation summation) const
+{
+    return evaluate_spherical_integral<output_function>(integrand_at_points, workspace, summation);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+void QuadraturePointsView::evaluate_spherical_integrals(const double *values, 
+                                                        std::size_t n_integrands, 
+                                                        double *integrals) const
+{
+    weighted_sums(values, n_integrands, weights, n_points, integrals);
+    for (std::size_t k = 0; k < n_integrands; ++k)
+        integrals[k] *= 4 * M_PI;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+void QuadraturePointsView::evaluate_spherical_integrals(const multi_function& integrands_at_point,
+                                                        std::size_t n_integrands, 
+                                                        double *integrals,
+                                                        IntegrationWorkspace &workspace) const
+{
+    evaluate_spherical_integrals<multi_function>(integrands_at_point, n_integrands, integrals, 
+                                                 workspace);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+std::size_t QuadraturePointsView::size() const
+{
+    return n_points;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+const double* QuadraturePointsView::get_x() const
+{
+    return x;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+const double* QuadraturePointsView::get_y() const
+{
+    return y;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+const double* QuadraturePointsView::get_z() const
+{
+    return z;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE 
+const double* QuadraturePointsView::get_weights() const
+{
+    return weights;
+}
+
+} // namespace lebedev
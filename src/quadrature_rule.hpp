@@ -0,0 +1,159 @@
+#ifndef QUADRATURE_RULE_HPP
+#define QUADRATURE_RULE_HPP
+
+#include "quadrature_order.hpp"
+#include "quadrature_points.hpp"
+#include "quadrature_tables.hpp"
+#include "weighted_sum.hpp"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lebedev {
+
+/**
+ * \brief Lebedev quadrature rule whose order is fixed at compile time.
+ *
+ * The points and weights are the `std::array`s of `QuadratureTable`, so a
+ * `QuadratureRule` holds no data of its own and the integration loops have
+ * trip counts known to the compiler, which can then unroll and vectorize
+ * them.
+ * The interface mirrors `QuadraturePoints`, so that call sites can be
+ * switched over one at a time.
+ *
+ * Like `quadrature_tables.hpp`, this header is not included by
+ * `lebedev_quadrature.hpp`.
+ */
+template <QuadratureOrder quad_order>
+class QuadratureRule
+{
+    /** \brief Compile-time tables holding the points and weights */
+    using table = QuadratureTable<quad_order>;
+
+public:
+    /** \brief vector of doubles */
+    using vec = std::vector<double>;
+    /** \brief scalar_function */
+    using scalar_function = QuadraturePoints::scalar_function;
+    /** \brief vector_function */
+    using vector_function = QuadraturePoints::vector_function;
+    /** \brief array of coordinates or weights of all quadrature points */
+    using array = std::array<double, table::n_points>;
+
+    /** \brief Number of quadrature points */
+    static constexpr std::size_t size()
+    {
+        return table::n_points;
+    }
+
+    /** \brief Order of the quadrature rule */
+    static constexpr QuadratureOrder order()
+    {
+        return quad_order;
+    }
+
+    /** \brief Calculates spherical integral given a function object.
+     *
+     * `integrand_at_point` may be any callable (including a
+     * `scalar_function`) which takes three doubles `x`, `y`, `z`
+     * corresponding to the coordinates of the evaluation point, and returns
+     * the integrand evaluated at that point.
+     */
+    template <typename ScalarFunction>
+    auto evaluate_spherical_integral(const ScalarFunction &integrand_at_point) const
+        -> decltype(static_cast<double>(integrand_at_point(0.0, 0.0, 0.0)))
+    {
+        double sum = 0;
+        for (std::size_t i = 0; i < size(); ++i)
+            sum += integrand_at_point(table::x[i], table::y[i], table::z[i]) * table::weights[i];
+
+        return 4 * M_PI * sum;
+    }
+
+    /** \brief Calculates spherical integral of each component of an
+     * array-valued integrand, in one pass.
+     *
+     * `integrand_at_point` may be any callable which takes three doubles
+     * `x`, `y`, `z` and returns a `std::array<double, K>` (e.g. the
+     * independent components of a tensor), which is called once per point,
+     * so any work shared between components is only done once.
+     * Returns the integrals of the components.
+     */
+    template <typename ArrayFunction>
+    auto evaluate_spherical_integral(const ArrayFunction &integrand_at_point) const
+        -> typename array_integrand_result<
+               typename std::decay<decltype(integrand_at_point(0.0, 0.0, 0.0))>::type>::type
+    {
+        typename std::decay<decltype(integrand_at_point(0.0, 0.0, 0.0))>::type sum = {};
+        for (std::size_t i = 0; i < size(); ++i)
+            accumulate_weighted(sum, table::weights[i], 
+                                integrand_at_point(table::x[i], table::y[i], table::z[i]));
+
+        for (double &component : sum)
+            component *= 4 * M_PI;
+
+        return sum;
+    }
+
+    /** \brief Calculates spherical integral given a function object.
+     *
+     * `integrand_at_points` may be any callable (including a
+     * `vector_function`) which takes three references to vectors `x`, `y`,
+     * `z` which contain the coordinates of all of the points at which the
+     * integrand will be evaluated.
+     * It should return a vector of doubles corresponding to the integrand
+     * evaluated at all of the quadrature points.
+     *
+     * The coordinate vectors are those of `QuadraturePoints::shared`, so
+     * they are only created once per process, and the weighted sum uses the
+     * SIMD kernels of `weighted_sum`.
+     */
+    template <typename VectorFunction>
+    auto evaluate_spherical_integral(const VectorFunction &integrand_at_points) const
+        -> decltype(static_cast<double>(integrand_at_points(std::declval<const vec&>(),
+                                                            std::declval<const vec&>(),
+                                                            std::declval<const vec&>())[0]))
+    {
+        const auto quad_points = QuadraturePoints::shared(quad_order);
+        const auto integrand_vals = integrand_at_points(quad_points->get_x(),
+                                                        quad_points->get_y(),
+                                                        quad_points->get_z());
+        assert(integrand_vals.size() == size()
+               && "vector function must return one value per quadrature point");
+
+        return 4 * M_PI * weighted_sum(integrand_vals.data(), &table::weights[0], size());
+    }
+
+    /** \brief Returns const reference to array of x-coordinates of quadrature points */
+    constexpr const array& get_x() const
+    {
+        return table::x;
+    }
+
+    /** \brief Returns const reference to array of y-coordinates of quadrature points */
+    constexpr const array& get_y() const
+    {
+        return table::y;
+    }
+
+    /** \brief Returns const reference to array of z-coordinates of quadrature points */
+    constexpr const array& get_z() const
+    {
+        return table::z;
+    }
+
+    /** \brief Returns const reference to array of weights of quadrature points */
+    constexpr const array& get_weights() const
+    {
+        return table::weights;
+    }
+};
+
+} // namespace lebedev
+
+#endif
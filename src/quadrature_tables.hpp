@@ -0,0 +1,140 @@
+#ifndef QUADRATURE_TABLES_HPP
+#define QUADRATURE_TABLES_HPP
+
+#include "quadrature_order.hpp"
+#include "generator_point.hpp"
+#include "generator_tables.hpp"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace lebedev {
+
+/**
+ * \brief Coordinates and weights of `n_points` quadrature points, laid out
+ * as plain arrays so that they may be filled in by a constexpr function.
+ */
+template <std::size_t n_points>
+struct ExpandedPoints
+{
+    double x[n_points];
+    double y[n_points];
+    double z[n_points];
+    double weights[n_points];
+};
+
+
+
+/**
+ * \brief Applies each generator point's generating rule at compile time,
+ * giving points in the same order as `QuadraturePoints`.
+ */
+template <std::size_t n_points, std::size_t n_generators>
+constexpr ExpandedPoints<n_points>
+expand_generator_points(const std::array<GeneratorPoint, n_generators> &generator_points)
+{
+    ExpandedPoints<n_points> points{};
+
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < n_generators; ++i)
+    {
+        const GeneratorPoint &generator_point = generator_points[i];
+        for (unsigned int j = 0; j < generator_point.n_points(); ++j)
+        {
+            points.x[offset] = generator_point.get_x(j);
+            points.y[offset] = generator_point.get_y(j);
+            points.z[offset] = generator_point.get_z(j);
+            points.weights[offset] = generator_point.get_weight();
+            ++offset;
+        }
+    }
+
+    return points;
+}
+
+
+
+/** \brief Copies a plain array into a `std::array` in a constant expression */
+template <std::size_t n, std::size_t... indices>
+constexpr std::array<double, n>
+make_array(const double (&values)[n], std::index_sequence<indices...>)
+{
+    return {{ values[indices]... }};
+}
+
+
+
+/**
+ * \brief Quadrature points and weights of a Lebedev rule, fully expanded at
+ * compile time.
+ *
+ * The tables are built from the same generator points as
+ * `QuadraturePoints`, and the points are in the same order, so
+ * `QuadratureTable<order>::x[i] == QuadraturePoints(order).get_x()[i]`.
+ * Getting a rule this way costs nothing at runtime and never allocates.
+ *
+ * This header pulls in every tabulated rule, so it is not included by
+ * `lebedev_quadrature.hpp` -- include it directly where it is needed.
+ */
+template <QuadratureOrder quad_order>
+struct QuadratureTable
+{
+    /** \brief Number of quadrature points */
+    static constexpr std::size_t n_points = static_cast<std::size_t>(quad_order);
+
+    /** \brief Number of generator points */
+    static constexpr std::size_t n_generators
+        = GeneratorPointStorage<quad_order>::n_generators;
+
+    /** \brief Generator points which the table is expanded from */
+    static constexpr const std::array<GeneratorPoint, n_generators> &generator_points
+        = GeneratorPointStorage<quad_order>::generator_points;
+
+    /** \brief x-coordinates of quadrature points */
+    static constexpr std::array<double, n_points> x
+        = make_array(expand_generator_points<n_points>(generator_points).x,
+                     std::make_index_sequence<n_points>{});
+    /** \brief y-coordinates of quadrature points */
+    static constexpr std::array<double, n_points> y
+        = make_array(expand_generator_points<n_points>(generator_points).y,
+                     std::make_index_sequence<n_points>{});
+    /** \brief z-coordinates of quadrature points */
+    static constexpr std::array<double, n_points> z
+        = make_array(expand_generator_points<n_points>(generator_points).z,
+                     std::make_index_sequence<n_points>{});
+    /** \brief weights of quadrature points */
+    static constexpr std::array<double, n_points> weights
+        = make_array(expand_generator_points<n_points>(generator_points).weights,
+                     std::make_index_sequence<n_points>{});
+};
+
+template <QuadratureOrder quad_order>
+constexpr std::size_t QuadratureTable<quad_order>::n_points;
+
+template <QuadratureOrder quad_order>
+constexpr std::size_t QuadratureTable<quad_order>::n_generators;
+
+template <QuadratureOrder quad_order>
+constexpr const std::array<GeneratorPoint, QuadratureTable<quad_order>::n_generators> &
+QuadratureTable<quad_order>::generator_points;
+
+template <QuadratureOrder quad_order>
+constexpr std::array<double, QuadratureTable<quad_order>::n_points>
+QuadratureTable<quad_order>::x;
+
+template <QuadratureOrder quad_order>
+constexpr std::array<double, QuadratureTable<quad_order>::n_points>
+QuadratureTable<quad_order>::y;
+
+template <QuadratureOrder quad_order>
+constexpr std::array<double, QuadratureTable<quad_order>::n_points>
+QuadratureTable<quad_order>::z;
+
+template <QuadratureOrder quad_order>
+constexpr std::array<double, QuadratureTable<quad_order>::n_points>
+QuadratureTable<quad_order>::weights;
+
+} // namespace lebedev
+
+#endif
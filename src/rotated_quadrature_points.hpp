@@ -0,0 +1,279 @@
+#ifndef ROTATED_QUADRATURE_POINTS_HPP
+#define ROTATED_QUADRATURE_POINTS_HPP
+
+#include "preprocessor.hpp"
+#include "quadrature_points.hpp"
+#include "quadrature_points_view.hpp"
+#include "integration_workspace.hpp"
+#include "weighted_sum.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+namespace lebedev {
+
+/** \brief 3 by 3 matrix, row-major, which takes a point `p` to `R p` */
+using RotationMatrix = std::array<double, 9>;
+
+/**
+ * \brief Writes the images of `n` points under `rotation` to `rotated_x`,
+ * `rotated_y`, and `rotated_z`.
+ */
+void rotate_points(const RotationMatrix &rotation,
+                   const double *x,
+                   const double *y,
+                   const double *z,
+                   std::size_t n,
+                   double *rotated_x,
+                   double *rotated_y,
+                   double *rotated_z);
+
+/** \brief Number of rotations which `evaluate_rotated_spherical_integrals`
+ * applies to each point together, each with its own sum */
+constexpr std::size_t rotation_block_size = 4;
+
+/**
+ * \brief Adds the weighted sums of `integrand_at_point` at the images of
+ * the points from `start` to `end` under `n_block_rotations` rotations
+ * (from `rotations`) to `integrals`.
+ *
+ * Each point is loaded once for all of the rotations, and the sums of the
+ * rotations are independent, so their additions overlap rather than
+ * waiting for each other.
+ */
+template <std::size_t n_block_rotations, typename ScalarFunction>
+void add_rotated_sums(const double *x,
+                      const double *y,
+                      const double *z,
+                      const double *weights,
+                      std::size_t start,
+                      std::size_t end,
+                      const RotationMatrix *rotations,
+                      const ScalarFunction &integrand_at_point,
+                      double *integrals)
+{
+    double sums[n_block_rotations] = {};
+    for (std::size_t i = start; i < end; ++i)
+    {
+        const double x_i = x[i];
+        const double y_i = y[i];
+        const double z_i = z[i];
+        for (std::size_t r = 0; r < n_block_rotations; ++r)
+        {
+            const RotationMatrix &R = rotations[r];
+            sums[r] += integrand_at_point(R[0] * x_i + R[1] * y_i + R[2] * z_i,
+                                          R[3] * x_i + R[4] * y_i + R[5] * z_i,
+                                          R[6] * x_i + R[7] * y_i + R[8] * z_i)
+                       * weights[i];
+        }
+    }
+
+    for (std::size_t r = 0; r < n_block_rotations; ++r)
+        integrals[r] += sums[r];
+}
+
+/**
+ * \brief Writes \f$ \int f(R_r x) \, d\Omega \f$ to `integrals[r]` for
+ * each of the `n_rotations` matrices \f$ R_r \f$ of `rotations`, with
+ * the integrand called directly at the rotated points.
+ *
+ * The points of `points` are taken `integration_block_size` at a time (8 kB
+ * of coordinates and weights, which stay in L1), and every rotation is
+ * applied to a block before moving on to the next, so the points are read
+ * from memory once for all of the rotations rather than once per rotation.
+ * Within a block, `rotation_block_size` rotations are applied to each
+ * point together.
+ */
+template <typename ScalarFunction>
+auto evaluate_rotated_spherical_integrals(const QuadraturePointsView &points,
+                                          const RotationMatrix *rotations,
+                                          std::size_t n_rotations,
+                                          const ScalarFunction &integrand_at_point,
+                                          double *integrals)
+    -> decltype(static_cast<double>(integrand_at_point(0.0, 0.0, 0.0)), void())
+{
+    const double *x = points.get_x();
+    const double *y = points.get_y();
+    const double *z = points.get_z();
+    const double *weights = points.get_weights();
+    const std::size_t n_points = points.size();
+    const std::size_t n_blocked_rotations = n_rotations - n_rotations % rotation_block_size;
+    std::fill(integrals, integrals + n_rotations, 0.0);
+
+    for (std::size_t start = 0; start < n_points; start += integration_block_size)
+    {
+        const std::size_t end = std::min(start + integration_block_size, n_points);
+        for (std::size_t r = 0; r < n_blocked_rotations; r += rotation_block_size)
+            add_rotated_sums<rotation_block_size>(x, y, z, weights, start, end, rotations + r,
+                                                  integrand_at_point, integrals + r);
+        for (std::size_t r = n_blocked_rotations; r < n_rotations; ++r)
+            add_rotated_sums<1>(x, y, z, weights, start, end, rotations + r,
+                                integrand_at_point, integrals + r);
+    }
+
+    for (std::size_t r = 0; r < n_rotations; ++r)
+        integrals[r] *= 4 * M_PI;
+}
+
+/**
+ * \brief Writes \f$ \int f(R_r x) \, d\Omega \f$ to `integrals[r]` for
+ * each of the `n_rotations` matrices of `rotations`, given any callable
+ * which writes its values at a block of points.
+ *
+ * `integrand_at_points` is called as in
+ * `QuadraturePoints::evaluate_spherical_integral`, but with one block of
+ * at most `integration_block_size` rotated points at a time, which are
+ * rotated into `workspace` just before (so the workspace only needs room
+ * for `4 * integration_block_size` doubles, whatever the rule).
+ * The blocks are taken in the same order as by the overload for callables
+ * of one point, and the values of each block are summed by `weighted_sum`.
+ */
+template <typename OutputFunction>
+auto evaluate_rotated_spherical_integrals(const QuadraturePointsView &points,
+                                          const RotationMatrix *rotations,
+                                          std::size_t n_rotations,
+                                          const OutputFunction &integrand_at_points,
+                                          double *integrals,
+                                          IntegrationWorkspace &workspace)
+    -> decltype(integrand_at_points(std::declval<const double*>(), std::declval<const double*>(),
+                                    std::declval<const double*>(), std::size_t(),
+                                    workspace.get_values(0)),
+                void())
+{
+    const std::size_t n_points = points.size();
+    double *rotated_x = workspace.get_values(4 * integration_block_size);
+    double *rotated_y = rotated_x + integration_block_size;
+    double *rotated_z = rotated_y + integration_block_size;
+    double *values = rotated_z + integration_block_size;
+    std::fill(integrals, integrals + n_rotations, 0.0);
+
+    for (std::size_t start = 0; start < n_points; start += integration_block_size)
+    {
+        const std::size_t block_size = std::min(integration_block_size, n_points - start);
+        for (std::size_t r = 0; r < n_rotations; ++r)
+        {
+            rotate_points(rotations[r], points.get_x() + start, points.get_y() + start,
+                          points.get_z() + start, block_size, rotated_x, rotated_y, rotated_z);
+            integrand_at_points(rotated_x, rotated_y, rotated_z, block_size, values);
+            integrals[r] += weighted_sum(values, points.get_weights() + start, block_size);
+        }
+    }
+
+    for (std::size_t r = 0; r < n_rotations; ++r)
+        integrals[r] *= 4 * M_PI;
+}
+
+/** \brief `evaluate_rotated_spherical_integrals` for a `scalar_function` */
+void evaluate_rotated_spherical_integrals(const QuadraturePointsView &points,
+                                          const RotationMatrix *rotations,
+                                          std::size_t n_rotations,
+                                          const QuadraturePoints::scalar_function &integrand_at_point,
+                                          double *integrals);
+
+/** \brief `evaluate_rotated_spherical_integrals` for an `output_function` */
+void evaluate_rotated_spherical_integrals(const QuadraturePointsView &points,
+                                          const RotationMatrix *rotations,
+                                          std::size_t n_rotations,
+                                          const QuadraturePoints::output_function &integrand_at_points,
+                                          double *integrals,
+                                          IntegrationWorkspace &workspace);
+
+/**
+ * \brief Non-owning view of a rule whose points are rotated by a 3 by 3
+ * matrix, for integrals \f$ \int f(R x) \, d\Omega \f$.
+ *
+ * The rotation is applied to each point as it is passed to the integrand,
+ * so no rotated copy of the points is made.
+ * To integrate over many rotations, `evaluate_rotated_spherical_integrals`
+ * reads the points once for all of them.
+ * The view is only valid as long as the storage of the points it refers
+ * to.
+ */
+class RotatedQuadraturePointsView
+{
+public:
+    /** \brief scalar_function */
+    using scalar_function = QuadraturePoints::scalar_function;
+    /** \brief output_function */
+    using output_function = QuadraturePoints::output_function;
+
+    /** \brief Views `points` rotated by `rotation` */
+    RotatedQuadraturePointsView(const QuadraturePointsView &points,
+                                const RotationMatrix &rotation);
+
+    /** \brief Calculates spherical integral of `integrand_at_point` at the
+     * rotated points, given a function object */
+    double
+    evaluate_spherical_integral(const scalar_function& integrand_at_point) const;
+
+    /** \brief Calculates spherical integral of any callable at the rotated
+     * points, called directly so that it can be inlined with the rotation */
+    template <typename ScalarFunction>
+    auto evaluate_spherical_integral(const ScalarFunction &integrand_at_point) const
+        -> decltype(static_cast<double>(integrand_at_point(0.0, 0.0, 0.0)))
+    {
+        double integral = 0;
+        add_rotated_sums<1>(points.get_x(), points.get_y(), points.get_z(), points.get_weights(),
+                            0, points.size(), &rotation, integrand_at_point, &integral);
+
+        return 4 * M_PI * integral;
+    }
+
+    /** \brief Calculates spherical integral given a function object which
+     * writes its values at blocks of rotated points, which are rotated into
+     * `workspace` (see `evaluate_rotated_spherical_integrals`) */
+    double
+    evaluate_spherical_integral(const output_function& integrand_at_points,
+                                IntegrationWorkspace &workspace) const;
+
+    /** \brief Calculates spherical integral given any callable which writes
+     * its values at blocks of rotated points, called directly */
+    template <typename OutputFunction>
+    auto evaluate_spherical_integral(const OutputFunction &integrand_at_points,
+                                     IntegrationWorkspace &workspace) const
+        -> decltype(integrand_at_points(std::declval<const double*>(), std::declval<const double*>(),
+                                        std::declval<const double*>(), std::size_t(),
+                                        workspace.get_values(0)),
+                    double())
+    {
+        const std::size_t n_points = points.size();
+        double *rotated_x = workspace.get_values(4 * integration_block_size);
+        double *rotated_y = rotated_x + integration_block_size;
+        double *rotated_z = rotated_y + integration_block_size;
+        double *values = rotated_z + integration_block_size;
+
+        double integral = 0;
+        for (std::size_t start = 0; start < n_points; start += integration_block_size)
+        {
+            const std::size_t block_size = std::min(integration_block_size, n_points - start);
+            rotate_points(rotation, points.get_x() + start, points.get_y() + start,
+                          points.get_z() + start, block_size, rotated_x, rotated_y, rotated_z);
+            integrand_at_points(rotated_x, rotated_y, rotated_z, block_size, values);
+            integral += weighted_sum(values, points.get_weights() + start, block_size);
+        }
+
+        return 4 * M_PI * integral;
+    }
+
+    /** \brief Returns number of quadrature points */
+    std::size_t size() const;
+
+    /** \brief Returns the unrotated points */
+    const QuadraturePointsView& get_points() const;
+
+    /** \brief Returns the rotation applied to the points */
+    const RotationMatrix& get_rotation() const;
+
+private:
+    /** \brief Unrotated points and weights */
+    QuadraturePointsView points;
+    /** \brief Matrix applied to each point */
+    RotationMatrix rotation;
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,109 @@
+#include "preprocessor.hpp"
+#include "rotated_quadrature_points.hpp"
+
+namespace lebedev {
+
+LEBEDEV_EXTERNAL_LINKAGE
+void rotate_points(const RotationMatrix &rotation,
+                   const double *x,
+                   const double *y,
+                   const double *z,
+                   std::size_t n,
+                   double *rotated_x,
+                   double *rotated_y,
+                   double *rotated_z)
+{
+    const RotationMatrix &R = rotation;
+
+    // no dependence between iterations, so this vectorizes
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        rotated_x[i] = R[0] * x[i] + R[1] * y[i] + R[2] * z[i];
+        rotated_y[i] = R[3] * x[i] + R[4] * y[i] + R[5] * z[i];
+        rotated_z[i] = R[6] * x[i] + R[7] * y[i] + R[8] * z[i];
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void evaluate_rotated_spherical_integrals(const QuadraturePointsView &points,
+                                          const RotationMatrix *rotations,
+                                          std::size_t n_rotations,
+                                          const QuadraturePoints::scalar_function &integrand_at_point,
+                                          double *integrals)
+{
+    evaluate_rotated_spherical_integrals<QuadraturePoints::scalar_function>(points, rotations,
+                                                                            n_rotations,
+                                                                            integrand_at_point,
+                                                                            integrals);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void evaluate_rotated_spherical_integrals(const QuadraturePointsView &points,
+                                          const RotationMatrix *rotations,
+                                          std::size_t n_rotations,
+                                          const QuadraturePoints::output_function &integrand_at_points,
+                                          double *integrals,
+                                          IntegrationWorkspace &workspace)
+{
+    evaluate_rotated_spherical_integrals<QuadraturePoints::output_function>(points, rotations,
+                                                                            n_rotations,
+                                                                            integrand_at_points,
+                                                                            integrals, workspace);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+RotatedQuadraturePointsView::RotatedQuadraturePointsView(const QuadraturePointsView &points,
+                                                         const RotationMatrix &rotation)
+    : points(points), rotation(rotation)
+{}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+double RotatedQuadraturePointsView::
+evaluate_spherical_integral(const scalar_function& integrand_at_point) const
+{
+    return evaluate_spherical_integral<scalar_function>(integrand_at_point);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+double RotatedQuadraturePointsView::
+evaluate_spherical_integral(const output_function& integrand_at_points,
+                            IntegrationWorkspace &workspace) const
+{
+    return evaluate_spherical_integral<output_function>(integrand_at_points, workspace);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t RotatedQuadraturePointsView::size() const
+{
+    return points.size();
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+const QuadraturePointsView& RotatedQuadraturePointsView::get_points() const
+{
+    return points;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+const RotationMatrix& RotatedQuadraturePointsView::get_rotation() const
+{
+    return rotation;
+}
+
+} // namespace lebedev
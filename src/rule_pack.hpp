@@ -0,0 +1,104 @@
+#ifndef RULE_PACK_HPP
+#define RULE_PACK_HPP
+
+#include "preprocessor.hpp"
+#include "quadrature_order.hpp"
+#include "quadrature_points_view.hpp"
+#include "generator_point.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace lebedev {
+
+/** \brief Quadrature rule to be written to a rule pack */
+struct RulePackEntry
+{
+    /** \brief Highest degree of polynomial that can be integrated exactly, or 0 if unknown */
+    unsigned int precision;
+    /** \brief Generator points of the rule */
+    std::vector<GeneratorPoint> generator_points;
+};
+
+/** \brief Writes every available rule of this library to a rule pack file */
+void write_rule_pack(const std::string &filename);
+
+/**
+ * \brief Writes the given rules to a rule pack file, so that rules may be
+ * added without recompiling the library.
+ *
+ * The pack is written to a temporary file in the same directory, which is
+ * then renamed over `filename`, so that a `RulePack` opened meanwhile sees
+ * either the old file or the complete new one.
+ */
+void write_rule_pack(const std::string &filename, 
+                     const std::vector<RulePackEntry> &rules);
+
+/**
+ * \brief Read-only, memory-mapped file holding expanded quadrature rules.
+ *
+ * A rule pack is a versioned binary file which holds, for each rule, its
+ * points and weights (each array aligned to 64 bytes) and its orbit
+ * structure (generator points and orbit counts).
+ * Opening one maps the file into memory without copying or parsing the
+ * points, so processes which open the same file share one copy of it in the
+ * page cache.
+ * Rules are returned as `QuadraturePointsView`s into the mapping, which are
+ * only valid while the `RulePack` is alive.
+ * See `src/README.md` for the file layout.
+ */
+class RulePack
+{
+public:
+    /** \brief Maps rule pack file `filename`, and checks that it is valid */
+    explicit RulePack(const std::string &filename);
+
+    /** \brief Unmaps rule pack file */
+    ~RulePack();
+
+    RulePack(const RulePack&) = delete;
+    RulePack& operator=(const RulePack&) = delete;
+
+    /** \brief Takes over the mapping of `other`, leaving it empty */
+    RulePack(RulePack &&other) noexcept;
+    /** \brief Takes over the mapping of `other`, leaving it empty */
+    RulePack& operator=(RulePack &&other) noexcept;
+
+    /** \brief Returns number of rules in the pack */
+    std::size_t size() const;
+
+    /** \brief Returns view of points and weights of the `i`th rule */
+    QuadraturePointsView get_rule(std::size_t i) const;
+
+    /** \brief Returns view of points and weights of the first rule with order `quad_order` */
+    QuadraturePointsView get_rule(QuadratureOrder quad_order) const;
+
+    /** \brief Returns whether the pack holds a rule with order `quad_order` */
+    bool contains(QuadratureOrder quad_order) const;
+
+    /** \brief Returns the highest degree of polynomial the `i`th rule integrates exactly */
+    unsigned int get_precision(std::size_t i) const;
+
+    /** \brief Returns number of generator points with each generating rule of the `i`th rule */
+    std::array<unsigned int, n_generating_rules> get_n_orbits(std::size_t i) const;
+
+    /** \brief Returns generator points of the `i`th rule */
+    std::vector<GeneratorPoint> get_generator_points(std::size_t i) const;
+
+private:
+    /** \brief Releases the mapping, if any */
+    void close();
+
+    /** \brief Start of file contents */
+    const unsigned char *data = nullptr;
+    /** \brief Size of file in bytes */
+    std::size_t n_bytes = 0;
+    /** \brief Whether `data` is a memory mapping (or else a heap copy) */
+    bool is_mapped = false;
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,542 @@
+#include "preprocessor.hpp"
+
+#include "rule_pack.hpp"
+#include "quadrature_order.hpp"
+#include "quadrature_points_view.hpp"
+#include "generator_point.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LEBEDEV_RULE_PACK_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define LEBEDEV_RULE_PACK_MMAP 0
+#endif
+
+namespace lebedev {
+
+/** \brief First bytes of every rule pack file */
+constexpr char rule_pack_magic[8] = {'L', 'E', 'B', 'R', 'P', 'A', 'C', 'K'};
+
+/** \brief Version of the rule pack layout written by `write_rule_pack` */
+constexpr std::uint32_t rule_pack_version = 1;
+
+/** \brief Written in native byte order, so that foreign-endian files are rejected */
+constexpr std::uint32_t rule_pack_byte_order = 0x01020304;
+
+/** \brief Alignment of every array in a rule pack, in bytes */
+constexpr std::uint64_t rule_pack_alignment = 64;
+
+/** \brief Header at the start of a rule pack file */
+struct RulePackHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint64_t n_rules;
+    std::uint64_t file_size;
+    std::uint8_t reserved[32];
+};
+
+/** \brief Describes where one rule lies in a rule pack file */
+struct RulePackRule
+{
+    std::uint32_t n_points;
+    std::uint32_t precision;
+    std::uint32_t n_generators;
+    std::uint32_t n_orbits[n_generating_rules];
+    std::uint32_t reserved;
+    /** \brief x, y, z and weights arrays start at this offset, `points_stride` bytes apart */
+    std::uint64_t points_offset;
+    std::uint64_t points_stride;
+    std::uint64_t generators_offset;
+};
+
+/** \brief Generator point as stored in a rule pack file */
+struct RulePackGenerator
+{
+    double a;
+    double b;
+    double c;
+    double weight;
+    std::uint32_t generating_rule;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(RulePackHeader) == 64, "rule pack header is 64 bytes");
+static_assert(sizeof(RulePackRule) == 64, "rule pack rule entries are 64 bytes");
+static_assert(sizeof(RulePackGenerator) == 40, "rule pack generators are 40 bytes");
+
+
+
+/** \brief Rounds `n_bytes` up to a multiple of `rule_pack_alignment` */
+LEBEDEV_INTERNAL_LINKAGE
+std::uint64_t rule_pack_align(std::uint64_t n_bytes)
+{
+    return (n_bytes + rule_pack_alignment - 1) / rule_pack_alignment * rule_pack_alignment;
+}
+
+
+
+/**
+ * \brief Name of a file in the same directory as `filename`, unique to this
+ * process and thread, which `write_rule_pack` writes before renaming it
+ */
+LEBEDEV_INTERNAL_LINKAGE
+std::string temporary_rule_pack_filename(const std::string &filename)
+{
+    std::ostringstream temporary_filename;
+    temporary_filename << filename << ".tmp";
+#if LEBEDEV_RULE_PACK_MMAP
+    temporary_filename << '.' << getpid();
+#endif
+    temporary_filename << '.' << std::this_thread::get_id();
+
+    return temporary_filename.str();
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void write_rule_pack(const std::string &filename)
+{
+    std::vector<RulePackEntry> rules;
+    for (unsigned int rule_number = 0; rule_number < number_of_rules; ++rule_number)
+    {
+        const RuleDescriptor &descriptor = get_rule_descriptor(rule_number);
+        if (!descriptor.available)
+            continue;
+
+        const GeneratorPoint *generator_points = descriptor.get_generator_points();
+        rules.push_back({descriptor.precision,
+                         std::vector<GeneratorPoint>(generator_points,
+                                                     generator_points + descriptor.n_generators)});
+    }
+
+    write_rule_pack(filename, rules);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void write_rule_pack(const std::string &filename, 
+                     const std::vector<RulePackEntry> &rules)
+{
+    std::vector<RulePackRule> rule_entries(rules.size());
+
+    std::uint64_t offset = rule_pack_align(sizeof(RulePackHeader) 
+                                           + rules.size() * sizeof(RulePackRule));
+    for (std::size_t i = 0; i < rules.size(); ++i)
+    {
+        RulePackRule &entry = rule_entries[i];
+        std::memset(&entry, 0, sizeof(entry));
+
+        std::uint64_t n_points = 0;
+        for (const GeneratorPoint &generator_point : rules[i].generator_points)
+        {
+            const auto generating_rule 
+                = static_cast<unsigned int>(generator_point.get_generating_rule());
+            if (generating_rule >= n_generating_rules)
+                throw std::invalid_argument("Not a valid octahedral generating rule");
+
+            ++entry.n_orbits[generating_rule];
+            n_points += generator_point.n_points();
+        }
+
+        entry.n_points = static_cast<std::uint32_t>(n_points);
+        entry.precision = rules[i].precision;
+        entry.n_generators = static_cast<std::uint32_t>(rules[i].generator_points.size());
+        entry.points_stride = rule_pack_align(n_points * sizeof(double));
+        entry.points_offset = offset;
+        offset += 4 * entry.points_stride;
+        entry.generators_offset = offset;
+        offset = rule_pack_align(offset + entry.n_generators * sizeof(RulePackGenerator));
+    }
+
+    std::vector<unsigned char> contents(offset, 0);
+
+    RulePackHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, rule_pack_magic, sizeof(header.magic));
+    header.version = rule_pack_version;
+    header.byte_order = rule_pack_byte_order;
+    header.n_rules = rules.size();
+    header.file_size = contents.size();
+    std::memcpy(&contents[0], &header, sizeof(header));
+
+    for (std::size_t i = 0; i < rules.size(); ++i)
+    {
+        const RulePackRule &entry = rule_entries[i];
+        std::memcpy(&contents[sizeof(RulePackHeader) + i * sizeof(RulePackRule)],
+                    &entry, sizeof(entry));
+
+        auto *x = reinterpret_cast<double*>(&contents[entry.points_offset]);
+        auto *y = reinterpret_cast<double*>(&contents[entry.points_offset 
+                                                      + entry.points_stride]);
+        auto *z = reinterpret_cast<double*>(&contents[entry.points_offset 
+                                                      + 2 * entry.points_stride]);
+        auto *w = reinterpret_cast<double*>(&contents[entry.points_offset 
+                                                      + 3 * entry.points_stride]);
+
+        std::size_t point_offset = 0;
+        std::uint64_t generator_offset = entry.generators_offset;
+        for (const GeneratorPoint &generator_point : rules[i].generator_points)
+        {
+            generator_point.generate_quadrature_points(x + point_offset, 
+                                                       y + point_offset,
+                                                       z + point_offset,
+                                                       w + point_offset);
+            point_offset += generator_point.n_points();
+
+            RulePackGenerator generator;
+            std::memset(&generator, 0, sizeof(generator));
+            generator.a = generator_point.get_a();
+            generator.b = generator_point.get_b();
+            generator.c = generator_point.get_c();
+            generator.weight = generator_point.get_weight();
+            generator.generating_rule 
+                = static_cast<std::uint32_t>(generator_point.get_generating_rule());
+            std::memcpy(&contents[generator_offset], &generator, sizeof(generator));
+            generator_offset += sizeof(generator);
+        }
+    }
+
+    // written next to `filename` and renamed over it, so that a pack opened
+    // while it is being written is either the old or the new one, never a
+    // partly written file
+    const std::string temporary_filename = temporary_rule_pack_filename(filename);
+    {
+        std::ofstream file(temporary_filename, std::ios::binary | std::ios::trunc);
+        if (!file)
+            throw std::runtime_error("Could not open rule pack file " + temporary_filename 
+                                     + " for writing");
+
+        file.write(reinterpret_cast<const char*>(contents.data()), 
+                   static_cast<std::streamsize>(contents.size()));
+        file.close();
+        if (!file)
+        {
+            std::remove(temporary_filename.c_str());
+            throw std::runtime_error("Could not write rule pack file " + temporary_filename);
+        }
+    }
+
+    if (std::rename(temporary_filename.c_str(), filename.c_str()) != 0)
+    {
+        std::remove(temporary_filename.c_str());
+        throw std::runtime_error("Could not replace rule pack file " + filename);
+    }
+}
+
+
+
+/** \brief Reads the `i`th rule entry of a rule pack */
+LEBEDEV_INTERNAL_LINKAGE
+RulePackRule read_rule_pack_rule(const unsigned char *data, std::size_t i)
+{
+    RulePackRule entry;
+    std::memcpy(&entry, data + sizeof(RulePackHeader) + i * sizeof(RulePackRule), sizeof(entry));
+
+    return entry;
+}
+
+
+
+/** \brief Throws unless `data` holds a well-formed rule pack of `n_bytes` bytes */
+LEBEDEV_INTERNAL_LINKAGE
+void validate_rule_pack(const unsigned char *data, 
+                        std::size_t n_bytes, 
+                        const std::string &filename)
+{
+    const std::string error_start = "Invalid rule pack file " + filename + ": ";
+
+    RulePackHeader header;
+    if (n_bytes < sizeof(header))
+        throw std::invalid_argument(error_start + "file is too small");
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, rule_pack_magic, sizeof(header.magic)) != 0)
+        throw std::invalid_argument(error_start + "not a rule pack");
+    if (header.byte_order != rule_pack_byte_order)
+        throw std::invalid_argument(error_start + "written with a different byte order");
+    if (header.version != rule_pack_version)
+        throw std::invalid_argument(error_start + "unsupported version " 
+                                    + std::to_string(header.version));
+    if (header.file_size != n_bytes)
+        throw std::invalid_argument(error_start + "file is truncated");
+    if (header.n_rules > (n_bytes - sizeof(header)) / sizeof(RulePackRule))
+        throw std::invalid_argument(error_start + "rule table exceeds file");
+
+    for (std::size_t i = 0; i < header.n_rules; ++i)
+    {
+        const RulePackRule entry = read_rule_pack_rule(data, i);
+
+        std::uint64_t n_points = 0;
+        std::uint64_t n_generators = 0;
+        for (unsigned int rule = 0; rule < n_generating_rules; ++rule)
+        {
+            n_points += std::uint64_t(entry.n_orbits[rule]) 
+                        * orbit_size(static_cast<OhPointGen>(rule));
+            n_generators += entry.n_orbits[rule];
+        }
+
+        if (n_points != entry.n_points || n_generators != entry.n_generators)
+            throw std::invalid_argument(error_start + "orbit counts of rule " 
+                                        + std::to_string(i) + " are inconsistent");
+        if (entry.points_offset % rule_pack_alignment != 0
+            || entry.points_stride % rule_pack_alignment != 0
+            || entry.generators_offset % alignof(RulePackGenerator) != 0
+            || entry.points_stride < entry.n_points * sizeof(double)
+            || entry.points_offset > n_bytes
+            || entry.points_stride > (n_bytes - entry.points_offset) / 4
+            || entry.generators_offset > n_bytes
+            || entry.n_generators > (n_bytes - entry.generators_offset) 
+                                    / sizeof(RulePackGenerator))
+            throw std::invalid_argument(error_start + "rule " + std::to_string(i) 
+                                        + " exceeds file");
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+RulePack::RulePack(const std::string &filename)
+{
+#if LEBEDEV_RULE_PACK_MMAP
+    const int file_descriptor = ::open(filename.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+        throw std::runtime_error("Could not open rule pack file " + filename);
+
+    struct stat file_status;
+    if (::fstat(file_descriptor, &file_status) != 0)
+    {
+        ::close(file_descriptor);
+        throw std::runtime_error("Could not stat rule pack file " + filename);
+    }
+
+    n_bytes = static_cast<std::size_t>(file_status.st_size);
+    void *mapping = n_bytes == 0 ? MAP_FAILED
+                                 : ::mmap(nullptr, n_bytes, PROT_READ, MAP_SHARED, 
+                                          file_descriptor, 0);
+    ::close(file_descriptor);
+    if (mapping == MAP_FAILED)
+        throw std::runtime_error("Could not map rule pack file " + filename);
+
+    data = static_cast<const unsigned char*>(mapping);
+    is_mapped = true;
+#else
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file)
+        throw std::runtime_error("Could not open rule pack file " + filename);
+
+    n_bytes = static_cast<std::size_t>(file.tellg());
+    file.seekg(0);
+
+    // doubles, so that the points arrays are suitably aligned
+    double *buffer = new double[n_bytes / sizeof(double) + 1];
+    file.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(n_bytes));
+    data = reinterpret_cast<const unsigned char*>(buffer);
+    if (!file)
+    {
+        close();
+        throw std::runtime_error("Could not read rule pack file " + filename);
+    }
+#endif
+
+    try
+    {
+        validate_rule_pack(data, n_bytes, filename);
+    }
+    catch (...)
+    {
+        close();
+        throw;
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+RulePack::~RulePack()
+{
+    close();
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+RulePack::RulePack(RulePack &&other) noexcept
+    : data(other.data), n_bytes(other.n_bytes), is_mapped(other.is_mapped)
+{
+    other.data = nullptr;
+    other.n_bytes = 0;
+    other.is_mapped = false;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+RulePack& RulePack::operator=(RulePack &&other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        std::swap(data, other.data);
+        std::swap(n_bytes, other.n_bytes);
+        std::swap(is_mapped, other.is_mapped);
+    }
+
+    return *this;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void RulePack::close()
+{
+    if (!data)
+        return;
+
+#if LEBEDEV_RULE_PACK_MMAP
+    if (is_mapped)
+        ::munmap(const_cast<unsigned char*>(data), n_bytes);
+#endif
+    if (!is_mapped)
+        delete[] reinterpret_cast<const double*>(data);
+
+    data = nullptr;
+    n_bytes = 0;
+    is_mapped = false;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t RulePack::size() const
+{
+    if (!data)
+        return 0;
+
+    RulePackHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    return static_cast<std::size_t>(header.n_rules);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+QuadraturePointsView RulePack::get_rule(std::size_t i) const
+{
+    if (i >= size())
+        throw std::invalid_argument("Rule pack holds no rule " + std::to_string(i));
+
+    const RulePackRule entry = read_rule_pack_rule(data, i);
+    const unsigned char *points = data + entry.points_offset;
+
+    return QuadraturePointsView(reinterpret_cast<const double*>(points),
+                                reinterpret_cast<const double*>(points + entry.points_stride),
+                                reinterpret_cast<const double*>(points + 2 * entry.points_stride),
+                                reinterpret_cast<const double*>(points + 3 * entry.points_stride),
+                                entry.n_points);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+QuadraturePointsView RulePack::get_rule(QuadratureOrder quad_order) const
+{
+    const std::size_t n_rules = size();
+    for (std::size_t i = 0; i < n_rules; ++i)
+        if (read_rule_pack_rule(data, i).n_points == static_cast<unsigned int>(quad_order))
+            return get_rule(i);
+
+    throw std::invalid_argument("Rule pack holds no rule of order " 
+                                + std::to_string(static_cast<unsigned int>(quad_order)));
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+bool RulePack::contains(QuadratureOrder quad_order) const
+{
+    const std::size_t n_rules = size();
+    for (std::size_t i = 0; i < n_rules; ++i)
+        if (read_rule_pack_rule(data, i).n_points == static_cast<unsigned int>(quad_order))
+            return true;
+
+    return false;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+unsigned int RulePack::get_precision(std::size_t i) const
+{
+    if (i >= size())
+        throw std::invalid_argument("Rule pack holds no rule " + std::to_string(i));
+
+    return read_rule_pack_rule(data, i).precision;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::array<unsigned int, n_generating_rules> RulePack::get_n_orbits(std::size_t i) const
+{
+    if (i >= size())
+        throw std::invalid_argument("Rule pack holds no rule " + std::to_string(i));
+
+    const RulePackRule entry = read_rule_pack_rule(data, i);
+    std::array<unsigned int, n_generating_rules> n_orbits;
+    for (unsigned int rule = 0; rule < n_generating_rules; ++rule)
+        n_orbits[rule] = entry.n_orbits[rule];
+
+    return n_orbits;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::vector<GeneratorPoint> RulePack::get_generator_points(std::size_t i) const
+{
+    if (i >= size())
+        throw std::invalid_argument("Rule pack holds no rule " + std::to_string(i));
+
+    const RulePackRule entry = read_rule_pack_rule(data, i);
+
+    std::vector<GeneratorPoint> generator_points;
+    generator_points.reserve(entry.n_generators);
+    for (std::size_t j = 0; j < entry.n_generators; ++j)
+    {
+        RulePackGenerator generator;
+        std::memcpy(&generator, 
+                    data + entry.generators_offset + j * sizeof(RulePackGenerator),
+                    sizeof(generator));
+
+        if (generator.generating_rule >= n_generating_rules)
+            throw std::invalid_argument("Not a valid octahedral generating rule");
+
+        generator_points.emplace_back(generator.a, generator.b, generator.c, generator.weight,
+                                      static_cast<OhPointGen>(generator.generating_rule));
+    }
+
+    return generator_points;
+}
+
+} // namespace lebedev
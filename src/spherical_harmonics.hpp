@@ -0,0 +1,323 @@
+#ifndef SPHERICAL_HARMONICS_HPP
+#define SPHERICAL_HARMONICS_HPP
+
+#include "preprocessor.hpp"
+#include "quadrature_order.hpp"
+#include "quadrature_points.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace lebedev {
+
+/**
+ * \brief Number of harmonic coefficients handled together by the blocked
+ * transforms of `SphericalHarmonicTransform`.
+ *
+ * A block of the harmonics table (`transform_point_block_size` pairs of
+ * points by this many harmonics) is 128 kB, which stays in L2 while it is
+ * used for every field, and the coefficients it updates take 2 kB per
+ * field.
+ */
+constexpr std::size_t harmonic_block_size = 256;
+
+/** \brief Number of pairs of quadrature points handled together by the
+ * blocked transforms of `SphericalHarmonicTransform` */
+constexpr std::size_t transform_point_block_size = 64;
+
+/**
+ * \brief Number of pairs of points whose harmonics are found together, one
+ * per lane, by the recurrences of `SphericalHarmonicTransform` without a
+ * table.
+ *
+ * One AVX-512 vector, or two AVX2 or SSE2 ones.
+ */
+constexpr std::size_t recurrence_block_size = 8;
+
+/**
+ * \brief Number of fields whose coefficients `SphericalHarmonicTransform::filter`
+ * keeps at once, between analyzing and synthesizing them.
+ *
+ * Their coefficients take 215 kB for `l_max` 40, so they stay in cache
+ * rather than being written to memory.
+ */
+constexpr std::size_t filter_field_block_size = 16;
+
+/** \brief Returns the number of spherical harmonics of degree at most
+ * `l_max`, \f$ (l_\text{max} + 1)^2 \f$ */
+std::size_t n_spherical_harmonics(unsigned int l_max);
+
+/**
+ * \brief Returns the position of the harmonic of degree `l` and order `m`
+ * (\f$ -l \leq m \leq l \f$) in arrays of harmonics or coefficients,
+ * \f$ l^2 + l + m \f$.
+ */
+std::size_t spherical_harmonic_index(unsigned int l, int m);
+
+/**
+ * \brief Writes the orthonormal real spherical harmonics of degree at most
+ * `l_max` at the point (`x`, `y`, `z`) of the unit sphere into `values`,
+ * which must have room for `n_spherical_harmonics(l_max)` doubles.
+ *
+ * For \f$ m > 0 \f$ these are \f$ \sqrt{2} N_{lm} P_l^m(z) \cos(m \phi) \f$,
+ * for \f$ m < 0 \f$ \f$ \sqrt{2} N_{l|m|} P_l^{|m|}(z) \sin(|m| \phi) \f$,
+ * and for \f$ m = 0 \f$ \f$ N_{l0} P_l(z) \f$, where the associated Legendre
+ * functions \f$ P_l^m \f$ have no Condon-Shortley phase.
+ * The Legendre functions are found from the usual three-term recurrence in
+ * `l`, and \f$ \sin^m\theta \, e^{i m \phi} \f$ as \f$ (x + i y)^m \f$, so no
+ * angles are calculated.
+ */
+void real_spherical_harmonics(double x,
+                              double y,
+                              double z,
+                              unsigned int l_max,
+                              double *values);
+
+/**
+ * \brief How `SphericalHarmonicTransform` gets the harmonics at the
+ * quadrature points.
+ */
+enum class HarmonicStorage
+{
+    /** \brief Tabulated once, on construction */
+    table,
+    /** \brief Calculated by the Legendre recurrences during each transform */
+    recurrence
+};
+
+/**
+ * \brief Spherical harmonic transforms (analysis, synthesis, and filters
+ * between them) on a Lebedev rule, for degrees up to `l_max`.
+ *
+ * The points of a Lebedev rule come in pairs \f$ (x, y, \pm z) \f$ with
+ * equal weights (or lie on the plane \f$ z = 0 \f$), and
+ * \f$ Y_{lm}(x, y, -z) = (-1)^{l + m} Y_{lm}(x, y, z) \f$, so the real
+ * harmonics are only calculated at one point of each pair, once, on
+ * construction.
+ * Each transform is then a matrix product of the fields' sums and
+ * differences at the pairs of points (or their coefficients) with that
+ * table, blocked so that the table is read from memory once for a whole
+ * batch of fields.
+ * The table takes about `n_points * n_spherical_harmonics(l_max) / 2`
+ * doubles (e.g. 16 MB for order 2354 with `l_max` 40, and 100 MB for order
+ * 5810 with `l_max` 65), and `shared` hands out one copy per rule and
+ * degree.
+ *
+ * With `HarmonicStorage::recurrence` there is no table: each transform
+ * runs the Legendre recurrences in `l` for `recurrence_block_size` pairs of
+ * points at a time, vectorized across the pairs, with one order `m` after
+ * another, and uses each harmonic as soon as it is found.
+ * The recurrences cost a few more operations per harmonic than reading the
+ * table (amortized over four fields at a time), but only a few arrays of
+ * one value per pair are kept, which stay in L2 for every rule, and nothing
+ * needs to be stored per rule and degree.
+ *
+ * A rule integrates the product of two harmonics exactly as long as its
+ * precision is at least `2 * l_max`, in which case the coefficients of a
+ * field of degree at most `l_max` are exact; higher degrees of the field
+ * alias onto the coefficients otherwise.
+ */
+class SphericalHarmonicTransform
+{
+public:
+    /** \brief vector of doubles */
+    using vec = std::vector<double>;
+
+    /** \brief Sets up transforms on a tabulated rule */
+    SphericalHarmonicTransform(QuadratureOrder quad_order, 
+                               unsigned int l_max,
+                               HarmonicStorage storage = HarmonicStorage::table);
+
+    /** \brief Sets up transforms on the points of `quad_points`.
+     *
+     * Throws `std::invalid_argument` if the points are not symmetric under
+     * reflection in the plane \f$ z = 0 \f$.
+     */
+    SphericalHarmonicTransform(const QuadraturePoints &quad_points, 
+                               unsigned int l_max,
+                               HarmonicStorage storage = HarmonicStorage::table);
+
+    /** \brief Returns a handle to a process-wide, immutable transform of the
+     * given rule, degree, and storage, which is only set up on first
+     * request.
+     *
+     * See `QuadraturePoints::shared`.
+     */
+    static std::shared_ptr<const SphericalHarmonicTransform>
+    shared(QuadratureOrder quad_order, 
+           unsigned int l_max,
+           HarmonicStorage storage = HarmonicStorage::table);
+
+    /** \brief Returns the highest degree of the transform */
+    unsigned int get_l_max() const;
+
+    /** \brief Returns how the harmonics are found */
+    HarmonicStorage get_storage() const;
+
+    /** \brief Returns number of quadrature points */
+    std::size_t n_points() const;
+
+    /** \brief Returns number of pairs of points \f$ (x, y, \pm z) \f$ at
+     * which the harmonics are tabulated, counting points with
+     * \f$ z = 0 \f$ as pairs on their own */
+    std::size_t n_point_pairs() const;
+
+    /** \brief Returns number of coefficients of each field, `n_spherical_harmonics(l_max)` */
+    std::size_t n_coefficients() const;
+
+    /** \brief Returns number of bytes held by this transform */
+    std::size_t memory_usage() const;
+
+    /**
+     * \brief Calculates the real harmonic coefficients of `n_fields` real
+     * fields.
+     *
+     * `fields` holds the values of each field at all of the quadrature
+     * points, one field after another (an `n_fields` by `n_points` row-major
+     * matrix), and the coefficients
+     * \f$ \int f Y_{lm} \, d\Omega \f$ are written to `coefficients` in the
+     * same way (`n_fields` by `n_coefficients`), ordered by
+     * `spherical_harmonic_index`.
+     */
+    void analyze(const double *fields,
+                 std::size_t n_fields,
+                 double *coefficients) const;
+
+    /**
+     * \brief Calculates the complex harmonic coefficients
+     * \f$ \int f \, \overline{Y_{lm}} \, d\Omega \f$ of `n_fields` complex
+     * fields, laid out as in the real overload.
+     *
+     * The complex harmonics include the Condon-Shortley phase,
+     * \f$ Y_{lm} = (-1)^m N_{lm} P_l^m(\cos\theta) e^{i m \phi} \f$.
+     * The real and imaginary parts are analyzed with the real harmonics, and
+     * their coefficients combined, so this costs as much as `2 * n_fields`
+     * real fields.
+     */
+    void analyze(const std::complex<double> *fields,
+                 std::size_t n_fields,
+                 std::complex<double> *coefficients) const;
+
+    /**
+     * \brief Evaluates `n_fields` expansions in the real harmonics at the
+     * quadrature points, the inverse of the real `analyze` for fields of
+     * degree at most `l_max`.
+     *
+     * `coefficients` and `fields` are laid out as in `analyze`.
+     */
+    void synthesize(const double *coefficients,
+                    std::size_t n_fields,
+                    double *fields) const;
+
+    /** \brief Evaluates `n_fields` expansions in the complex harmonics at
+     * the quadrature points, the inverse of the complex `analyze` */
+    void synthesize(const std::complex<double> *coefficients,
+                    std::size_t n_fields,
+                    std::complex<double> *fields) const;
+
+    /**
+     * \brief Analyzes `n_fields` real fields, multiplies each coefficient of
+     * degree `l` by `degree_factors[l]`, and synthesizes the result into
+     * `filtered`, e.g. to smooth fields or to remove the degrees which a
+     * product of fields aliases.
+     *
+     * `degree_factors` holds `l_max + 1` factors.
+     * The fields are taken `filter_field_block_size` at a time, and the
+     * coefficients of each block are synthesized while they are in cache,
+     * rather than the coefficients of every field being written out first.
+     * `filtered` may be the same array as `fields`.
+     */
+    void filter(const double *fields,
+                std::size_t n_fields,
+                const double *degree_factors,
+                double *filtered) const;
+
+private:
+    /**
+     * \brief Adds the real harmonic coefficients of `n_fields` fields, in
+     * the order of the table's columns, to `coefficients` (`n_fields` by
+     * `n_coefficients`).
+     *
+     * The value of field `f` at point `i` is
+     * `fields[f * field_stride + i * point_stride]`, so that the real and
+     * imaginary parts of complex fields can be read in place.
+     */
+    void add_coefficients(const double *fields,
+                          std::size_t n_fields,
+                          std::size_t field_stride,
+                          std::size_t point_stride,
+                          double *coefficients) const;
+
+    /** \brief Writes the expansions of `n_fields` fields in the real
+     * harmonics, with coefficients in the order of the table's columns, to
+     * `fields`, which is laid out as in `add_coefficients` */
+    void write_values(const double *coefficients,
+                      std::size_t n_fields,
+                      double *fields,
+                      std::size_t field_stride,
+                      std::size_t point_stride) const;
+
+    /** \brief `add_coefficients` with the harmonics found by recurrence */
+    void add_recurrence_coefficients(const double *fields,
+                                     std::size_t n_fields,
+                                     std::size_t field_stride,
+                                     std::size_t point_stride,
+                                     double *coefficients) const;
+
+    /** \brief `write_values` with the harmonics found by recurrence */
+    void write_recurrence_values(const double *coefficients,
+                                 std::size_t n_fields,
+                                 double *fields,
+                                 std::size_t field_stride,
+                                 std::size_t point_stride) const;
+
+    /** \brief Copies `n_fields` rows of coefficients in the order of the
+     * table's columns to `spherical_harmonic_index` order */
+    void to_index_order(const double *column_coefficients,
+                        std::size_t n_fields,
+                        double *coefficients) const;
+
+    /** \brief Copies `n_fields` rows of coefficients in
+     * `spherical_harmonic_index` order to the order of the table's columns */
+    void to_column_order(const double *coefficients,
+                         std::size_t n_fields,
+                         double *column_coefficients) const;
+
+    /** \brief Highest degree of the harmonics */
+    unsigned int l_max;
+    /** \brief How the harmonics are found */
+    HarmonicStorage storage;
+    /** \brief Number of quadrature points */
+    std::size_t n_quadrature_points;
+    /** \brief Point with \f$ z \geq 0 \f$ of each pair */
+    std::vector<std::size_t> upper_points;
+    /** \brief Point with \f$ z \leq 0 \f$ of each pair, the same as the
+     * upper one on the plane \f$ z = 0 \f$ */
+    std::vector<std::size_t> lower_points;
+    /** \brief Weight of each pair's points, multiplied by \f$ 4 \pi \f$, and
+     * halved for points counted twice */
+    vec pair_weights;
+    /** \brief `spherical_harmonic_index` of each column of the table: the
+     * harmonics with even \f$ l + m \f$, then those with odd \f$ l + m \f$ */
+    std::vector<std::size_t> harmonic_indices;
+    /** \brief Number of harmonics with even \f$ l + m \f$ */
+    std::size_t n_even_harmonics;
+    /** \brief Column of the table of each harmonic, by `spherical_harmonic_index` */
+    std::vector<std::size_t> harmonic_columns;
+    /** \brief Coordinates of the upper point of each pair, padded with
+     * zeros to a multiple of `recurrence_block_size` */
+    vec pair_x;
+    /** \brief y-coordinates of the upper points, padded like `pair_x` */
+    vec pair_y;
+    /** \brief z-coordinates of the upper points, padded like `pair_x` */
+    vec pair_z;
+    /** \brief Real harmonics at the upper point of each pair, one pair after
+     * another, or empty with `HarmonicStorage::recurrence` */
+    vec harmonics;
+};
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,1058 @@
+#include "preprocessor.hpp"
+#include "spherical_harmonics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace lebedev {
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t n_spherical_harmonics(unsigned int l_max)
+{
+    return static_cast<std::size_t>(l_max + 1) * (l_max + 1);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t spherical_harmonic_index(unsigned int l, int m)
+{
+    return static_cast<std::size_t>(l) * l + l + m;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void real_spherical_harmonics(double x,
+                              double y,
+                              double z,
+                              unsigned int l_max,
+                              double *values)
+{
+    // real and imaginary parts of (x + i y)^m
+    double cos_part = 1;
+    double sin_part = 0;
+    // N_mm P_m^m(z) / sin^m(theta)
+    double p_mm = 1 / std::sqrt(4 * M_PI);
+
+    for (unsigned int m = 0; m <= l_max; ++m)
+    {
+        if (m > 0)
+        {
+            p_mm *= std::sqrt((2.0 * m + 1) / (2.0 * m));
+            const double previous_cos_part = cos_part;
+            cos_part = previous_cos_part * x - sin_part * y;
+            sin_part = previous_cos_part * y + sin_part * x;
+        }
+        const double cos_scale = m > 0 ? std::sqrt(2.0) * cos_part : 1.0;
+        const double sin_scale = std::sqrt(2.0) * sin_part;
+
+        // p_l and p_{l-1} of N_lm P_l^m(z) / sin^m(theta), starting from l = m
+        double p_l = p_mm;
+        double p_l_minus_1 = 0;
+        for (unsigned int l = m; l <= l_max; ++l)
+        {
+            if (l == m + 1)
+            {
+                p_l_minus_1 = p_l;
+                p_l = std::sqrt(2.0 * m + 3) * z * p_l;
+            }
+            else if (l > m + 1)
+            {
+                const double l2 = static_cast<double>(l) * l;
+                const double m2 = static_cast<double>(m) * m;
+                const double a = std::sqrt((4 * l2 - 1) / (l2 - m2));
+                const double b = std::sqrt(((l - 1.0) * (l - 1.0) - m2)
+                                           / (4 * (l - 1.0) * (l - 1.0) - 1));
+                const double p_l_plus_1 = a * (z * p_l - b * p_l_minus_1);
+                p_l_minus_1 = p_l;
+                p_l = p_l_plus_1;
+            }
+
+            values[spherical_harmonic_index(l, m)] = cos_scale * p_l;
+            if (m > 0)
+                values[spherical_harmonic_index(l, -static_cast<int>(m))] = sin_scale * p_l;
+        }
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+SphericalHarmonicTransform::SphericalHarmonicTransform(QuadratureOrder quad_order,
+                                                       unsigned int l_max,
+                                                       HarmonicStorage storage)
+    : SphericalHarmonicTransform(QuadraturePoints(quad_order), l_max, storage)
+{}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+SphericalHarmonicTransform::SphericalHarmonicTransform(const QuadraturePoints &quad_points,
+                                                       unsigned int l_max,
+                                                       HarmonicStorage storage)
+    : l_max(l_max)
+    , storage(storage)
+    , n_quadrature_points(quad_points.get_weights().size())
+{
+    const vec &x = quad_points.get_x();
+    const vec &y = quad_points.get_y();
+    const vec &z = quad_points.get_z();
+    const vec &weights = quad_points.get_weights();
+    const std::size_t n = n_quadrature_points;
+
+    // once sorted, the points with the same x and y are next to each other:
+    // (x, y, -z) and (x, y, z), or one point with z = 0
+    std::vector<std::size_t> sorted_points(n);
+    for (std::size_t i = 0; i < n; ++i)
+        sorted_points[i] = i;
+    std::sort(sorted_points.begin(), sorted_points.end(),
+              [&](std::size_t i, std::size_t j)
+              {
+                  return std::tie(x[i], y[i], z[i]) < std::tie(x[j], y[j], z[j]);
+              });
+
+    std::vector<std::pair<std::size_t, std::size_t>> point_pairs;
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        const std::size_t i = sorted_points[j];
+        if (j + 1 < n && x[sorted_points[j + 1]] == x[i] && y[sorted_points[j + 1]] == y[i]
+            && z[sorted_points[j + 1]] == -z[i] && weights[sorted_points[j + 1]] == weights[i])
+        {
+            point_pairs.emplace_back(sorted_points[j + 1], i);
+            ++j;
+        }
+        else if (z[i] == 0)
+            point_pairs.emplace_back(i, i);
+        else
+            throw std::invalid_argument("Quadrature points are not symmetric under z -> -z");
+    }
+    std::sort(point_pairs.begin(), point_pairs.end());
+
+    for (const auto &point_pair : point_pairs)
+    {
+        upper_points.push_back(point_pair.first);
+        lower_points.push_back(point_pair.second);
+        pair_weights.push_back((point_pair.first == point_pair.second ? 2 : 4) 
+                               * M_PI * weights[point_pair.first]);
+    }
+
+    // harmonics with even l + m are even in z, and those with odd l + m odd
+    for (unsigned int parity = 0; parity < 2; ++parity)
+    {
+        for (unsigned int l = 0; l <= l_max; ++l)
+            for (int m = -static_cast<int>(l); m <= static_cast<int>(l); ++m)
+                if ((static_cast<int>(l) + m) % 2 == static_cast<int>(parity))
+                    harmonic_indices.push_back(spherical_harmonic_index(l, m));
+        if (parity == 0)
+            n_even_harmonics = harmonic_indices.size();
+    }
+
+    const std::size_t n_harmonics = n_spherical_harmonics(l_max);
+    harmonic_columns.resize(n_harmonics);
+    for (std::size_t k = 0; k < n_harmonics; ++k)
+        harmonic_columns[harmonic_indices[k]] = k;
+
+    const std::size_t n_pairs = upper_points.size();
+    const std::size_t n_padded_pairs = (n_pairs + recurrence_block_size - 1) 
+                                       / recurrence_block_size * recurrence_block_size;
+    pair_x.resize(n_padded_pairs, 0.0);
+    pair_y.resize(n_padded_pairs, 0.0);
+    pair_z.resize(n_padded_pairs, 0.0);
+    for (std::size_t p = 0; p < n_pairs; ++p)
+    {
+        pair_x[p] = x[upper_points[p]];
+        pair_y[p] = y[upper_points[p]];
+        pair_z[p] = z[upper_points[p]];
+    }
+
+    if (storage == HarmonicStorage::recurrence)
+        return;
+
+    vec values(n_harmonics);
+    harmonics.resize(upper_points.size() * n_harmonics);
+    for (std::size_t p = 0; p < upper_points.size(); ++p)
+    {
+        const std::size_t i = upper_points[p];
+        real_spherical_harmonics(x[i], y[i], z[i], l_max, values.data());
+        for (std::size_t k = 0; k < n_harmonics; ++k)
+            harmonics[p * n_harmonics + k] = values[harmonic_indices[k]];
+    }
+}
+
+
+
+/**
+ * \brief Storage for the transforms handed out by
+ * `SphericalHarmonicTransform::shared`, keyed by rule number, degree, and
+ * storage.
+ */
+struct SharedSphericalHarmonicTransforms
+{
+    std::mutex mutex;
+    std::map<std::tuple<unsigned int, unsigned int, HarmonicStorage>,
+             std::shared_ptr<const SphericalHarmonicTransform>> transforms;
+};
+
+
+
+LEBEDEV_INTERNAL_LINKAGE
+SharedSphericalHarmonicTransforms& get_shared_spherical_harmonic_transforms()
+{
+    static SharedSphericalHarmonicTransforms shared_transforms;
+    return shared_transforms;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::shared_ptr<const SphericalHarmonicTransform>
+SphericalHarmonicTransform::shared(QuadratureOrder quad_order, 
+                                   unsigned int l_max,
+                                   HarmonicStorage storage)
+{
+    auto &shared_transforms = get_shared_spherical_harmonic_transforms();
+    std::lock_guard<std::mutex> lock(shared_transforms.mutex);
+
+    const auto key = std::make_tuple(get_rule_number(quad_order), l_max, storage);
+    auto &transform = shared_transforms.transforms[key];
+    if (!transform)
+        transform = std::make_shared<const SphericalHarmonicTransform>(
+            *QuadraturePoints::shared(quad_order), l_max, storage);
+
+    return transform;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+unsigned int SphericalHarmonicTransform::get_l_max() const
+{
+    return l_max;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+HarmonicStorage SphericalHarmonicTransform::get_storage() const
+{
+    return storage;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t SphericalHarmonicTransform::n_points() const
+{
+    return n_quadrature_points;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t SphericalHarmonicTransform::n_point_pairs() const
+{
+    return upper_points.size();
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t SphericalHarmonicTransform::n_coefficients() const
+{
+    return n_spherical_harmonics(l_max);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::size_t SphericalHarmonicTransform::memory_usage() const
+{
+    return sizeof(SphericalHarmonicTransform)
+           + sizeof(std::size_t) * (upper_points.capacity() + lower_points.capacity()
+                                    + harmonic_indices.capacity() + harmonic_columns.capacity())
+           + sizeof(double) * (pair_weights.capacity() + pair_x.capacity() + pair_y.capacity()
+                               + pair_z.capacity() + harmonics.capacity());
+}
+
+
+
+/**
+ * \brief Adds the products of the rows of harmonics at `n_block_pairs`
+ * pairs of points (`row_stride` apart), between columns `begin` and `end`,
+ * with the weighted sums and differences of `n_fields` fields at the
+ * points, to the fields' coefficients (`coefficient_stride` apart).
+ *
+ * Columns before `n_even` are harmonics which are even in z, and take the
+ * sum of the values at the two points of a pair; the others take the
+ * difference.
+ * `n_fields` is known at compile time, so the weighted values stay in
+ * registers, and the loops over columns have no dependence between
+ * iterations, so they vectorize.
+ */
+template <std::size_t n_fields>
+LEBEDEV_INTERNAL_LINKAGE
+void add_pair_block_coefficients(const double *rows,
+                                 std::size_t row_stride,
+                                 std::size_t begin,
+                                 std::size_t end,
+                                 std::size_t n_even,
+                                 const double *pair_weights,
+                                 const std::size_t *upper_points,
+                                 const std::size_t *lower_points,
+                                 std::size_t n_block_pairs,
+                                 const double *fields,
+                                 std::size_t field_stride,
+                                 std::size_t point_stride,
+                                 double *coefficients,
+                                 std::size_t coefficient_stride)
+{
+    const std::size_t even_end = std::min(end, n_even);
+    const std::size_t odd_begin = std::max(begin, n_even);
+
+    for (std::size_t p = 0; p < n_block_pairs; ++p)
+    {
+        const double *row = rows + p * row_stride;
+        double even_values[n_fields];
+        double odd_values[n_fields];
+        for (std::size_t f = 0; f < n_fields; ++f)
+        {
+            const double upper_value = fields[f * field_stride + upper_points[p] * point_stride];
+            const double lower_value = fields[f * field_stride + lower_points[p] * point_stride];
+            even_values[f] = pair_weights[p] * (upper_value + lower_value);
+            odd_values[f] = pair_weights[p] * (upper_value - lower_value);
+        }
+
+        for (std::size_t k = begin; k < even_end; ++k)
+            for (std::size_t f = 0; f < n_fields; ++f)
+                coefficients[f * coefficient_stride + k] += even_values[f] * row[k];
+        for (std::size_t k = odd_begin; k < end; ++k)
+            for (std::size_t f = 0; f < n_fields; ++f)
+                coefficients[f * coefficient_stride + k] += odd_values[f] * row[k];
+    }
+}
+
+
+
+/**
+ * \brief Adds the parts of the expansion of one field between columns
+ * `begin` and `end` at `n_block_pairs` pairs of points to the field's
+ * values.
+ *
+ * The even harmonics' part is added at the upper point and the odd
+ * harmonics' part at the lower point of each pair, to be combined once
+ * every column has been added.
+ * Each part is a dot product, taken with the SIMD kernels of
+ * `weighted_sum`.
+ */
+LEBEDEV_INTERNAL_LINKAGE
+void add_pair_block_values(const double *rows,
+                           std::size_t row_stride,
+                           std::size_t begin,
+                           std::size_t end,
+                           std::size_t n_even,
+                           const std::size_t *upper_points,
+                           const std::size_t *lower_points,
+                           std::size_t n_block_pairs,
+                           const double *coefficients,
+                           double *field,
+                           std::size_t point_stride)
+{
+    const std::size_t even_end = std::min(end, n_even);
+    const std::size_t odd_begin = std::max(begin, n_even);
+
+    for (std::size_t p = 0; p < n_block_pairs; ++p)
+    {
+        const double *row = rows + p * row_stride;
+        if (begin < even_end)
+            field[upper_points[p] * point_stride] 
+                += weighted_sum(coefficients + begin, row + begin, even_end - begin);
+        // odd harmonics vanish on the plane z = 0
+        if (odd_begin < end && upper_points[p] != lower_points[p])
+            field[lower_points[p] * point_stride] 
+                += weighted_sum(coefficients + odd_begin, row + odd_begin, end - odd_begin);
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void SphericalHarmonicTransform::add_coefficients(const double *fields,
+                                                  std::size_t n_fields,
+                                                  std::size_t field_stride,
+                                                  std::size_t point_stride,
+                                                  double *coefficients) const
+{
+    if (storage == HarmonicStorage::recurrence)
+        return add_recurrence_coefficients(fields, n_fields, field_stride, point_stride, 
+                                           coefficients);
+
+    const std::size_t n_pairs = upper_points.size();
+    const std::size_t n_harmonics = n_coefficients();
+
+    // each block of the table is read from memory once, and used for all
+    // of the fields while it is in cache
+    for (std::size_t k = 0; k < n_harmonics; k += harmonic_block_size)
+    {
+        const std::size_t end = std::min(k + harmonic_block_size, n_harmonics);
+        for (std::size_t p = 0; p < n_pairs; p += transform_point_block_size)
+        {
+            const std::size_t n_block_pairs = std::min(transform_point_block_size, n_pairs - p);
+            const double *rows = harmonics.data() + p * n_harmonics;
+
+            std::size_t f = 0;
+            for (; f + 4 <= n_fields; f += 4)
+                add_pair_block_coefficients<4>(rows, n_harmonics, k, end, n_even_harmonics,
+                                               pair_weights.data() + p, upper_points.data() + p,
+                                               lower_points.data() + p, n_block_pairs,
+                                               fields + f * field_stride, field_stride,
+                                               point_stride, coefficients + f * n_harmonics,
+                                               n_harmonics);
+            for (; f < n_fields; ++f)
+                add_pair_block_coefficients<1>(rows, n_harmonics, k, end, n_even_harmonics,
+                                               pair_weights.data() + p, upper_points.data() + p,
+                                               lower_points.data() + p, n_block_pairs,
+                                               fields + f * field_stride, field_stride,
+                                               point_stride, coefficients + f * n_harmonics,
+                                               n_harmonics);
+        }
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void SphericalHarmonicTransform::write_values(const double *coefficients,
+                                              std::size_t n_fields,
+                                              double *fields,
+                                              std::size_t field_stride,
+                                              std::size_t point_stride) const
+{
+    if (storage == HarmonicStorage::recurrence)
+        return write_recurrence_values(coefficients, n_fields, fields, field_stride, 
+                                       point_stride);
+
+    const std::size_t n_pairs = upper_points.size();
+    const std::size_t n_harmonics = n_coefficients();
+
+    for (std::size_t f = 0; f < n_fields; ++f)
+        for (std::size_t i = 0; i < n_quadrature_points; ++i)
+            fields[f * field_stride + i * point_stride] = 0;
+
+    for (std::size_t k = 0; k < n_harmonics; k += harmonic_block_size)
+    {
+        const std::size_t end = std::min(k + harmonic_block_size, n_harmonics);
+        for (std::size_t p = 0; p < n_pairs; p += transform_point_block_size)
+        {
+            const std::size_t n_block_pairs = std::min(transform_point_block_size, n_pairs - p);
+            const double *rows = harmonics.data() + p * n_harmonics;
+
+            for (std::size_t f = 0; f < n_fields; ++f)
+                add_pair_block_values(rows, n_harmonics, k, end, n_even_harmonics,
+                                      upper_points.data() + p, lower_points.data() + p,
+                                      n_block_pairs, coefficients + f * n_harmonics,
+                                      fields + f * field_stride, point_stride);
+        }
+    }
+
+    // the even part E is at the upper point and the odd part O at the lower
+    // one, whose values are E + O and E - O
+    for (std::size_t f = 0; f < n_fields; ++f)
+        for (std::size_t p = 0; p < n_pairs; ++p)
+            if (upper_points[p] != lower_points[p])
+            {
+                double &upper_value = fields[f * field_stride + upper_points[p] * point_stride];
+                double &lower_value = fields[f * field_stride + lower_points[p] * point_stride];
+                const double even_part = upper_value;
+                const double odd_part = lower_value;
+                upper_value = even_part + odd_part;
+                lower_value = even_part - odd_part;
+            }
+}
+
+
+
+/**
+ * \brief Rotates the real and imaginary parts of \f$ (x + i y)^{m-1} \f$ at
+ * `n` points to those of \f$ (x + i y)^m \f$, and writes the recurrence
+ * factors of order `m` up to degree `l_max + 1` to `a` and `b`, returning
+ * \f$ N_{mm} P_m^m / \sin^m\theta \f$ given its value for `m - 1`.
+ *
+ * The Legendre functions follow
+ * \f$ p_l = a_l (z \, p_{l-1} - b_l \, p_{l-2}) \f$, as in
+ * `real_spherical_harmonics`, with \f$ b_{m+1} = 0 \f$ so that the same
+ * step also gives \f$ p_{m+1} = \sqrt{2m + 3} \, z \, p_m \f$.
+ */
+LEBEDEV_INTERNAL_LINKAGE
+double next_harmonic_order(unsigned int m,
+                           unsigned int l_max,
+                           const double *x,
+                           const double *y,
+                           std::size_t n,
+                           double *cos_parts,
+                           double *sin_parts,
+                           double *a,
+                           double *b,
+                           double p_mm)
+{
+    if (m == 0)
+    {
+        std::fill(cos_parts, cos_parts + n, 1.0);
+        std::fill(sin_parts, sin_parts + n, 0.0);
+    }
+    else
+    {
+        p_mm *= std::sqrt((2.0 * m + 1) / (2.0 * m));
+        for (std::size_t p = 0; p < n; ++p)
+        {
+            const double previous_cos_part = cos_parts[p];
+            cos_parts[p] = previous_cos_part * x[p] - sin_parts[p] * y[p];
+            sin_parts[p] = previous_cos_part * y[p] + sin_parts[p] * x[p];
+        }
+    }
+
+    a[m + 1] = std::sqrt(2.0 * m + 3);
+    b[m + 1] = 0;
+    const double m2 = static_cast<double>(m) * m;
+    for (unsigned int l = m + 2; l <= l_max + 1; ++l)
+    {
+        const double l2 = static_cast<double>(l) * l;
+        a[l] = std::sqrt((4 * l2 - 1) / (l2 - m2));
+        b[l] = std::sqrt(((l - 1.0) * (l - 1.0) - m2) / (4 * (l - 1.0) * (l - 1.0) - 1));
+    }
+
+    return p_mm;
+}
+
+
+
+/**
+ * \brief Advances the Legendre functions of `recurrence_block_size` points
+ * from degree `l - 1` (`p_l`, with degree `l - 2` in `p_l_minus_1`) to
+ * degree `l`, given the factors `a_l` and `b_l` of the recurrence.
+ */
+LEBEDEV_ALWAYS_INLINE
+void next_harmonic_degree(double a_l,
+                          double b_l,
+                          const double *z,
+                          double *p_l,
+                          double *p_l_minus_1)
+{
+    for (std::size_t lane = 0; lane < recurrence_block_size; ++lane)
+    {
+        const double p_l_plus_1 = a_l * (z[lane] * p_l[lane] - b_l * p_l_minus_1[lane]);
+        p_l_minus_1[lane] = p_l[lane];
+        p_l[lane] = p_l_plus_1;
+    }
+}
+
+
+
+/**
+ * \brief Adds the harmonic coefficients of order `m` (and `-m`) of
+ * `n_fields` fields to `coefficients`, given the weighted sums
+ * (`even_values`) and differences (`odd_values`) of the fields at
+ * `n_padded_pairs` pairs of points, `n_padded_pairs` apart.
+ *
+ * Each lane accumulates the pairs it is given, in `accumulators` (room for
+ * `2 * n_fields * (l_max + 1) * recurrence_block_size` doubles), and the
+ * lanes are only added together once every pair has been seen.
+ * `a` and `b` are the factors written by `next_harmonic_order`.
+ */
+template <std::size_t n_fields>
+LEBEDEV_INTERNAL_LINKAGE
+void add_order_coefficients(unsigned int m,
+                            unsigned int l_max,
+                            double p_mm,
+                            const double *a,
+                            const double *b,
+                            const double *z,
+                            const double *cos_parts,
+                            const double *sin_parts,
+                            std::size_t n_padded_pairs,
+                            const double *even_values,
+                            const double *odd_values,
+                            const std::size_t *harmonic_columns,
+                            double *accumulators,
+                            double *coefficients,
+                            std::size_t coefficient_stride)
+{
+    constexpr std::size_t lanes = recurrence_block_size;
+    const std::size_t n_degrees = l_max + 1;
+    std::fill(accumulators, accumulators + 2 * n_fields * n_degrees * lanes, 0.0);
+
+    for (std::size_t p = 0; p < n_padded_pairs; p += lanes)
+    {
+        // the even and odd values of the fields times the azimuthal parts
+        double values[2][n_fields][2][lanes];
+        for (std::size_t f = 0; f < n_fields; ++f)
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                const double even_value = even_values[f * n_padded_pairs + p + lane];
+                const double odd_value = odd_values[f * n_padded_pairs + p + lane];
+                values[0][f][0][lane] = even_value * cos_parts[p + lane];
+                values[0][f][1][lane] = even_value * sin_parts[p + lane];
+                values[1][f][0][lane] = odd_value * cos_parts[p + lane];
+                values[1][f][1][lane] = odd_value * sin_parts[p + lane];
+            }
+
+        double p_l[lanes], p_l_minus_1[lanes];
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            p_l[lane] = p_mm;
+            p_l_minus_1[lane] = 0;
+        }
+
+        for (unsigned int l = m; l <= l_max; ++l)
+        {
+            // harmonics with even l + m are even in z
+            const std::size_t parity = (l - m) % 2;
+            for (std::size_t f = 0; f < n_fields; ++f)
+            {
+                double *sums = accumulators + (f * n_degrees + l) * 2 * lanes;
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                {
+                    sums[lane] += values[parity][f][0][lane] * p_l[lane];
+                    sums[lanes + lane] += values[parity][f][1][lane] * p_l[lane];
+                }
+            }
+
+            next_harmonic_degree(a[l + 1], b[l + 1], z + p, p_l, p_l_minus_1);
+        }
+    }
+
+    const double scale = m > 0 ? std::sqrt(2.0) : 1.0;
+    for (std::size_t f = 0; f < n_fields; ++f)
+        for (unsigned int l = m; l <= l_max; ++l)
+        {
+            const double *cos_sums = accumulators + (f * n_degrees + l) * 2 * lanes;
+            const double *sin_sums = cos_sums + lanes;
+            double cos_sum = 0;
+            double sin_sum = 0;
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                cos_sum += cos_sums[lane];
+                sin_sum += sin_sums[lane];
+            }
+
+            coefficients[f * coefficient_stride + harmonic_columns[spherical_harmonic_index(l, m)]]
+                += scale * cos_sum;
+            if (m > 0)
+                coefficients[f * coefficient_stride 
+                             + harmonic_columns[spherical_harmonic_index(l, -static_cast<int>(m))]]
+                    += scale * sin_sum;
+        }
+}
+
+
+
+/**
+ * \brief Adds the parts of order `m` (and `-m`) of the expansions of
+ * `n_fields` fields at `n_padded_pairs` pairs of points to their even
+ * (`even_parts`) and odd (`odd_parts`) parts, `n_padded_pairs` apart.
+ *
+ * `scaled_coefficients` has room for
+ * `2 * n_fields * (l_max + 1) * recurrence_block_size` doubles.
+ */
+template <std::size_t n_fields>
+LEBEDEV_INTERNAL_LINKAGE
+void add_order_values(unsigned int m,
+                      unsigned int l_max,
+                      double p_mm,
+                      const double *a,
+                      const double *b,
+                      const double *z,
+                      const double *cos_parts,
+                      const double *sin_parts,
+                      std::size_t n_padded_pairs,
+                      const double *coefficients,
+                      std::size_t coefficient_stride,
+                      const std::size_t *harmonic_columns,
+                      double *scaled_coefficients,
+                      double *even_parts,
+                      double *odd_parts)
+{
+    constexpr std::size_t lanes = recurrence_block_size;
+
+    // the coefficients of order m and -m of each degree, copied to every lane
+    const double scale = m > 0 ? std::sqrt(2.0) : 1.0;
+    for (unsigned int l = m; l <= l_max; ++l)
+    {
+        const std::size_t cos_column = harmonic_columns[spherical_harmonic_index(l, m)];
+        const std::size_t sin_column 
+            = harmonic_columns[spherical_harmonic_index(l, -static_cast<int>(m))];
+        for (std::size_t f = 0; f < n_fields; ++f)
+        {
+            const double cos_coefficient = scale * coefficients[f * coefficient_stride + cos_column];
+            const double sin_coefficient 
+                = m > 0 ? scale * coefficients[f * coefficient_stride + sin_column] : 0.0;
+            double *lane_coefficients = scaled_coefficients + ((l - m) * n_fields + f) * 2 * lanes;
+            std::fill(lane_coefficients, lane_coefficients + lanes, cos_coefficient);
+            std::fill(lane_coefficients + lanes, lane_coefficients + 2 * lanes, sin_coefficient);
+        }
+    }
+
+    for (std::size_t p = 0; p < n_padded_pairs; p += lanes)
+    {
+        // the even and odd parts of the expansions, without the azimuthal parts
+        double sums[2][n_fields][2][lanes] = {};
+
+        double p_l[lanes], p_l_minus_1[lanes];
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            p_l[lane] = p_mm;
+            p_l_minus_1[lane] = 0;
+        }
+
+        for (unsigned int l = m; l <= l_max; ++l)
+        {
+            const std::size_t parity = (l - m) % 2;
+            for (std::size_t f = 0; f < n_fields; ++f)
+            {
+                const double *lane_coefficients 
+                    = scaled_coefficients + ((l - m) * n_fields + f) * 2 * lanes;
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                {
+                    sums[parity][f][0][lane] += lane_coefficients[lane] * p_l[lane];
+                    sums[parity][f][1][lane] += lane_coefficients[lanes + lane] * p_l[lane];
+                }
+            }
+
+            next_harmonic_degree(a[l + 1], b[l + 1], z + p, p_l, p_l_minus_1);
+        }
+
+        for (std::size_t f = 0; f < n_fields; ++f)
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                const double cos_part = cos_parts[p + lane];
+                const double sin_part = sin_parts[p + lane];
+                even_parts[f * n_padded_pairs + p + lane] 
+                    += cos_part * sums[0][f][0][lane] + sin_part * sums[0][f][1][lane];
+                odd_parts[f * n_padded_pairs + p + lane] 
+                    += cos_part * sums[1][f][0][lane] + sin_part * sums[1][f][1][lane];
+            }
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void SphericalHarmonicTransform::add_recurrence_coefficients(const double *fields,
+                                                             std::size_t n_fields,
+                                                             std::size_t field_stride,
+                                                             std::size_t point_stride,
+                                                             double *coefficients) const
+{
+    const std::size_t n_pairs = upper_points.size();
+    const std::size_t n_padded_pairs = pair_x.size();
+    const std::size_t n_harmonics = n_coefficients();
+    constexpr std::size_t group_size = 4;
+
+    vec cos_parts(n_padded_pairs);
+    vec sin_parts(n_padded_pairs);
+    vec a(l_max + 2);
+    vec b(l_max + 2);
+    vec even_values(group_size * n_padded_pairs, 0.0);
+    vec odd_values(group_size * n_padded_pairs, 0.0);
+    vec accumulators(2 * group_size * (l_max + 1) * recurrence_block_size);
+
+    // fields are taken four at a time, so that each step of the recurrences
+    // is used for all four
+    for (std::size_t f = 0; f < n_fields; f += group_size)
+    {
+        const std::size_t n_group_fields = std::min(group_size, n_fields - f);
+        for (std::size_t j = 0; j < n_group_fields; ++j)
+            for (std::size_t p = 0; p < n_pairs; ++p)
+            {
+                const double *field = fields + (f + j) * field_stride;
+                const double upper_value = field[upper_points[p] * point_stride];
+                const double lower_value = field[lower_points[p] * point_stride];
+                even_values[j * n_padded_pairs + p] = pair_weights[p] * (upper_value + lower_value);
+                odd_values[j * n_padded_pairs + p] = pair_weights[p] * (upper_value - lower_value);
+            }
+
+        double p_mm = 1 / std::sqrt(4 * M_PI);
+        for (unsigned int m = 0; m <= l_max; ++m)
+        {
+            p_mm = next_harmonic_order(m, l_max, pair_x.data(), pair_y.data(), n_padded_pairs,
+                                       cos_parts.data(), sin_parts.data(), a.data(), b.data(), 
+                                       p_mm);
+            if (n_group_fields == group_size)
+                add_order_coefficients<group_size>(m, l_max, p_mm, a.data(), b.data(), 
+                                                   pair_z.data(), cos_parts.data(), 
+                                                   sin_parts.data(), n_padded_pairs, 
+                                                   even_values.data(), odd_values.data(), 
+                                                   harmonic_columns.data(), accumulators.data(),
+                                                   coefficients + f * n_harmonics, n_harmonics);
+            else
+                for (std::size_t j = 0; j < n_group_fields; ++j)
+                    add_order_coefficients<1>(m, l_max, p_mm, a.data(), b.data(), 
+                                              pair_z.data(), cos_parts.data(), 
+                                              sin_parts.data(), n_padded_pairs, 
+                                              even_values.data() + j * n_padded_pairs, 
+                                              odd_values.data() + j * n_padded_pairs, 
+                                              harmonic_columns.data(), accumulators.data(),
+                                              coefficients + (f + j) * n_harmonics, n_harmonics);
+        }
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void SphericalHarmonicTransform::write_recurrence_values(const double *coefficients,
+                                                         std::size_t n_fields,
+                                                         double *fields,
+                                                         std::size_t field_stride,
+                                                         std::size_t point_stride) const
+{
+    const std::size_t n_pairs = upper_points.size();
+    const std::size_t n_padded_pairs = pair_x.size();
+    const std::size_t n_harmonics = n_coefficients();
+    constexpr std::size_t group_size = 4;
+
+    vec cos_parts(n_padded_pairs);
+    vec sin_parts(n_padded_pairs);
+    vec a(l_max + 2);
+    vec b(l_max + 2);
+    vec even_parts(group_size * n_padded_pairs);
+    vec odd_parts(group_size * n_padded_pairs);
+    vec scaled_coefficients(2 * group_size * (l_max + 1) * recurrence_block_size);
+
+    for (std::size_t f = 0; f < n_fields; f += group_size)
+    {
+        const std::size_t n_group_fields = std::min(group_size, n_fields - f);
+        std::fill(even_parts.begin(), even_parts.end(), 0.0);
+        std::fill(odd_parts.begin(), odd_parts.end(), 0.0);
+
+        double p_mm = 1 / std::sqrt(4 * M_PI);
+        for (unsigned int m = 0; m <= l_max; ++m)
+        {
+            p_mm = next_harmonic_order(m, l_max, pair_x.data(), pair_y.data(), n_padded_pairs,
+                                       cos_parts.data(), sin_parts.data(), a.data(), b.data(), 
+                                       p_mm);
+            if (n_group_fields == group_size)
+                add_order_values<group_size>(m, l_max, p_mm, a.data(), b.data(), pair_z.data(),
+                                             cos_parts.data(), sin_parts.data(), n_padded_pairs,
+                                             coefficients + f * n_harmonics, n_harmonics, 
+                                             harmonic_columns.data(), scaled_coefficients.data(),
+                                             even_parts.data(), odd_parts.data());
+            else
+                for (std::size_t j = 0; j < n_group_fields; ++j)
+                    add_order_values<1>(m, l_max, p_mm, a.data(), b.data(), pair_z.data(),
+                                        cos_parts.data(), sin_parts.data(), n_padded_pairs,
+                                        coefficients + (f + j) * n_harmonics, n_harmonics, 
+                                        harmonic_columns.data(), scaled_coefficients.data(),
+                                        even_parts.data() + j * n_padded_pairs, 
+                                        odd_parts.data() + j * n_padded_pairs);
+        }
+
+        // the values are E + O at the upper point and E - O at the lower one,
+        // which for points on the plane z = 0 (where O vanishes) are the same
+        for (std::size_t j = 0; j < n_group_fields; ++j)
+        {
+            double *field = fields + (f + j) * field_stride;
+            for (std::size_t p = 0; p < n_pairs; ++p)
+            {
+                const double even_part = even_parts[j * n_padded_pairs + p];
+                const double odd_part = odd_parts[j * n_padded_pairs + p];
+                field[upper_points[p] * point_stride] = even_part + odd_part;
+                field[lower_points[p] * point_stride] = even_part - odd_part;
+            }
+        }
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void SphericalHarmonicTransform::to_index_order(const double *column_coefficients,
+                                                std::size_t n_fields,
+                                                double *coefficients) const
+{
+    const std::size_t n_harmonics = n_coefficients();
+    for (std::size_t f = 0; f < n_fields; ++f)
+        for (std::size_t k = 0; k < n_harmonics; ++k)
+            coefficients[f * n_harmonics + harmonic_indices[k]] 
+                = column_coefficients[f * n_harmonics + k];
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void SphericalHarmonicTransform::to_column_order(const double *coefficients,
+                                                 std::size_t n_fields,
+                                                 double *column_coefficients) const
+{
+    const std::size_t n_harmonics = n_coefficients();
+    for (std::size_t f = 0; f < n_fields; ++f)
+        for (std::size_t k = 0; k < n_harmonics; ++k)
+            column_coefficients[f * n_harmonics + k] 
+                = coefficients[f * n_harmonics + harmonic_indices[k]];
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void SphericalHarmonicTransform::analyze(const double *fields,
+                                         std::size_t n_fields,
+                                         double *coefficients) const
+{
+    vec column_coefficients(n_fields * n_coefficients(), 0.0);
+    add_coefficients(fields, n_fields, n_quadrature_points, 1, column_coefficients.data());
+    to_index_order(column_coefficients.data(), n_fields, coefficients);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void SphericalHarmonicTransform::analyze(const std::complex<double> *fields,
+                                         std::size_t n_fields,
+                                         std::complex<double> *coefficients) const
+{
+    const std::size_t n_harmonics = n_coefficients();
+    const double *parts = reinterpret_cast<const double*>(fields);
+
+    // coefficients of the real and the imaginary parts, in the real harmonics
+    vec column_coefficients(n_fields * n_harmonics, 0.0);
+    vec real_coefficients(n_fields * n_harmonics);
+    vec imag_coefficients(n_fields * n_harmonics);
+    add_coefficients(parts, n_fields, 2 * n_quadrature_points, 2, column_coefficients.data());
+    to_index_order(column_coefficients.data(), n_fields, real_coefficients.data());
+    std::fill(column_coefficients.begin(), column_coefficients.end(), 0.0);
+    add_coefficients(parts + 1, n_fields, 2 * n_quadrature_points, 2, column_coefficients.data());
+    to_index_order(column_coefficients.data(), n_fields, imag_coefficients.data());
+
+    // conj(Y_lm) = (-1)^m (Y^R_lm - i Y^R_l,-m) / sqrt(2) and
+    // conj(Y_l,-m) = (Y^R_lm + i Y^R_l,-m) / sqrt(2) for m > 0
+    const std::complex<double> i_unit(0, 1);
+    for (std::size_t f = 0; f < n_fields; ++f)
+    {
+        const std::size_t offset = f * n_harmonics;
+        for (unsigned int l = 0; l <= l_max; ++l)
+        {
+            const std::size_t k = offset + spherical_harmonic_index(l, 0);
+            coefficients[k] = {real_coefficients[k], imag_coefficients[k]};
+
+            for (unsigned int m = 1; m <= l; ++m)
+            {
+                const std::size_t k_plus = k + m;
+                const std::size_t k_minus = k - m;
+                const std::complex<double> c_plus(real_coefficients[k_plus],
+                                                  imag_coefficients[k_plus]);
+                const std::complex<double> c_minus(real_coefficients[k_minus],
+                                                   imag_coefficients[k_minus]);
+                const double sign = m % 2 == 0 ? 1.0 : -1.0;
+
+                coefficients[k_plus] = sign * M_SQRT1_2 * (c_plus - i_unit * c_minus);
+                coefficients[k_minus] = M_SQRT1_2 * (c_plus + i_unit * c_minus);
+            }
+        }
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void SphericalHarmonicTransform::synthesize(const double *coefficients,
+                                            std::size_t n_fields,
+                                            double *fields) const
+{
+    vec column_coefficients(n_fields * n_coefficients());
+    to_column_order(coefficients, n_fields, column_coefficients.data());
+    write_values(column_coefficients.data(), n_fields, fields, n_quadrature_points, 1);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void SphericalHarmonicTransform::synthesize(const std::complex<double> *coefficients,
+                                            std::size_t n_fields,
+                                            std::complex<double> *fields) const
+{
+    const std::size_t n_harmonics = n_coefficients();
+
+    // coefficients of the real and the imaginary parts in the real
+    // harmonics, from Y_lm = (-1)^m (Y^R_lm + i Y^R_l,-m) / sqrt(2) and
+    // Y_l,-m = (Y^R_lm - i Y^R_l,-m) / sqrt(2) for m > 0
+    vec real_coefficients(n_fields * n_harmonics);
+    vec imag_coefficients(n_fields * n_harmonics);
+    const std::complex<double> i_unit(0, 1);
+    for (std::size_t f = 0; f < n_fields; ++f)
+    {
+        const std::size_t offset = f * n_harmonics;
+        for (unsigned int l = 0; l <= l_max; ++l)
+        {
+            const std::size_t k = offset + spherical_harmonic_index(l, 0);
+            real_coefficients[k] = coefficients[k].real();
+            imag_coefficients[k] = coefficients[k].imag();
+
+            for (unsigned int m = 1; m <= l; ++m)
+            {
+                const std::size_t k_plus = k + m;
+                const std::size_t k_minus = k - m;
+                const double sign = m % 2 == 0 ? 1.0 : -1.0;
+                const std::complex<double> c_plus
+                    = M_SQRT1_2 * (sign * coefficients[k_plus] + coefficients[k_minus]);
+                const std::complex<double> c_minus
+                    = M_SQRT1_2 * i_unit * (sign * coefficients[k_plus] - coefficients[k_minus]);
+
+                real_coefficients[k_plus] = c_plus.real();
+                imag_coefficients[k_plus] = c_plus.imag();
+                real_coefficients[k_minus] = c_minus.real();
+                imag_coefficients[k_minus] = c_minus.imag();
+            }
+        }
+    }
+
+    double *parts = reinterpret_cast<double*>(fields);
+    vec column_coefficients(n_fields * n_harmonics);
+    to_column_order(real_coefficients.data(), n_fields, column_coefficients.data());
+    write_values(column_coefficients.data(), n_fields, parts, 2 * n_quadrature_points, 2);
+    to_column_order(imag_coefficients.data(), n_fields, column_coefficients.data());
+    write_values(column_coefficients.data(), n_fields, parts + 1, 2 * n_quadrature_points, 2);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void SphericalHarmonicTransform::filter(const double *fields,
+                                        std::size_t n_fields,
+                                        const double *degree_factors,
+                                        double *filtered) const
+{
+    const std::size_t n_harmonics = n_coefficients();
+
+    // the factor of each column of the table, whose degree is
+    // floor(sqrt(spherical_harmonic_index))
+    vec column_factors(n_harmonics);
+    for (std::size_t k = 0; k < n_harmonics; ++k)
+    {
+        unsigned int l = 0;
+        while (n_spherical_harmonics(l) <= harmonic_indices[k])
+            ++l;
+        column_factors[k] = degree_factors[l];
+    }
+
+    vec column_coefficients(std::min(n_fields, filter_field_block_size) * n_harmonics);
+    for (std::size_t f = 0; f < n_fields; f += filter_field_block_size)
+    {
+        const std::size_t n_block_fields = std::min(filter_field_block_size, n_fields - f);
+
+        std::fill(column_coefficients.begin(), column_coefficients.end(), 0.0);
+        add_coefficients(fields + f * n_quadrature_points, n_block_fields, 
+                         n_quadrature_points, 1, column_coefficients.data());
+        for (std::size_t j = 0; j < n_block_fields; ++j)
+            for (std::size_t k = 0; k < n_harmonics; ++k)
+                column_coefficients[j * n_harmonics + k] *= column_factors[k];
+        write_values(column_coefficients.data(), n_block_fields, 
+                     filtered + f * n_quadrature_points, n_quadrature_points, 1);
+    }
+}
+
+} // namespace lebedev
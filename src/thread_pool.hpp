@@ -0,0 +1,153 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include "preprocessor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace lebedev {
+
+/** \brief Number of points integrated as one task by default, see `parallel_weighted_sum` */
+constexpr std::size_t default_grain_size = 512;
+
+/**
+ * \brief Fixed set of worker threads which integrals can be split across.
+ *
+ * The thread calling `run` works on the tasks too, so a pool of size `n`
+ * starts `n - 1` threads.
+ * Only one `run` uses the workers at a time: a `run` which is called while
+ * the pool is busy (including from inside a task) does its tasks itself, on
+ * the calling thread.
+ */
+class ThreadPool
+{
+public:
+    /** \brief Creates a pool which runs tasks on `n_threads` threads, including the caller */
+    explicit ThreadPool(unsigned int n_threads = std::thread::hardware_concurrency());
+
+    /** \brief Waits for the workers to finish and joins them */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /** \brief Returns number of threads which tasks run on, including the caller */
+    unsigned int size() const;
+
+    /**
+     * \brief Calls `task(i)` for each `i` from 0 to `n_tasks - 1`, spread
+     * over the threads of the pool, and returns once all have finished.
+     *
+     * If any task throws, the first exception is rethrown after the rest
+     * have finished.
+     */
+    void run(std::size_t n_tasks, const std::function<void(std::size_t)> &task);
+
+private:
+    /** \brief Loop of each worker thread */
+    void work();
+
+    /** \brief Takes tasks of the current run until there are none left */
+    void run_tasks();
+
+    /** \brief Worker threads */
+    std::vector<std::thread> workers;
+
+    /** \brief Held for the whole of a `run` which uses the workers */
+    std::mutex run_mutex;
+    /** \brief Thread holding `run_mutex`, so that it can tell a nested `run` */
+    std::atomic<std::thread::id> running_thread{std::thread::id()};
+    /** \brief Guards everything below except `next_task` */
+    std::mutex mutex;
+    /** \brief Signalled when a run starts, or the pool is destroyed */
+    std::condition_variable work_available;
+    /** \brief Signalled when the last worker has finished a run */
+    std::condition_variable work_done;
+
+    /** \brief Task of the current run */
+    const std::function<void(std::size_t)> *task = nullptr;
+    /** \brief Number of tasks of the current run */
+    std::size_t n_tasks = 0;
+    /** \brief Index of the next task to take */
+    std::atomic<std::size_t> next_task{0};
+    /** \brief Number of workers done with the current run */
+    std::size_t n_finished_workers = 0;
+    /** \brief Counts runs, so that workers can tell a new run from a spurious wakeup */
+    unsigned long generation = 0;
+    /** \brief Whether the workers should exit */
+    bool stopping = false;
+    /** \brief First exception thrown by a task of the current run */
+    std::exception_ptr exception;
+};
+
+/**
+ * \brief Returns \f$ \sum_i w_i f(x_i, y_i, z_i) \f$ with the points split
+ * into tasks of `grain_size` points, which run on `pool`.
+ *
+ * The sum of each task is kept separately and they are added in order, so
+ * the result does not depend on the number of threads or on which thread
+ * ran which task.
+ * If there is only one task (i.e. `n_points <= grain_size`) it is run on
+ * the calling thread without involving the pool, giving the same result
+ * as a sequential sum.
+ * Pick `grain_size` so that one task takes at least tens of microseconds,
+ * or dispatching tasks costs more than it saves.
+ */
+template <typename ScalarFunction>
+double parallel_weighted_sum(const ScalarFunction &integrand_at_point,
+                             const double *x,
+                             const double *y,
+                             const double *z,
+                             const double *weights,
+                             std::size_t n_points,
+                             ThreadPool &pool,
+                             std::size_t grain_size)
+{
+    if (grain_size == 0)
+        throw std::invalid_argument("Grain size must be positive");
+
+    auto sum_points = [&](std::size_t begin, std::size_t end)
+    {
+        double sum = 0;
+        for (std::size_t i = begin; i < end; ++i)
+            sum += integrand_at_point(x[i], y[i], z[i]) * weights[i];
+
+        return sum;
+    };
+
+    const std::size_t n_tasks = (n_points + grain_size - 1) / grain_size;
+    if (n_tasks <= 1 || pool.size() <= 1)
+    {
+        double sum = 0;
+        for (std::size_t begin = 0; begin < n_points; begin += grain_size)
+            sum += sum_points(begin, std::min(begin + grain_size, n_points));
+
+        return sum;
+    }
+
+    std::vector<double> task_sums(n_tasks);
+    pool.run(n_tasks, [&](std::size_t i)
+                      {
+                          const std::size_t begin = i * grain_size;
+                          task_sums[i] = sum_points(begin, std::min(begin + grain_size, n_points));
+                      });
+
+    double sum = 0;
+    for (double task_sum : task_sums)
+        sum += task_sum;
+
+    return sum;
+}
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,173 @@
+#include "preprocessor.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace lebedev {
+
+LEBEDEV_EXTERNAL_LINKAGE
+ThreadPool::ThreadPool(unsigned int n_threads)
+{
+    try
+    {
+        for (unsigned int i = 1; i < n_threads; ++i)
+            workers.emplace_back([this]() { work(); });
+    }
+    catch (...)
+    {
+        // the destructor does not run, so stop the workers which did start
+        // here, or destroying `workers` would terminate
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        work_available.notify_all();
+
+        for (std::thread &worker : workers)
+            worker.join();
+
+        throw;
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    work_available.notify_all();
+
+    for (std::thread &worker : workers)
+        worker.join();
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+unsigned int ThreadPool::size() const
+{
+    return static_cast<unsigned int>(workers.size()) + 1;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void ThreadPool::run(std::size_t n_tasks, const std::function<void(std::size_t)> &task)
+{
+    // a task on the thread which holds `run_mutex` must not lock it again,
+    // even with `try_lock`, so re-entry is found from the thread id
+    std::unique_lock<std::mutex> run_lock(run_mutex, std::defer_lock);
+    if (running_thread.load() != std::this_thread::get_id())
+        run_lock.try_lock();
+
+    if (!run_lock || workers.empty())
+    {
+        // nested or concurrent runs, and pools without workers, run the
+        // tasks here, with the same handling of exceptions as the workers
+        std::exception_ptr first_exception;
+        for (std::size_t i = 0; i < n_tasks; ++i)
+        {
+            try
+            {
+                task(i);
+            }
+            catch (...)
+            {
+                if (!first_exception)
+                    first_exception = std::current_exception();
+            }
+        }
+
+        if (first_exception)
+            std::rethrow_exception(first_exception);
+
+        return;
+    }
+
+    // cleared before `run_lock` is released, however this run ends
+    running_thread = std::this_thread::get_id();
+    struct ClearRunningThread
+    {
+        std::atomic<std::thread::id> &running_thread;
+        ~ClearRunningThread() { running_thread = std::thread::id(); }
+    } clear_running_thread{running_thread};
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->task = &task;
+        this->n_tasks = n_tasks;
+        next_task = 0;
+        n_finished_workers = 0;
+        exception = nullptr;
+        ++generation;
+    }
+    work_available.notify_all();
+
+    run_tasks();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    work_done.wait(lock, [this]() { return n_finished_workers == workers.size(); });
+    this->task = nullptr;
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void ThreadPool::work()
+{
+    unsigned long finished_generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            work_available.wait(lock, [&]() 
+                                      { 
+                                          return stopping || generation != finished_generation; 
+                                      });
+            if (stopping)
+                return;
+
+            finished_generation = generation;
+        }
+
+        run_tasks();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (++n_finished_workers == workers.size())
+            work_done.notify_one();
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void ThreadPool::run_tasks()
+{
+    while (true)
+    {
+        const std::size_t i = next_task.fetch_add(1);
+        if (i >= n_tasks)
+            return;
+
+        try
+        {
+            (*task)(i);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+}
+
+} // namespace lebedev
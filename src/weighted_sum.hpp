@@ -0,0 +1,280 @@
+#ifndef WEIGHTED_SUM_HPP
+#define WEIGHTED_SUM_HPP
+
+#include "preprocessor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+
+#ifndef LEBEDEV_SIMD
+#define LEBEDEV_SIMD 1
+#endif
+
+namespace lebedev {
+
+/**
+ * \brief Instruction sets which `weighted_sum` has kernels for.
+ *
+ * The x86 kernels are only compiled with GCC or Clang, and the NEON kernel
+ * only for 64-bit ARM.
+ * Defining `LEBEDEV_SIMD` as `0` leaves only the scalar kernel.
+ */
+enum class SimdKernel
+{
+    scalar,
+    sse2,
+    avx2,
+    avx512,
+    neon
+};
+
+/**
+ * \brief Returns \f$ \sum_i v_i w_i \f$ of `n` `values` and `weights`.
+ *
+ * Uses the fastest kernel which both this build and the CPU support, which
+ * is picked on the first call (see `get_simd_kernel`).
+ * The kernels keep several partial sums, so the result may differ from a
+ * sequential sum in the last bits.
+ */
+double weighted_sum(const double *values, const double *weights, std::size_t n);
+
+/**
+ * \brief Returns \f$ \sum_i v_i w_i \f$ computed with `kernel`, e.g. to
+ * compare kernels. Throws `std::invalid_argument` if `kernel` is not
+ * supported (see `is_simd_kernel_supported`).
+ */
+double weighted_sum(SimdKernel kernel, 
+                    const double *values, 
+                    const double *weights, 
+                    std::size_t n);
+
+/**
+ * \brief How the products in `weighted_sum` are added up, trading speed for
+ * accuracy when the terms cancel.
+ *
+ * Each policy has kernels for the x86 instruction sets in `SimdKernel`, and
+ * the compensated ones use portable kernels on other CPUs.
+ */
+enum class Summation
+{
+    /** \brief running sums, with error growing like \f$ n u \f$ */
+    naive,
+    /** \brief blocks summed in a binary tree, error growing like \f$ u \log n \f$ */
+    pairwise,
+    /** \brief running sums plus compensation for the rounding error of each
+     * addition (Kahan-Babuska-Neumaier), error about \f$ u \f$ plus the
+     * rounding of the products */
+    neumaier,
+    /** \brief products and sums both kept as unevaluated pairs of doubles,
+     * so the result is as accurate as summing in twice the precision */
+    double_double
+};
+
+/**
+ * \brief Returns \f$ \sum_i v_i w_i \f$ of `n` `values` and `weights`, added
+ * up according to `summation`, with the same kernel choice as the other
+ * overloads.
+ */
+double weighted_sum(Summation summation,
+                    const double *values, 
+                    const double *weights, 
+                    std::size_t n);
+
+/**
+ * \brief Returns \f$ \sum_i v_i w_i \f$ added up according to `summation`
+ * with the `kernel` instruction set. Throws `std::invalid_argument` if 
+ * `kernel` is not supported.
+ */
+double weighted_sum(Summation summation,
+                    SimdKernel kernel,
+                    const double *values, 
+                    const double *weights, 
+                    std::size_t n);
+
+/**
+ * \brief Returns \f$ \sum_i v_i w_i \f$ of `n` complex `values` and real
+ * `weights`.
+ *
+ * The real and imaginary parts are interleaved in the vector registers, so
+ * each lane sums only real or only imaginary parts and the weights are
+ * multiplied in as reals, rather than with complex multiplications.
+ */
+std::complex<double> complex_weighted_sum(const std::complex<double> *values, 
+                                          const double *weights, 
+                                          std::size_t n);
+
+/**
+ * \brief Returns \f$ \sum_i v_i w_i \f$ of complex `values` computed with
+ * `kernel`. Throws `std::invalid_argument` if `kernel` is not supported.
+ */
+std::complex<double> complex_weighted_sum(SimdKernel kernel,
+                                          const std::complex<double> *values, 
+                                          const double *weights, 
+                                          std::size_t n);
+
+/**
+ * \brief Returns \f$ \sum_i v_i w_i \f$ of `n` single precision `values` and
+ * `weights`, accumulated in `Sum`, which is `float` or `double`.
+ *
+ * A `float` sum handles twice as many products per instruction as a
+ * `double` one, and a `double` sum of `float` products keeps the error of
+ * the sum well below that of the products.
+ */
+template <typename Sum>
+Sum weighted_sum(const float *values, const float *weights, std::size_t n);
+
+/** \brief `float` accumulation of `weighted_sum` of floats */
+template <>
+float weighted_sum<float>(const float *values, const float *weights, std::size_t n);
+
+/** \brief `double` accumulation of `weighted_sum` of floats */
+template <>
+double weighted_sum<double>(const float *values, const float *weights, std::size_t n);
+
+/**
+ * \brief Returns \f$ \sum_i v_i w_i \f$ of single precision `values` and
+ * `weights`, accumulated in `Sum`, computed with `kernel`. Throws
+ * `std::invalid_argument` if `kernel` is not supported.
+ */
+template <typename Sum>
+Sum weighted_sum(SimdKernel kernel, const float *values, const float *weights, std::size_t n);
+
+/** \brief `float` accumulation of `weighted_sum` of floats with a chosen kernel */
+template <>
+float weighted_sum<float>(SimdKernel kernel, 
+                          const float *values, 
+                          const float *weights, 
+                          std::size_t n);
+
+/** \brief `double` accumulation of `weighted_sum` of floats with a chosen kernel */
+template <>
+double weighted_sum<double>(SimdKernel kernel, 
+                            const float *values, 
+                            const float *weights, 
+                            std::size_t n);
+
+/**
+ * \brief Writes \f$ s_k = \sum_i v_{ki} w_i \f$ for each of the `n_rows`
+ * rows of `values` (row major, with `n` values per row) to `sums`.
+ *
+ * The points are worked through in blocks which fit in L1 cache, and each
+ * block of `weights` is used for every row before moving on, so the weights
+ * are read from memory once rather than once per row.
+ */
+void weighted_sums(const double *values, 
+                   std::size_t n_rows, 
+                   const double *weights, 
+                   std::size_t n, 
+                   double *sums);
+
+/**
+ * \brief Adds \f$ \sum_i w_i v_{ik} \f$ to `sums[k]` for each of the
+ * `n_columns` columns of `values` (row major, with one row of `n_columns`
+ * values per point, for `n_points` points).
+ */
+void accumulate_weighted_points(const double *values, 
+                                std::size_t n_points, 
+                                std::size_t n_columns, 
+                                const double *weights, 
+                                double *sums);
+
+/** \brief Number of points which batched integrals handle at a time */
+constexpr std::size_t integration_block_size = 256;
+
+/**
+ * \brief Writes \f$ s_k = \sum_i w_i f_k(x_i, y_i, z_i) \f$ to `sums`, for
+ * the `n_integrands` functions whose values `integrands_at_point` writes at
+ * each point.
+ *
+ * `integrands_at_point(x, y, z, values)` is called for one block of points
+ * at a time, and writes to `block`, which must have room for
+ * `integration_block_size * n_integrands` doubles.
+ */
+template <typename MultiFunction>
+void weighted_sums_at_points(const MultiFunction &integrands_at_point,
+                             const double *x, 
+                             const double *y, 
+                             const double *z, 
+                             const double *weights,
+                             std::size_t n_points,
+                             std::size_t n_integrands,
+                             double *block,
+                             double *sums)
+{
+    for (std::size_t k = 0; k < n_integrands; ++k)
+        sums[k] = 0;
+
+    for (std::size_t start = 0; start < n_points; start += integration_block_size)
+    {
+        const std::size_t block_size = std::min(integration_block_size, n_points - start);
+        for (std::size_t i = 0; i < block_size; ++i)
+            integrands_at_point(x[start + i], y[start + i], z[start + i], 
+                                block + i * n_integrands);
+
+        accumulate_weighted_points(block, block_size, n_integrands, weights + start, sums);
+    }
+}
+
+/**
+ * \brief Has member `type` (the array type) if `T` is `std::array<double, K>`,
+ * i.e. an integrand value with `K` components, and is empty otherwise.
+ */
+template <typename T>
+struct array_integrand_result
+{};
+
+/** \brief `std::array<double, K>` specialization of `array_integrand_result` */
+template <std::size_t K>
+struct array_integrand_result<std::array<double, K>>
+{
+    using type = std::array<double, K>;
+};
+
+/**
+ * \brief Has member `type` (`std::complex<double>`) if `T` is
+ * `std::complex<double>`, i.e. a complex integrand value, and is empty
+ * otherwise.
+ */
+template <typename T>
+struct complex_integrand_result
+{};
+
+/** \brief `std::complex<double>` specialization of `complex_integrand_result` */
+template <>
+struct complex_integrand_result<std::complex<double>>
+{
+    using type = std::complex<double>;
+};
+
+/**
+ * \brief Adds `weight * values` to `sum`, component by component.
+ *
+ * `K` is known at compile time, so `sum` stays in registers across calls
+ * and the components are handled together in vector instructions.
+ */
+template <std::size_t K>
+void accumulate_weighted(std::array<double, K> &sum, 
+                         double weight, 
+                         const std::array<double, K> &values)
+{
+    for (std::size_t k = 0; k < K; ++k)
+        sum[k] += weight * values[k];
+}
+
+/** \brief Adds `weight * value` to `sum`, for scalar integrands */
+inline void accumulate_weighted(double &sum, double weight, double value)
+{
+    sum += weight * value;
+}
+
+/** \brief Returns whether this build has `kernel` and the CPU can run it */
+bool is_simd_kernel_supported(SimdKernel kernel);
+
+/** \brief Returns the kernel which `weighted_sum` uses */
+SimdKernel get_simd_kernel();
+
+} // namespace lebedev
+
+#endif
@@ -0,0 +1,1634 @@
+#include "preprocessor.hpp"
+#include "weighted_sum.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <stdexcept>
+
+#if LEBEDEV_SIMD && (defined(__x86_64__) || defined(__i386__)) \
+    && (defined(__GNUC__) || defined(__clang__))
+#define LEBEDEV_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define LEBEDEV_SIMD_X86 0
+#endif
+
+#if LEBEDEV_SIMD && defined(__aarch64__) && defined(__ARM_NEON)
+#define LEBEDEV_SIMD_NEON 1
+#include <arm_neon.h>
+#else
+#define LEBEDEV_SIMD_NEON 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LEBEDEV_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define LEBEDEV_ALWAYS_INLINE inline
+#endif
+
+namespace lebedev {
+
+/** \brief Signature shared by every `weighted_sum` kernel */
+using WeightedSumKernel = double (*)(const double*, const double*, std::size_t);
+
+// Every kernel keeps four independent accumulators, so that consecutive
+// additions do not wait on each other, and combines them at the end.
+
+LEBEDEV_INTERNAL_LINKAGE
+double weighted_sum_scalar(const double *values, const double *weights, std::size_t n)
+{
+    double sum[4] = {0, 0, 0, 0};
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        for (std::size_t j = 0; j < 4; ++j)
+            sum[j] += values[i + j] * weights[i + j];
+    for (; i < n; ++i)
+        sum[0] += values[i] * weights[i];
+
+    return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+
+
+
+#if LEBEDEV_SIMD_X86
+
+/** \brief Returns the sum of the four doubles in `sum` */
+__attribute__((target("avx")))
+LEBEDEV_ALWAYS_INLINE
+double horizontal_sum(__m256d sum)
+{
+    const __m128d half_sum = _mm_add_pd(_mm256_castpd256_pd128(sum), 
+                                        _mm256_extractf128_pd(sum, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(half_sum, _mm_unpackhi_pd(half_sum, half_sum)));
+}
+
+
+
+/**
+ * \brief Returns the sum of the low and high halves of `sum`.
+ *
+ * Unlike `_mm512_castpd512_pd256`, `_mm512_extractf64x4_pd` and the
+ * `_mm512_reduce_add` intrinsics built on them, the zero-masking extracts
+ * leave no lanes undefined, which GCC 12 warns about at `-O2`.
+ */
+__attribute__((target("avx512f")))
+LEBEDEV_ALWAYS_INLINE
+__m256d add_halves(__m512d sum)
+{
+    return _mm256_add_pd(_mm512_maskz_extractf64x4_pd(0xF, sum, 0), 
+                         _mm512_maskz_extractf64x4_pd(0xF, sum, 1));
+}
+
+
+
+__attribute__((target("sse2")))
+LEBEDEV_INTERNAL_LINKAGE
+double weighted_sum_sse2(const double *values, const double *weights, std::size_t n)
+{
+    __m128d sum_0 = _mm_setzero_pd();
+    __m128d sum_1 = _mm_setzero_pd();
+    __m128d sum_2 = _mm_setzero_pd();
+    __m128d sum_3 = _mm_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        sum_0 = _mm_add_pd(sum_0, _mm_mul_pd(_mm_loadu_pd(values + i), 
+                                             _mm_loadu_pd(weights + i)));
+        sum_1 = _mm_add_pd(sum_1, _mm_mul_pd(_mm_loadu_pd(values + i + 2), 
+                                             _mm_loadu_pd(weights + i + 2)));
+        sum_2 = _mm_add_pd(sum_2, _mm_mul_pd(_mm_loadu_pd(values + i + 4), 
+                                             _mm_loadu_pd(weights + i + 4)));
+        sum_3 = _mm_add_pd(sum_3, _mm_mul_pd(_mm_loadu_pd(values + i + 6), 
+                                             _mm_loadu_pd(weights + i + 6)));
+    }
+    for (; i + 2 <= n; i += 2)
+        sum_0 = _mm_add_pd(sum_0, _mm_mul_pd(_mm_loadu_pd(values + i), 
+                                             _mm_loadu_pd(weights + i)));
+
+    const __m128d sum = _mm_add_pd(_mm_add_pd(sum_0, sum_1), _mm_add_pd(sum_2, sum_3));
+    double result = _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+    for (; i < n; ++i)
+        result += values[i] * weights[i];
+
+    return result;
+}
+
+
+
+__attribute__((target("avx2,fma")))
+LEBEDEV_INTERNAL_LINKAGE
+double weighted_sum_avx2(const double *values, const double *weights, std::size_t n)
+{
+    __m256d sum_0 = _mm256_setzero_pd();
+    __m256d sum_1 = _mm256_setzero_pd();
+    __m256d sum_2 = _mm256_setzero_pd();
+    __m256d sum_3 = _mm256_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        sum_0 = _mm256_fmadd_pd(_mm256_loadu_pd(values + i), 
+                                _mm256_loadu_pd(weights + i), sum_0);
+        sum_1 = _mm256_fmadd_pd(_mm256_loadu_pd(values + i + 4), 
+                                _mm256_loadu_pd(weights + i + 4), sum_1);
+        sum_2 = _mm256_fmadd_pd(_mm256_loadu_pd(values + i + 8), 
+                                _mm256_loadu_pd(weights + i + 8), sum_2);
+        sum_3 = _mm256_fmadd_pd(_mm256_loadu_pd(values + i + 12), 
+                                _mm256_loadu_pd(weights + i + 12), sum_3);
+    }
+    for (; i + 4 <= n; i += 4)
+        sum_0 = _mm256_fmadd_pd(_mm256_loadu_pd(values + i), 
+                                _mm256_loadu_pd(weights + i), sum_0);
+
+    double result = horizontal_sum(_mm256_add_pd(_mm256_add_pd(sum_0, sum_1), 
+                                                 _mm256_add_pd(sum_2, sum_3)));
+    for (; i < n; ++i)
+        result += values[i] * weights[i];
+
+    return result;
+}
+
+
+
+__attribute__((target("avx512f")))
+LEBEDEV_INTERNAL_LINKAGE
+double weighted_sum_avx512(const double *values, const double *weights, std::size_t n)
+{
+    __m512d sum_0 = _mm512_setzero_pd();
+    __m512d sum_1 = _mm512_setzero_pd();
+    __m512d sum_2 = _mm512_setzero_pd();
+    __m512d sum_3 = _mm512_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        sum_0 = _mm512_fmadd_pd(_mm512_loadu_pd(values + i), 
+                                _mm512_loadu_pd(weights + i), sum_0);
+        sum_1 = _mm512_fmadd_pd(_mm512_loadu_pd(values + i + 8), 
+                                _mm512_loadu_pd(weights + i + 8), sum_1);
+        sum_2 = _mm512_fmadd_pd(_mm512_loadu_pd(values + i + 16), 
+                                _mm512_loadu_pd(weights + i + 16), sum_2);
+        sum_3 = _mm512_fmadd_pd(_mm512_loadu_pd(values + i + 24), 
+                                _mm512_loadu_pd(weights + i + 24), sum_3);
+    }
+    for (; i + 8 <= n; i += 8)
+        sum_0 = _mm512_fmadd_pd(_mm512_loadu_pd(values + i), 
+                                _mm512_loadu_pd(weights + i), sum_0);
+
+    // the masked loads read nothing past the end of the arrays
+    if (i < n)
+    {
+        const __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1);
+        sum_1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, values + i), 
+                                _mm512_maskz_loadu_pd(mask, weights + i), sum_1);
+    }
+
+    return horizontal_sum(add_halves(_mm512_add_pd(_mm512_add_pd(sum_0, sum_1), 
+                                                   _mm512_add_pd(sum_2, sum_3))));
+}
+
+#endif
+
+
+
+#if LEBEDEV_SIMD_NEON
+
+LEBEDEV_INTERNAL_LINKAGE
+double weighted_sum_neon(const double *values, const double *weights, std::size_t n)
+{
+    float64x2_t sum_0 = vdupq_n_f64(0.0);
+    float64x2_t sum_1 = vdupq_n_f64(0.0);
+    float64x2_t sum_2 = vdupq_n_f64(0.0);
+    float64x2_t sum_3 = vdupq_n_f64(0.0);
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        sum_0 = vfmaq_f64(sum_0, vld1q_f64(values + i), vld1q_f64(weights + i));
+        sum_1 = vfmaq_f64(sum_1, vld1q_f64(values + i + 2), vld1q_f64(weights + i + 2));
+        sum_2 = vfmaq_f64(sum_2, vld1q_f64(values + i + 4), vld1q_f64(weights + i + 4));
+        sum_3 = vfmaq_f64(sum_3, vld1q_f64(values + i + 6), vld1q_f64(weights + i + 6));
+    }
+    for (; i + 2 <= n; i += 2)
+        sum_0 = vfmaq_f64(sum_0, vld1q_f64(values + i), vld1q_f64(weights + i));
+
+    double result = vaddvq_f64(vaddq_f64(vaddq_f64(sum_0, sum_1), vaddq_f64(sum_2, sum_3)));
+    for (; i < n; ++i)
+        result += values[i] * weights[i];
+
+    return result;
+}
+
+#endif
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+bool is_simd_kernel_supported(SimdKernel kernel)
+{
+    switch (kernel)
+    {
+    case SimdKernel::scalar:
+        return true;
+#if LEBEDEV_SIMD_X86
+    case SimdKernel::sse2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2");
+    case SimdKernel::avx2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case SimdKernel::avx512:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f");
+#endif
+#if LEBEDEV_SIMD_NEON
+    case SimdKernel::neon:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+
+
+LEBEDEV_INTERNAL_LINKAGE
+WeightedSumKernel get_weighted_sum_kernel(SimdKernel kernel)
+{
+    if (!is_simd_kernel_supported(kernel))
+        throw std::invalid_argument("SIMD kernel not supported by this build or CPU");
+
+    switch (kernel)
+    {
+#if LEBEDEV_SIMD_X86
+    case SimdKernel::sse2:
+        return weighted_sum_sse2;
+    case SimdKernel::avx2:
+        return weighted_sum_avx2;
+    case SimdKernel::avx512:
+        return weighted_sum_avx512;
+#endif
+#if LEBEDEV_SIMD_NEON
+    case SimdKernel::neon:
+        return weighted_sum_neon;
+#endif
+    default:
+        return weighted_sum_scalar;
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+SimdKernel get_simd_kernel()
+{
+    // checked once, the first time any reduction runs
+    static const SimdKernel kernel 
+        = is_simd_kernel_supported(SimdKernel::avx512) ? SimdKernel::avx512
+        : is_simd_kernel_supported(SimdKernel::avx2)   ? SimdKernel::avx2
+        : is_simd_kernel_supported(SimdKernel::neon)   ? SimdKernel::neon
+        : is_simd_kernel_supported(SimdKernel::sse2)   ? SimdKernel::sse2
+        : SimdKernel::scalar;
+
+    return kernel;
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+double weighted_sum(const double *values, const double *weights, std::size_t n)
+{
+    static const WeightedSumKernel kernel = get_weighted_sum_kernel(get_simd_kernel());
+
+    return kernel(values, weights, n);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+double weighted_sum(SimdKernel kernel, 
+                    const double *values, 
+                    const double *weights, 
+                    std::size_t n)
+{
+    return get_weighted_sum_kernel(kernel)(values, weights, n);
+}
+
+
+
+
+// The compensated policies keep an error term beside each partial sum.
+// Each instruction set has its own kernels, as for the naive sum, with two
+// vectors of partial sums; the portable kernels keep four partial sums in
+// arrays, which the compiler may or may not vectorize.
+
+// Where the whole translation unit may use fused multiply-adds, the compiler
+// may also contract the splitting of `two_product` into them (GCC does by
+// default), so every product error is then computed with one.
+#if defined(FP_FAST_FMA) || defined(__FMA__)
+#define LEBEDEV_FAST_FMA 1
+#else
+#define LEBEDEV_FAST_FMA 0
+#endif
+
+/** \brief Whether `two_product` should use fused multiply-adds */
+constexpr bool has_fast_fma = LEBEDEV_FAST_FMA;
+
+/** \brief Number of products summed directly in each leaf of `Summation::pairwise` */
+constexpr std::size_t pairwise_block_size = 128;
+
+/** \brief Factor which splits a double into two halves of 26 bits (Dekker) */
+constexpr double dekker_split = 134217729.0; // 2^27 + 1
+
+/** \brief Sets `sum` to `a + b` rounded and `error` to its exact rounding error */
+LEBEDEV_ALWAYS_INLINE
+void two_sum(double a, double b, double &sum, double &error)
+{
+    sum = a + b;
+    const double b_rounded = sum - a;
+    error = (a - (sum - b_rounded)) + (b - b_rounded);
+}
+
+/**
+ * \brief Sets `product` to `a * b` rounded and `error` to its exact rounding
+ * error, with a fused multiply-add if `use_fma` and by splitting each factor
+ * into halves otherwise.
+ *
+ * The splitting is only used where there are no fused multiply-adds, since
+ * the compiler contracting it into them would spoil it.
+ */
+template <bool use_fma>
+LEBEDEV_ALWAYS_INLINE
+void two_product(double a, double b, double &product, double &error)
+{
+    product = a * b;
+    if (use_fma)
+    {
+        error = std::fma(a, b, -product);
+        return;
+    }
+
+    const double a_scaled = dekker_split * a;
+    const double a_high = a_scaled - (a_scaled - a);
+    const double a_low = a - a_high;
+    const double b_scaled = dekker_split * b;
+    const double b_high = b_scaled - (b_scaled - b);
+    const double b_low = b - b_high;
+    error = ((a_high * b_high - product) + a_high * b_low + a_low * b_high) + a_low * b_low;
+}
+
+/** \brief Returns the sum of `n_lanes` partial sums and their errors, compensated */
+template <std::size_t n_lanes>
+LEBEDEV_ALWAYS_INLINE
+double combine_lanes(const double *sums, const double *errors)
+{
+    double sum = sums[0];
+    double error = errors[0];
+    for (std::size_t j = 1; j < n_lanes; ++j)
+    {
+        double addition_error;
+        two_sum(sum, sums[j], sum, addition_error);
+        error += errors[j] + addition_error;
+    }
+
+    return sum + error;
+}
+
+/**
+ * \brief Returns the pairwise sum of `n` products, with the products of each
+ * leaf block summed by `block_sum`.
+ *
+ * Rather than recursing, the sums of consecutive blocks are merged like the
+ * digits of a binary counter: after block `k` the stack holds one partial
+ * sum per set bit of `k`, each covering a power of two of blocks.
+ */
+template <WeightedSumKernel block_sum>
+LEBEDEV_INTERNAL_LINKAGE
+double pairwise_sum(const double *values, const double *weights, std::size_t n)
+{
+    double stack[8 * sizeof(std::size_t)];
+    std::size_t depth = 0;
+    std::size_t n_blocks = 0;
+    for (std::size_t start = 0; start < n; start += pairwise_block_size)
+    {
+        double sum = block_sum(values + start, weights + start, 
+                               std::min(pairwise_block_size, n - start));
+        ++n_blocks;
+        for (std::size_t count = n_blocks; count % 2 == 0; count /= 2)
+            sum = stack[--depth] + sum;
+        stack[depth++] = sum;
+    }
+
+    double sum = 0;
+    while (depth > 0)
+        sum = stack[--depth] + sum;
+
+    return sum;
+}
+
+
+
+LEBEDEV_INTERNAL_LINKAGE
+double neumaier_sum_scalar(const double *values, const double *weights, std::size_t n)
+{
+    double sum[4] = {0, 0, 0, 0};
+    double error[4] = {0, 0, 0, 0};
+    double addition_error;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            two_sum(sum[j], values[i + j] * weights[i + j], sum[j], addition_error);
+            error[j] += addition_error;
+        }
+    for (; i < n; ++i)
+    {
+        two_sum(sum[0], values[i] * weights[i], sum[0], addition_error);
+        error[0] += addition_error;
+    }
+
+    return combine_lanes<4>(sum, error);
+}
+
+
+
+LEBEDEV_INTERNAL_LINKAGE
+double double_double_sum_scalar(const double *values, const double *weights, std::size_t n)
+{
+    double sum[4] = {0, 0, 0, 0};
+    double error[4] = {0, 0, 0, 0};
+    double product, product_error, addition_error;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+            two_product<has_fast_fma>(values[i + j], weights[i + j], product, product_error);
+            two_sum(sum[j], product, sum[j], addition_error);
+            error[j] += addition_error + product_error;
+        }
+    for (; i < n; ++i)
+    {
+        two_product<has_fast_fma>(values[i], weights[i], product, product_error);
+        two_sum(sum[0], product, sum[0], addition_error);
+        error[0] += addition_error + product_error;
+    }
+
+    return combine_lanes<4>(sum, error);
+}
+
+
+
+#if LEBEDEV_SIMD_X86
+
+/** \brief Adds `term` to `sum`, and the rounding error of that to `error` */
+__attribute__((target("sse2")))
+LEBEDEV_ALWAYS_INLINE
+void compensated_add(__m128d term, __m128d &sum, __m128d &error)
+{
+    const __m128d new_sum = _mm_add_pd(sum, term);
+    const __m128d term_rounded = _mm_sub_pd(new_sum, sum);
+    error = _mm_add_pd(error, _mm_add_pd(_mm_sub_pd(sum, _mm_sub_pd(new_sum, term_rounded)), 
+                                         _mm_sub_pd(term, term_rounded)));
+    sum = new_sum;
+}
+
+#if LEBEDEV_FAST_FMA
+
+/** \brief Adds `a * b` exactly to `sum` and `error`, with a fused
+ * multiply-add for the error of the product */
+__attribute__((target("sse2")))
+LEBEDEV_ALWAYS_INLINE
+void double_double_add(__m128d a, __m128d b, __m128d &sum, __m128d &error)
+{
+    const __m128d product = _mm_mul_pd(a, b);
+    const __m128d product_error = _mm_fmsub_pd(a, b, product);
+    compensated_add(product, sum, error);
+    error = _mm_add_pd(error, product_error);
+}
+
+#else
+
+/** \brief Returns the high half of each of `a`, whose low half is `a - high` */
+__attribute__((target("sse2")))
+LEBEDEV_ALWAYS_INLINE
+__m128d split_high(__m128d a)
+{
+    const __m128d a_scaled = _mm_mul_pd(_mm_set1_pd(dekker_split), a);
+    return _mm_sub_pd(a_scaled, _mm_sub_pd(a_scaled, a));
+}
+
+/** \brief Adds `a * b` exactly to `sum` and `error`, splitting the factors */
+__attribute__((target("sse2")))
+LEBEDEV_ALWAYS_INLINE
+void double_double_add(__m128d a, __m128d b, __m128d &sum, __m128d &error)
+{
+    const __m128d product = _mm_mul_pd(a, b);
+    const __m128d a_high = split_high(a);
+    const __m128d a_low = _mm_sub_pd(a, a_high);
+    const __m128d b_high = split_high(b);
+    const __m128d b_low = _mm_sub_pd(b, b_high);
+    const __m128d product_error
+        = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_sub_pd(_mm_mul_pd(a_high, b_high), product),
+                                           _mm_mul_pd(a_high, b_low)),
+                                _mm_mul_pd(a_low, b_high)),
+                     _mm_mul_pd(a_low, b_low));
+    compensated_add(product, sum, error);
+    error = _mm_add_pd(error, product_error);
+}
+
+#endif
+
+__attribute__((target("avx2,fma")))
+LEBEDEV_ALWAYS_INLINE
+void compensated_add(__m256d term, __m256d &sum, __m256d &error)
+{
+    const __m256d new_sum = _mm256_add_pd(sum, term);
+    const __m256d term_rounded = _mm256_sub_pd(new_sum, sum);
+    error = _mm256_add_pd(error, 
+                          _mm256_add_pd(_mm256_sub_pd(sum, _mm256_sub_pd(new_sum, term_rounded)), 
+                                        _mm256_sub_pd(term, term_rounded)));
+    sum = new_sum;
+}
+
+__attribute__((target("avx2,fma")))
+LEBEDEV_ALWAYS_INLINE
+void double_double_add(__m256d a, __m256d b, __m256d &sum, __m256d &error)
+{
+    const __m256d product = _mm256_mul_pd(a, b);
+    const __m256d product_error = _mm256_fmsub_pd(a, b, product);
+    compensated_add(product, sum, error);
+    error = _mm256_add_pd(error, product_error);
+}
+
+__attribute__((target("avx512f,fma")))
+LEBEDEV_ALWAYS_INLINE
+void compensated_add(__m512d term, __m512d &sum, __m512d &error)
+{
+    const __m512d new_sum = _mm512_add_pd(sum, term);
+    const __m512d term_rounded = _mm512_sub_pd(new_sum, sum);
+    error = _mm512_add_pd(error, 
+                          _mm512_add_pd(_mm512_sub_pd(sum, _mm512_sub_pd(new_sum, term_rounded)), 
+                                        _mm512_sub_pd(term, term_rounded)));
+    sum = new_sum;
+}
+
+__attribute__((target("avx512f,fma")))
+LEBEDEV_ALWAYS_INLINE
+void double_double_add(__m512d a, __m512d b, __m512d &sum, __m512d &error)
+{
+    const __m512d product = _mm512_mul_pd(a, b);
+    const __m512d product_error = _mm512_fmsub_pd(a, b, product);
+    compensated_add(product, sum, error);
+    error = _mm512_add_pd(error, product_error);
+}
+
+// The remainders which do not fill a vector are added to one more scalar
+// lane, and all of the lanes are combined with `combine_lanes`.
+
+__attribute__((target("sse2")))
+LEBEDEV_INTERNAL_LINKAGE
+double neumaier_sum_sse2(const double *values, const double *weights, std::size_t n)
+{
+    __m128d sum_0 = _mm_setzero_pd();
+    __m128d sum_1 = _mm_setzero_pd();
+    __m128d error_0 = _mm_setzero_pd();
+    __m128d error_1 = _mm_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        compensated_add(_mm_mul_pd(_mm_loadu_pd(values + i), _mm_loadu_pd(weights + i)), 
+                        sum_0, error_0);
+        compensated_add(_mm_mul_pd(_mm_loadu_pd(values + i + 2), _mm_loadu_pd(weights + i + 2)), 
+                        sum_1, error_1);
+    }
+
+    double sums[5] = {0, 0, 0, 0, 0};
+    double errors[5] = {0, 0, 0, 0, 0};
+    for (; i < n; ++i)
+    {
+        double addition_error;
+        two_sum(sums[4], values[i] * weights[i], sums[4], addition_error);
+        errors[4] += addition_error;
+    }
+    _mm_storeu_pd(sums, sum_0);
+    _mm_storeu_pd(sums + 2, sum_1);
+    _mm_storeu_pd(errors, error_0);
+    _mm_storeu_pd(errors + 2, error_1);
+
+    return combine_lanes<5>(sums, errors);
+}
+
+
+
+__attribute__((target("sse2")))
+LEBEDEV_INTERNAL_LINKAGE
+double double_double_sum_sse2(const double *values, const double *weights, std::size_t n)
+{
+    __m128d sum_0 = _mm_setzero_pd();
+    __m128d sum_1 = _mm_setzero_pd();
+    __m128d error_0 = _mm_setzero_pd();
+    __m128d error_1 = _mm_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        double_double_add(_mm_loadu_pd(values + i), _mm_loadu_pd(weights + i), sum_0, error_0);
+        double_double_add(_mm_loadu_pd(values + i + 2), _mm_loadu_pd(weights + i + 2), 
+                          sum_1, error_1);
+    }
+
+    double sums[5] = {0, 0, 0, 0, 0};
+    double errors[5] = {0, 0, 0, 0, 0};
+    for (; i < n; ++i)
+    {
+        double product, product_error, addition_error;
+        two_product<has_fast_fma>(values[i], weights[i], product, product_error);
+        two_sum(sums[4], product, sums[4], addition_error);
+        errors[4] += addition_error + product_error;
+    }
+    _mm_storeu_pd(sums, sum_0);
+    _mm_storeu_pd(sums + 2, sum_1);
+    _mm_storeu_pd(errors, error_0);
+    _mm_storeu_pd(errors + 2, error_1);
+
+    return combine_lanes<5>(sums, errors);
+}
+
+
+
+__attribute__((target("avx2,fma")))
+LEBEDEV_INTERNAL_LINKAGE
+double neumaier_sum_avx2(const double *values, const double *weights, std::size_t n)
+{
+    __m256d sum_0 = _mm256_setzero_pd();
+    __m256d sum_1 = _mm256_setzero_pd();
+    __m256d error_0 = _mm256_setzero_pd();
+    __m256d error_1 = _mm256_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        compensated_add(_mm256_mul_pd(_mm256_loadu_pd(values + i), 
+                                      _mm256_loadu_pd(weights + i)), 
+                        sum_0, error_0);
+        compensated_add(_mm256_mul_pd(_mm256_loadu_pd(values + i + 4), 
+                                      _mm256_loadu_pd(weights + i + 4)), 
+                        sum_1, error_1);
+    }
+
+    double sums[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    double errors[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    for (; i < n; ++i)
+    {
+        double addition_error;
+        two_sum(sums[8], values[i] * weights[i], sums[8], addition_error);
+        errors[8] += addition_error;
+    }
+    _mm256_storeu_pd(sums, sum_0);
+    _mm256_storeu_pd(sums + 4, sum_1);
+    _mm256_storeu_pd(errors, error_0);
+    _mm256_storeu_pd(errors + 4, error_1);
+
+    return combine_lanes<9>(sums, errors);
+}
+
+
+
+__attribute__((target("avx2,fma")))
+LEBEDEV_INTERNAL_LINKAGE
+double double_double_sum_avx2(const double *values, const double *weights, std::size_t n)
+{
+    __m256d sum_0 = _mm256_setzero_pd();
+    __m256d sum_1 = _mm256_setzero_pd();
+    __m256d error_0 = _mm256_setzero_pd();
+    __m256d error_1 = _mm256_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        double_double_add(_mm256_loadu_pd(values + i), _mm256_loadu_pd(weights + i), 
+                          sum_0, error_0);
+        double_double_add(_mm256_loadu_pd(values + i + 4), _mm256_loadu_pd(weights + i + 4), 
+                          sum_1, error_1);
+    }
+
+    double sums[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    double errors[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    for (; i < n; ++i)
+    {
+        double product, product_error, addition_error;
+        two_product<true>(values[i], weights[i], product, product_error);
+        two_sum(sums[8], product, sums[8], addition_error);
+        errors[8] += addition_error + product_error;
+    }
+    _mm256_storeu_pd(sums, sum_0);
+    _mm256_storeu_pd(sums + 4, sum_1);
+    _mm256_storeu_pd(errors, error_0);
+    _mm256_storeu_pd(errors + 4, error_1);
+
+    return combine_lanes<9>(sums, errors);
+}
+
+
+
+__attribute__((target("avx512f,fma")))
+LEBEDEV_INTERNAL_LINKAGE
+double neumaier_sum_avx512(const double *values, const double *weights, std::size_t n)
+{
+    __m512d sum_0 = _mm512_setzero_pd();
+    __m512d sum_1 = _mm512_setzero_pd();
+    __m512d error_0 = _mm512_setzero_pd();
+    __m512d error_1 = _mm512_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        compensated_add(_mm512_mul_pd(_mm512_loadu_pd(values + i), 
+                                      _mm512_loadu_pd(weights + i)), 
+                        sum_0, error_0);
+        compensated_add(_mm512_mul_pd(_mm512_loadu_pd(values + i + 8), 
+                                      _mm512_loadu_pd(weights + i + 8)), 
+                        sum_1, error_1);
+    }
+
+    double sums[17] = {};
+    double errors[17] = {};
+    for (; i < n; ++i)
+    {
+        double addition_error;
+        two_sum(sums[16], values[i] * weights[i], sums[16], addition_error);
+        errors[16] += addition_error;
+    }
+    _mm512_storeu_pd(sums, sum_0);
+    _mm512_storeu_pd(sums + 8, sum_1);
+    _mm512_storeu_pd(errors, error_0);
+    _mm512_storeu_pd(errors + 8, error_1);
+
+    return combine_lanes<17>(sums, errors);
+}
+
+
+
+__attribute__((target("avx512f,fma")))
+LEBEDEV_INTERNAL_LINKAGE
+double double_double_sum_avx512(const double *values, const double *weights, std::size_t n)
+{
+    __m512d sum_0 = _mm512_setzero_pd();
+    __m512d sum_1 = _mm512_setzero_pd();
+    __m512d error_0 = _mm512_setzero_pd();
+    __m512d error_1 = _mm512_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        double_double_add(_mm512_loadu_pd(values + i), _mm512_loadu_pd(weights + i), 
+                          sum_0, error_0);
+        double_double_add(_mm512_loadu_pd(values + i + 8), _mm512_loadu_pd(weights + i + 8), 
+                          sum_1, error_1);
+    }
+
+    double sums[17] = {};
+    double errors[17] = {};
+    for (; i < n; ++i)
+    {
+        double product, product_error, addition_error;
+        two_product<true>(values[i], weights[i], product, product_error);
+        two_sum(sums[16], product, sums[16], addition_error);
+        errors[16] += addition_error + product_error;
+    }
+    _mm512_storeu_pd(sums, sum_0);
+    _mm512_storeu_pd(sums + 8, sum_1);
+    _mm512_storeu_pd(errors, error_0);
+    _mm512_storeu_pd(errors + 8, error_1);
+
+    return combine_lanes<17>(sums, errors);
+}
+
+#endif
+
+
+
+LEBEDEV_INTERNAL_LINKAGE
+WeightedSumKernel get_summation_kernel(Summation summation, SimdKernel kernel)
+{
+    const WeightedSumKernel naive_kernel = get_weighted_sum_kernel(kernel);
+    if (summation == Summation::naive)
+        return naive_kernel;
+
+    switch (kernel)
+    {
+#if LEBEDEV_SIMD_X86
+    case SimdKernel::sse2:
+        return summation == Summation::pairwise ? pairwise_sum<weighted_sum_sse2>
+             : summation == Summation::neumaier ? neumaier_sum_sse2
+             : double_double_sum_sse2;
+    case SimdKernel::avx2:
+        return summation == Summation::pairwise ? pairwise_sum<weighted_sum_avx2>
+             : summation == Summation::neumaier ? neumaier_sum_avx2
+             : double_double_sum_avx2;
+    case SimdKernel::avx512:
+        return summation == Summation::pairwise ? pairwise_sum<weighted_sum_avx512>
+             : summation == Summation::neumaier ? neumaier_sum_avx512
+             : double_double_sum_avx512;
+#endif
+#if LEBEDEV_SIMD_NEON
+    // the portable compensated kernels, which have fused multiply-adds here
+    case SimdKernel::neon:
+        return summation == Summation::pairwise ? pairwise_sum<weighted_sum_neon>
+             : summation == Summation::neumaier ? neumaier_sum_scalar
+             : double_double_sum_scalar;
+#endif
+    default:
+        return summation == Summation::pairwise ? pairwise_sum<weighted_sum_scalar>
+             : summation == Summation::neumaier ? neumaier_sum_scalar
+             : double_double_sum_scalar;
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+double weighted_sum(Summation summation,
+                    const double *values, 
+                    const double *weights, 
+                    std::size_t n)
+{
+    static const WeightedSumKernel kernels[] 
+        = {get_summation_kernel(Summation::naive, get_simd_kernel()),
+           get_summation_kernel(Summation::pairwise, get_simd_kernel()),
+           get_summation_kernel(Summation::neumaier, get_simd_kernel()),
+           get_summation_kernel(Summation::double_double, get_simd_kernel())};
+
+    return kernels[static_cast<int>(summation)](values, weights, n);
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+double weighted_sum(Summation summation,
+                    SimdKernel kernel,
+                    const double *values, 
+                    const double *weights, 
+                    std::size_t n)
+{
+    return get_summation_kernel(summation, kernel)(values, weights, n);
+}
+
+
+// Kernels for single precision values and weights, summed either in float
+// or, since the product of two floats is exact in double, in double.
+
+/** \brief Signature of the `weighted_sum` kernels with `float` sums */
+using FloatWeightedSumKernel = float (*)(const float*, const float*, std::size_t);
+/** \brief Signature of the `weighted_sum` kernels with `double` sums of floats */
+using MixedWeightedSumKernel = double (*)(const float*, const float*, std::size_t);
+
+LEBEDEV_INTERNAL_LINKAGE
+float weighted_sum_float_scalar(const float *values, const float *weights, std::size_t n)
+{
+    float sum[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        for (std::size_t j = 0; j < 8; ++j)
+            sum[j] += values[i + j] * weights[i + j];
+    for (; i < n; ++i)
+        sum[0] += values[i] * weights[i];
+
+    return ((sum[0] + sum[1]) + (sum[2] + sum[3])) + ((sum[4] + sum[5]) + (sum[6] + sum[7]));
+}
+
+LEBEDEV_INTERNAL_LINKAGE
+double weighted_sum_mixed_scalar(const float *values, const float *weights, std::size_t n)
+{
+    double sum[4] = {0, 0, 0, 0};
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        for (std::size_t j = 0; j < 4; ++j)
+            sum[j] += static_cast<double>(values[i + j]) * weights[i + j];
+    for (; i < n; ++i)
+        sum[0] += static_cast<double>(values[i]) * weights[i];
+
+    return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+
+
+
+#if LEBEDEV_SIMD_X86
+
+/** \brief Returns the sum of the four floats in `sum` */
+__attribute__((target("sse2")))
+LEBEDEV_ALWAYS_INLINE
+float horizontal_sum(__m128 sum)
+{
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    return _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1)));
+}
+
+
+
+/** \brief Returns the sum of the eight floats in `sum` */
+__attribute__((target("avx")))
+LEBEDEV_ALWAYS_INLINE
+float horizontal_sum(__m256 sum)
+{
+    return horizontal_sum(_mm_add_ps(_mm256_castps256_ps128(sum), 
+                                     _mm256_extractf128_ps(sum, 1)));
+}
+
+
+
+/** \brief Returns the sum of the low and high halves of `sum`, split as by
+ * `add_halves` for doubles (AVX-512F has no zero-masking extract of floats) */
+__attribute__((target("avx512f")))
+LEBEDEV_ALWAYS_INLINE
+__m256 add_halves(__m512 sum)
+{
+    const __m512d bits = _mm512_castps_pd(sum);
+    return _mm256_add_ps(_mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, bits, 0)), 
+                         _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, bits, 1)));
+}
+
+
+
+/** \brief Loads eight floats as doubles, with the zero-masking conversion
+ * for the same reason as in `add_halves` */
+__attribute__((target("avx512f")))
+LEBEDEV_ALWAYS_INLINE
+__m512d load_as_doubles(const float *values)
+{
+    return _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(values));
+}
+
+__attribute__((target("sse2")))
+LEBEDEV_INTERNAL_LINKAGE
+float weighted_sum_float_sse2(const float *values, const float *weights, std::size_t n)
+{
+    __m128 sum_0 = _mm_setzero_ps();
+    __m128 sum_1 = _mm_setzero_ps();
+    __m128 sum_2 = _mm_setzero_ps();
+    __m128 sum_3 = _mm_setzero_ps();
+
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        sum_0 = _mm_add_ps(sum_0, _mm_mul_ps(_mm_loadu_ps(values + i), 
+                                             _mm_loadu_ps(weights + i)));
+        sum_1 = _mm_add_ps(sum_1, _mm_mul_ps(_mm_loadu_ps(values + i + 4), 
+                                             _mm_loadu_ps(weights + i + 4)));
+        sum_2 = _mm_add_ps(sum_2, _mm_mul_ps(_mm_loadu_ps(values + i + 8), 
+                                             _mm_loadu_ps(weights + i + 8)));
+        sum_3 = _mm_add_ps(sum_3, _mm_mul_ps(_mm_loadu_ps(values + i + 12), 
+                                             _mm_loadu_ps(weights + i + 12)));
+    }
+    for (; i + 4 <= n; i += 4)
+        sum_0 = _mm_add_ps(sum_0, _mm_mul_ps(_mm_loadu_ps(values + i), 
+                                             _mm_loadu_ps(weights + i)));
+
+    float result = horizontal_sum(_mm_add_ps(_mm_add_ps(sum_0, sum_1), _mm_add_ps(sum_2, sum_3)));
+    for (; i < n; ++i)
+        result += values[i] * weights[i];
+
+    return result;
+}
+
+__attribute__((target("sse2")))
+LEBEDEV_INTERNAL_LINKAGE
+double weighted_sum_mixed_sse2(const float *values, const float *weights, std::size_t n)
+{
+    __m128d sum_0 = _mm_setzero_pd();
+    __m128d sum_1 = _mm_setzero_pd();
+    __m128d sum_2 = _mm_setzero_pd();
+    __m128d sum_3 = _mm_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m128 values_0 = _mm_loadu_ps(values + i);
+        const __m128 weights_0 = _mm_loadu_ps(weights + i);
+        const __m128 values_1 = _mm_loadu_ps(values + i + 4);
+        const __m128 weights_1 = _mm_loadu_ps(weights + i + 4);
+        sum_0 = _mm_add_pd(sum_0, _mm_mul_pd(_mm_cvtps_pd(values_0), _mm_cvtps_pd(weights_0)));
+        sum_1 = _mm_add_pd(sum_1, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(values_0, values_0)), 
+                                             _mm_cvtps_pd(_mm_movehl_ps(weights_0, weights_0))));
+        sum_2 = _mm_add_pd(sum_2, _mm_mul_pd(_mm_cvtps_pd(values_1), _mm_cvtps_pd(weights_1)));
+        sum_3 = _mm_add_pd(sum_3, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(values_1, values_1)), 
+                                             _mm_cvtps_pd(_mm_movehl_ps(weights_1, weights_1))));
+    }
+
+    const __m128d sum = _mm_add_pd(_mm_add_pd(sum_0, sum_1), _mm_add_pd(sum_2, sum_3));
+    double result = _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+    for (; i < n; ++i)
+        result += static_cast<double>(values[i]) * weights[i];
+
+    return result;
+}
+
+
+
+__attribute__((target("avx2,fma")))
+LEBEDEV_INTERNAL_LINKAGE
+float weighted_sum_float_avx2(const float *values, const float *weights, std::size_t n)
+{
+    __m256 sum_0 = _mm256_setzero_ps();
+    __m256 sum_1 = _mm256_setzero_ps();
+    __m256 sum_2 = _mm256_setzero_ps();
+    __m256 sum_3 = _mm256_setzero_ps();
+
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        sum_0 = _mm256_fmadd_ps(_mm256_loadu_ps(values + i), 
+                                _mm256_loadu_ps(weights + i), sum_0);
+        sum_1 = _mm256_fmadd_ps(_mm256_loadu_ps(values + i + 8), 
+                                _mm256_loadu_ps(weights + i + 8), sum_1);
+        sum_2 = _mm256_fmadd_ps(_mm256_loadu_ps(values + i + 16), 
+                                _mm256_loadu_ps(weights + i + 16), sum_2);
+        sum_3 = _mm256_fmadd_ps(_mm256_loadu_ps(values + i + 24), 
+                                _mm256_loadu_ps(weights + i + 24), sum_3);
+    }
+    for (; i + 8 <= n; i += 8)
+        sum_0 = _mm256_fmadd_ps(_mm256_loadu_ps(values + i), 
+                                _mm256_loadu_ps(weights + i), sum_0);
+
+    float result = horizontal_sum(_mm256_add_ps(_mm256_add_ps(sum_0, sum_1), 
+                                                _mm256_add_ps(sum_2, sum_3)));
+    for (; i < n; ++i)
+        result += values[i] * weights[i];
+
+    return result;
+}
+
+__attribute__((target("avx2,fma")))
+LEBEDEV_INTERNAL_LINKAGE
+double weighted_sum_mixed_avx2(const float *values, const float *weights, std::size_t n)
+{
+    __m256d sum_0 = _mm256_setzero_pd();
+    __m256d sum_1 = _mm256_setzero_pd();
+    __m256d sum_2 = _mm256_setzero_pd();
+    __m256d sum_3 = _mm256_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        sum_0 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(values + i)), 
+                                _mm256_cvtps_pd(_mm_loadu_ps(weights + i)), sum_0);
+        sum_1 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(values + i + 4)), 
+                                _mm256_cvtps_pd(_mm_loadu_ps(weights + i + 4)), sum_1);
+        sum_2 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(values + i + 8)), 
+                                _mm256_cvtps_pd(_mm_loadu_ps(weights + i + 8)), sum_2);
+        sum_3 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(values + i + 12)), 
+                                _mm256_cvtps_pd(_mm_loadu_ps(weights + i + 12)), sum_3);
+    }
+    for (; i + 4 <= n; i += 4)
+        sum_0 = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm_loadu_ps(values + i)), 
+                                _mm256_cvtps_pd(_mm_loadu_ps(weights + i)), sum_0);
+
+    double result = horizontal_sum(_mm256_add_pd(_mm256_add_pd(sum_0, sum_1), 
+                                                 _mm256_add_pd(sum_2, sum_3)));
+    for (; i < n; ++i)
+        result += static_cast<double>(values[i]) * weights[i];
+
+    return result;
+}
+
+
+
+__attribute__((target("avx512f")))
+LEBEDEV_INTERNAL_LINKAGE
+float weighted_sum_float_avx512(const float *values, const float *weights, std::size_t n)
+{
+    __m512 sum_0 = _mm512_setzero_ps();
+    __m512 sum_1 = _mm512_setzero_ps();
+    __m512 sum_2 = _mm512_setzero_ps();
+    __m512 sum_3 = _mm512_setzero_ps();
+
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64)
+    {
+        sum_0 = _mm512_fmadd_ps(_mm512_loadu_ps(values + i), 
+                                _mm512_loadu_ps(weights + i), sum_0);
+        sum_1 = _mm512_fmadd_ps(_mm512_loadu_ps(values + i + 16), 
+                                _mm512_loadu_ps(weights + i + 16), sum_1);
+        sum_2 = _mm512_fmadd_ps(_mm512_loadu_ps(values + i + 32), 
+                                _mm512_loadu_ps(weights + i + 32), sum_2);
+        sum_3 = _mm512_fmadd_ps(_mm512_loadu_ps(values + i + 48), 
+                                _mm512_loadu_ps(weights + i + 48), sum_3);
+    }
+    for (; i + 16 <= n; i += 16)
+        sum_0 = _mm512_fmadd_ps(_mm512_loadu_ps(values + i), 
+                                _mm512_loadu_ps(weights + i), sum_0);
+
+    // the masked loads read nothing past the end of the arrays
+    if (i < n)
+    {
+        const __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+        sum_1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, values + i), 
+                                _mm512_maskz_loadu_ps(mask, weights + i), sum_1);
+    }
+
+    return horizontal_sum(add_halves(_mm512_add_ps(_mm512_add_ps(sum_0, sum_1), 
+                                                   _mm512_add_ps(sum_2, sum_3))));
+}
+
+__attribute__((target("avx512f")))
+LEBEDEV_INTERNAL_LINKAGE
+double weighted_sum_mixed_avx512(const float *values, const float *weights, std::size_t n)
+{
+    __m512d sum_0 = _mm512_setzero_pd();
+    __m512d sum_1 = _mm512_setzero_pd();
+    __m512d sum_2 = _mm512_setzero_pd();
+    __m512d sum_3 = _mm512_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        sum_0 = _mm512_fmadd_pd(load_as_doubles(values + i), 
+                                load_as_doubles(weights + i), sum_0);
+        sum_1 = _mm512_fmadd_pd(load_as_doubles(values + i + 8), 
+                                load_as_doubles(weights + i + 8), sum_1);
+        sum_2 = _mm512_fmadd_pd(load_as_doubles(values + i + 16), 
+                                load_as_doubles(weights + i + 16), sum_2);
+        sum_3 = _mm512_fmadd_pd(load_as_doubles(values + i + 24), 
+                                load_as_doubles(weights + i + 24), sum_3);
+    }
+    for (; i + 8 <= n; i += 8)
+        sum_0 = _mm512_fmadd_pd(load_as_doubles(values + i), 
+                                load_as_doubles(weights + i), sum_0);
+
+    double result = horizontal_sum(add_halves(_mm512_add_pd(_mm512_add_pd(sum_0, sum_1), 
+                                                            _mm512_add_pd(sum_2, sum_3))));
+    for (; i < n; ++i)
+        result += static_cast<double>(values[i]) * weights[i];
+
+    return result;
+}
+
+#endif
+
+
+
+#if LEBEDEV_SIMD_NEON
+
+LEBEDEV_INTERNAL_LINKAGE
+float weighted_sum_float_neon(const float *values, const float *weights, std::size_t n)
+{
+    float32x4_t sum_0 = vdupq_n_f32(0.0f);
+    float32x4_t sum_1 = vdupq_n_f32(0.0f);
+    float32x4_t sum_2 = vdupq_n_f32(0.0f);
+    float32x4_t sum_3 = vdupq_n_f32(0.0f);
+
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        sum_0 = vfmaq_f32(sum_0, vld1q_f32(values + i), vld1q_f32(weights + i));
+        sum_1 = vfmaq_f32(sum_1, vld1q_f32(values + i + 4), vld1q_f32(weights + i + 4));
+        sum_2 = vfmaq_f32(sum_2, vld1q_f32(values + i + 8), vld1q_f32(weights + i + 8));
+        sum_3 = vfmaq_f32(sum_3, vld1q_f32(values + i + 12), vld1q_f32(weights + i + 12));
+    }
+    for (; i + 4 <= n; i += 4)
+        sum_0 = vfmaq_f32(sum_0, vld1q_f32(values + i), vld1q_f32(weights + i));
+
+    float result = vaddvq_f32(vaddq_f32(vaddq_f32(sum_0, sum_1), vaddq_f32(sum_2, sum_3)));
+    for (; i < n; ++i)
+        result += values[i] * weights[i];
+
+    return result;
+}
+
+LEBEDEV_INTERNAL_LINKAGE
+double weighted_sum_mixed_neon(const float *values, const float *weights, std::size_t n)
+{
+    float64x2_t sum_0 = vdupq_n_f64(0.0);
+    float64x2_t sum_1 = vdupq_n_f64(0.0);
+    float64x2_t sum_2 = vdupq_n_f64(0.0);
+    float64x2_t sum_3 = vdupq_n_f64(0.0);
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const float32x4_t values_0 = vld1q_f32(values + i);
+        const float32x4_t weights_0 = vld1q_f32(weights + i);
+        const float32x4_t values_1 = vld1q_f32(values + i + 4);
+        const float32x4_t weights_1 = vld1q_f32(weights + i + 4);
+        sum_0 = vfmaq_f64(sum_0, vcvt_f64_f32(vget_low_f32(values_0)), 
+                          vcvt_f64_f32(vget_low_f32(weights_0)));
+        sum_1 = vfmaq_f64(sum_1, vcvt_high_f64_f32(values_0), vcvt_high_f64_f32(weights_0));
+        sum_2 = vfmaq_f64(sum_2, vcvt_f64_f32(vget_low_f32(values_1)), 
+                          vcvt_f64_f32(vget_low_f32(weights_1)));
+        sum_3 = vfmaq_f64(sum_3, vcvt_high_f64_f32(values_1), vcvt_high_f64_f32(weights_1));
+    }
+
+    double result = vaddvq_f64(vaddq_f64(vaddq_f64(sum_0, sum_1), vaddq_f64(sum_2, sum_3)));
+    for (; i < n; ++i)
+        result += static_cast<double>(values[i]) * weights[i];
+
+    return result;
+}
+
+#endif
+
+
+
+LEBEDEV_INTERNAL_LINKAGE
+FloatWeightedSumKernel get_float_weighted_sum_kernel(SimdKernel kernel)
+{
+    if (!is_simd_kernel_supported(kernel))
+        throw std::invalid_argument("SIMD kernel not supported by this build or CPU");
+
+    switch (kernel)
+    {
+#if LEBEDEV_SIMD_X86
+    case SimdKernel::sse2:
+        return weighted_sum_float_sse2;
+    case SimdKernel::avx2:
+        return weighted_sum_float_avx2;
+    case SimdKernel::avx512:
+        return weighted_sum_float_avx512;
+#endif
+#if LEBEDEV_SIMD_NEON
+    case SimdKernel::neon:
+        return weighted_sum_float_neon;
+#endif
+    default:
+        return weighted_sum_float_scalar;
+    }
+}
+
+
+
+LEBEDEV_INTERNAL_LINKAGE
+MixedWeightedSumKernel get_mixed_weighted_sum_kernel(SimdKernel kernel)
+{
+    if (!is_simd_kernel_supported(kernel))
+        throw std::invalid_argument("SIMD kernel not supported by this build or CPU");
+
+    switch (kernel)
+    {
+#if LEBEDEV_SIMD_X86
+    case SimdKernel::sse2:
+        return weighted_sum_mixed_sse2;
+    case SimdKernel::avx2:
+        return weighted_sum_mixed_avx2;
+    case SimdKernel::avx512:
+        return weighted_sum_mixed_avx512;
+#endif
+#if LEBEDEV_SIMD_NEON
+    case SimdKernel::neon:
+        return weighted_sum_mixed_neon;
+#endif
+    default:
+        return weighted_sum_mixed_scalar;
+    }
+}
+
+
+
+template <>
+LEBEDEV_EXTERNAL_LINKAGE
+float weighted_sum<float>(const float *values, const float *weights, std::size_t n)
+{
+    static const FloatWeightedSumKernel kernel = get_float_weighted_sum_kernel(get_simd_kernel());
+
+    return kernel(values, weights, n);
+}
+
+
+
+template <>
+LEBEDEV_EXTERNAL_LINKAGE
+double weighted_sum<double>(const float *values, const float *weights, std::size_t n)
+{
+    static const MixedWeightedSumKernel kernel = get_mixed_weighted_sum_kernel(get_simd_kernel());
+
+    return kernel(values, weights, n);
+}
+
+
+
+template <>
+LEBEDEV_EXTERNAL_LINKAGE
+float weighted_sum<float>(SimdKernel kernel, 
+                          const float *values, 
+                          const float *weights, 
+                          std::size_t n)
+{
+    return get_float_weighted_sum_kernel(kernel)(values, weights, n);
+}
+
+
+
+template <>
+LEBEDEV_EXTERNAL_LINKAGE
+double weighted_sum<double>(SimdKernel kernel, 
+                            const float *values, 
+                            const float *weights, 
+                            std::size_t n)
+{
+    return get_mixed_weighted_sum_kernel(kernel)(values, weights, n);
+}
+
+
+// Kernels for complex values, read as interleaved real and imaginary parts.
+// Each weight is duplicated across the two lanes of its value, so the even
+// lanes of the accumulators sum real parts and the odd lanes imaginary ones.
+
+/** \brief Signature of the `complex_weighted_sum` kernels, which
+ * write the real and imaginary parts of the sum to `sum` */
+using ComplexWeightedSumKernel = void (*)(const double*, const double*, std::size_t, double*);
+
+LEBEDEV_INTERNAL_LINKAGE
+void weighted_sum_complex_scalar(const double *values, 
+                                 const double *weights, 
+                                 std::size_t n, 
+                                 double *sum)
+{
+    double real_sum[2] = {0, 0};
+    double imag_sum[2] = {0, 0};
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        for (std::size_t j = 0; j < 2; ++j)
+        {
+            real_sum[j] += values[2 * (i + j)] * weights[i + j];
+            imag_sum[j] += values[2 * (i + j) + 1] * weights[i + j];
+        }
+    for (; i < n; ++i)
+    {
+        real_sum[0] += values[2 * i] * weights[i];
+        imag_sum[0] += values[2 * i + 1] * weights[i];
+    }
+
+    sum[0] = real_sum[0] + real_sum[1];
+    sum[1] = imag_sum[0] + imag_sum[1];
+}
+
+
+
+#if LEBEDEV_SIMD_X86
+
+__attribute__((target("sse2")))
+LEBEDEV_INTERNAL_LINKAGE
+void weighted_sum_complex_sse2(const double *values, 
+                               const double *weights, 
+                               std::size_t n, 
+                               double *sum)
+{
+    __m128d sum_0 = _mm_setzero_pd();
+    __m128d sum_1 = _mm_setzero_pd();
+    __m128d sum_2 = _mm_setzero_pd();
+    __m128d sum_3 = _mm_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        sum_0 = _mm_add_pd(sum_0, _mm_mul_pd(_mm_loadu_pd(values + 2 * i), 
+                                             _mm_set1_pd(weights[i])));
+        sum_1 = _mm_add_pd(sum_1, _mm_mul_pd(_mm_loadu_pd(values + 2 * i + 2), 
+                                             _mm_set1_pd(weights[i + 1])));
+        sum_2 = _mm_add_pd(sum_2, _mm_mul_pd(_mm_loadu_pd(values + 2 * i + 4), 
+                                             _mm_set1_pd(weights[i + 2])));
+        sum_3 = _mm_add_pd(sum_3, _mm_mul_pd(_mm_loadu_pd(values + 2 * i + 6), 
+                                             _mm_set1_pd(weights[i + 3])));
+    }
+    for (; i < n; ++i)
+        sum_0 = _mm_add_pd(sum_0, _mm_mul_pd(_mm_loadu_pd(values + 2 * i), 
+                                             _mm_set1_pd(weights[i])));
+
+    _mm_storeu_pd(sum, _mm_add_pd(_mm_add_pd(sum_0, sum_1), _mm_add_pd(sum_2, sum_3)));
+}
+
+
+
+/** \brief Returns weights `i` and `i + 1`, each repeated twice */
+__attribute__((target("avx2,fma")))
+LEBEDEV_ALWAYS_INLINE
+__m256d load_duplicated_weights(const double *weights)
+{
+    return _mm256_permute4x64_pd(_mm256_castpd128_pd256(_mm_loadu_pd(weights)), 0x50);
+}
+
+__attribute__((target("avx2,fma")))
+LEBEDEV_INTERNAL_LINKAGE
+void weighted_sum_complex_avx2(const double *values, 
+                               const double *weights, 
+                               std::size_t n, 
+                               double *sum)
+{
+    __m256d sum_0 = _mm256_setzero_pd();
+    __m256d sum_1 = _mm256_setzero_pd();
+    __m256d sum_2 = _mm256_setzero_pd();
+    __m256d sum_3 = _mm256_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        sum_0 = _mm256_fmadd_pd(_mm256_loadu_pd(values + 2 * i), 
+                                load_duplicated_weights(weights + i), sum_0);
+        sum_1 = _mm256_fmadd_pd(_mm256_loadu_pd(values + 2 * i + 4), 
+                                load_duplicated_weights(weights + i + 2), sum_1);
+        sum_2 = _mm256_fmadd_pd(_mm256_loadu_pd(values + 2 * i + 8), 
+                                load_duplicated_weights(weights + i + 4), sum_2);
+        sum_3 = _mm256_fmadd_pd(_mm256_loadu_pd(values + 2 * i + 12), 
+                                load_duplicated_weights(weights + i + 6), sum_3);
+    }
+    for (; i + 2 <= n; i += 2)
+        sum_0 = _mm256_fmadd_pd(_mm256_loadu_pd(values + 2 * i), 
+                                load_duplicated_weights(weights + i), sum_0);
+
+    const __m256d total = _mm256_add_pd(_mm256_add_pd(sum_0, sum_1), 
+                                        _mm256_add_pd(sum_2, sum_3));
+    __m128d result = _mm_add_pd(_mm256_castpd256_pd128(total), _mm256_extractf128_pd(total, 1));
+    if (i < n)
+        result = _mm_fmadd_pd(_mm_loadu_pd(values + 2 * i), _mm_set1_pd(weights[i]), result);
+
+    _mm_storeu_pd(sum, result);
+}
+
+
+
+/** \brief Returns weights `i` to `i + 3`, each repeated twice, using the
+ * zero-masking load and permute for the same reason as `add_halves` */
+__attribute__((target("avx512f")))
+LEBEDEV_ALWAYS_INLINE
+__m512d load_four_duplicated_weights(const double *weights)
+{
+    const __m512i duplicate = _mm512_set_epi64(3, 3, 2, 2, 1, 1, 0, 0);
+    return _mm512_maskz_permutexvar_pd(0xFF, duplicate, _mm512_maskz_loadu_pd(0x0F, weights));
+}
+
+__attribute__((target("avx512f")))
+LEBEDEV_INTERNAL_LINKAGE
+void weighted_sum_complex_avx512(const double *values, 
+                                 const double *weights, 
+                                 std::size_t n, 
+                                 double *sum)
+{
+    __m512d sum_0 = _mm512_setzero_pd();
+    __m512d sum_1 = _mm512_setzero_pd();
+    __m512d sum_2 = _mm512_setzero_pd();
+    __m512d sum_3 = _mm512_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        sum_0 = _mm512_fmadd_pd(_mm512_loadu_pd(values + 2 * i), 
+                                load_four_duplicated_weights(weights + i), sum_0);
+        sum_1 = _mm512_fmadd_pd(_mm512_loadu_pd(values + 2 * i + 8), 
+                                load_four_duplicated_weights(weights + i + 4), sum_1);
+        sum_2 = _mm512_fmadd_pd(_mm512_loadu_pd(values + 2 * i + 16), 
+                                load_four_duplicated_weights(weights + i + 8), sum_2);
+        sum_3 = _mm512_fmadd_pd(_mm512_loadu_pd(values + 2 * i + 24), 
+                                load_four_duplicated_weights(weights + i + 12), sum_3);
+    }
+    for (; i + 4 <= n; i += 4)
+        sum_0 = _mm512_fmadd_pd(_mm512_loadu_pd(values + 2 * i), 
+                                load_four_duplicated_weights(weights + i), sum_0);
+
+    // real and imaginary parts alternate, so halving twice leaves one of each
+    const __m256d total = add_halves(_mm512_add_pd(_mm512_add_pd(sum_0, sum_1), 
+                                                   _mm512_add_pd(sum_2, sum_3)));
+    _mm_storeu_pd(sum, _mm_add_pd(_mm256_castpd256_pd128(total), _mm256_extractf128_pd(total, 1)));
+    for (; i < n; ++i)
+    {
+        sum[0] += values[2 * i] * weights[i];
+        sum[1] += values[2 * i + 1] * weights[i];
+    }
+}
+
+#endif
+
+
+
+#if LEBEDEV_SIMD_NEON
+
+LEBEDEV_INTERNAL_LINKAGE
+void weighted_sum_complex_neon(const double *values, 
+                               const double *weights, 
+                               std::size_t n, 
+                               double *sum)
+{
+    float64x2_t sum_0 = vdupq_n_f64(0.0);
+    float64x2_t sum_1 = vdupq_n_f64(0.0);
+    float64x2_t sum_2 = vdupq_n_f64(0.0);
+    float64x2_t sum_3 = vdupq_n_f64(0.0);
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        sum_0 = vfmaq_n_f64(sum_0, vld1q_f64(values + 2 * i), weights[i]);
+        sum_1 = vfmaq_n_f64(sum_1, vld1q_f64(values + 2 * i + 2), weights[i + 1]);
+        sum_2 = vfmaq_n_f64(sum_2, vld1q_f64(values + 2 * i + 4), weights[i + 2]);
+        sum_3 = vfmaq_n_f64(sum_3, vld1q_f64(values + 2 * i + 6), weights[i + 3]);
+    }
+    for (; i < n; ++i)
+        sum_0 = vfmaq_n_f64(sum_0, vld1q_f64(values + 2 * i), weights[i]);
+
+    vst1q_f64(sum, vaddq_f64(vaddq_f64(sum_0, sum_1), vaddq_f64(sum_2, sum_3)));
+}
+
+#endif
+
+
+
+LEBEDEV_INTERNAL_LINKAGE
+ComplexWeightedSumKernel get_complex_weighted_sum_kernel(SimdKernel kernel)
+{
+    if (!is_simd_kernel_supported(kernel))
+        throw std::invalid_argument("SIMD kernel not supported by this build or CPU");
+
+    switch (kernel)
+    {
+#if LEBEDEV_SIMD_X86
+    case SimdKernel::sse2:
+        return weighted_sum_complex_sse2;
+    case SimdKernel::avx2:
+        return weighted_sum_complex_avx2;
+    case SimdKernel::avx512:
+        return weighted_sum_complex_avx512;
+#endif
+#if LEBEDEV_SIMD_NEON
+    case SimdKernel::neon:
+        return weighted_sum_complex_neon;
+#endif
+    default:
+        return weighted_sum_complex_scalar;
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::complex<double> complex_weighted_sum(const std::complex<double> *values, 
+                                          const double *weights, 
+                                          std::size_t n)
+{
+    static const ComplexWeightedSumKernel kernel 
+        = get_complex_weighted_sum_kernel(get_simd_kernel());
+
+    // std::complex is laid out as an array of its real and imaginary parts
+    double sum[2];
+    kernel(reinterpret_cast<const double*>(values), weights, n, sum);
+
+    return {sum[0], sum[1]};
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+std::complex<double> complex_weighted_sum(SimdKernel kernel,
+                                          const std::complex<double> *values, 
+                                          const double *weights, 
+                                          std::size_t n)
+{
+    double sum[2];
+    get_complex_weighted_sum_kernel(kernel)(reinterpret_cast<const double*>(values), 
+                                            weights, n, sum);
+
+    return {sum[0], sum[1]};
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void weighted_sums(const double *values, 
+                   std::size_t n_rows, 
+                   const double *weights, 
+                   std::size_t n, 
+                   double *sums)
+{
+    static const WeightedSumKernel kernel = get_weighted_sum_kernel(get_simd_kernel());
+
+    for (std::size_t k = 0; k < n_rows; ++k)
+        sums[k] = 0;
+
+    for (std::size_t start = 0; start < n; start += integration_block_size)
+    {
+        const std::size_t block_size = std::min(integration_block_size, n - start);
+        for (std::size_t k = 0; k < n_rows; ++k)
+            sums[k] += kernel(values + k * n + start, weights + start, block_size);
+    }
+}
+
+
+
+LEBEDEV_EXTERNAL_LINKAGE
+void accumulate_weighted_points(const double *values, 
+                                std::size_t n_points, 
+                                std::size_t n_columns, 
+                                const double *weights, 
+                                double *sums)
+{
+    // the inner loop has no dependence between iterations, so it vectorizes
+    for (std::size_t i = 0; i < n_points; ++i)
+    {
+        const double weight = weights[i];
+        const double *row = values + i * n_columns;
+        for (std::size_t k = 0; k < n_columns; ++k)
+            sums[k] += weight * row[k];
+    }
+}
+
+} // namespace lebedev
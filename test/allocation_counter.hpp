@@ -0,0 +1,33 @@
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+// Replaces the global operator new so that every heap allocation made by the
+// program is counted in `n_allocations`. Include in exactly one translation
+// unit of an executable.
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+static std::size_t n_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    ++n_allocations;
+    if (void *p = std::malloc(size))
+        return p;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#endif
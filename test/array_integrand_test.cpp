@@ -0,0 +1,69 @@
+#include "lebedev_quadrature.hpp"
+#include "quadrature_rule.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+using q_tensor = std::array<double, 5>;
+
+/** Independent components of the Q-tensor of direction (`x`, `y`, `z`), weighted by a distribution */
+q_tensor weighted_q_tensor(double x, double y, double z)
+{
+    const double distribution = std::exp(2*x + y - 0.5*z);
+    return {{distribution * (x*x - 1.0/3.0), distribution * x*y, distribution * x*z,
+             distribution * (y*y - 1.0/3.0), distribution * y*z}};
+}
+
+/** Counts mismatches between `integrals` and each component integrated on its own */
+template <typename Rule>
+unsigned int count_mismatches(const Rule &rule, const q_tensor &integrals)
+{
+    unsigned int n_mismatches = 0;
+    for (std::size_t k = 0; k < integrals.size(); ++k)
+    {
+        const double expected 
+            = rule.evaluate_spherical_integral([k](double x, double y, double z)
+                                               { return weighted_q_tensor(x, y, z)[k]; });
+        if (std::abs(integrals[k] - expected) > 1e-14 * (1 + std::abs(expected)))
+        {
+            std::cout << "Component " << k << " is " << integrals[k] 
+                      << " rather than " << expected << "\n";
+            ++n_mismatches;
+        }
+    }
+
+    return n_mismatches;
+}
+
+int main()
+{
+    constexpr auto quad_order = lebedev::QuadratureOrder::order_590;
+    const auto quad_points = lebedev::QuadraturePoints(quad_order);
+    const auto view = lebedev::QuadraturePointsView(quad_points);
+    const auto compressed = lebedev::CompressedQuadraturePoints(quad_order);
+    const lebedev::QuadratureRule<quad_order> quad_rule;
+
+    // every component from a single call per point
+    std::size_t n_calls = 0;
+    auto counted_q_tensor = [&n_calls](double x, double y, double z)
+                            {
+                                ++n_calls;
+                                return weighted_q_tensor(x, y, z);
+                            };
+
+    unsigned int n_mismatches = 0;
+    n_mismatches += count_mismatches(quad_points, quad_points.evaluate_spherical_integral(counted_q_tensor));
+    n_mismatches += count_mismatches(view, view.evaluate_spherical_integral(counted_q_tensor));
+    n_mismatches += count_mismatches(compressed, compressed.evaluate_spherical_integral(counted_q_tensor));
+    n_mismatches += count_mismatches(quad_rule, quad_rule.evaluate_spherical_integral(weighted_q_tensor));
+
+    if (n_calls != 3 * quad_points.get_weights().size())
+    {
+        std::cout << "Integrand was called " << n_calls << " times\n";
+        ++n_mismatches;
+    }
+
+    return n_mismatches == 0 ? 0 : 1;
+}
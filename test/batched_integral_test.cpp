@@ -0,0 +1,64 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+/** Integrand `k` of the batch */
+double monomial(std::size_t k, double x, double y, double z)
+{
+    return std::pow(x, k % 4) * std::pow(y, (k / 4) % 4) * std::pow(z, k / 16) + k;
+}
+
+int main()
+{
+    constexpr std::size_t n_integrands = 37;
+    int return_code = 0;
+
+    const auto quad_points = lebedev::QuadraturePoints(lebedev::QuadratureOrder::order_1202);
+    const auto view = lebedev::QuadraturePointsView(quad_points);
+    const std::size_t n_points = quad_points.get_weights().size();
+
+    // each integral on its own, as the reference
+    std::vector<double> expected(n_integrands);
+    for (std::size_t k = 0; k < n_integrands; ++k)
+        expected[k] = quad_points.evaluate_spherical_integral([k](double x, double y, double z)
+                                                              { return monomial(k, x, y, z); });
+
+    std::vector<double> values(n_integrands * n_points);
+    for (std::size_t k = 0; k < n_integrands; ++k)
+        for (std::size_t i = 0; i < n_points; ++i)
+            values[k * n_points + i] = monomial(k, quad_points.get_x()[i], 
+                                                quad_points.get_y()[i], 
+                                                quad_points.get_z()[i]);
+
+    auto integrands_at_point = [](double x, double y, double z, double *point_values)
+                               {
+                                   for (std::size_t k = 0; k < n_integrands; ++k)
+                                       point_values[k] = monomial(k, x, y, z);
+                               };
+    const lebedev::QuadraturePoints::multi_function std_function = integrands_at_point;
+
+    lebedev::IntegrationWorkspace workspace;
+    std::vector<std::vector<double>> results(5, std::vector<double>(n_integrands));
+    quad_points.evaluate_spherical_integrals(values.data(), n_integrands, results[0].data());
+    quad_points.evaluate_spherical_integrals(integrands_at_point, n_integrands, 
+                                             results[1].data(), workspace);
+    quad_points.evaluate_spherical_integrals(std_function, n_integrands, 
+                                             results[2].data(), workspace);
+    view.evaluate_spherical_integrals(values.data(), n_integrands, results[3].data());
+    view.evaluate_spherical_integrals(integrands_at_point, n_integrands, 
+                                      results[4].data(), workspace);
+
+    for (const auto &result : results)
+        for (std::size_t k = 0; k < n_integrands; ++k)
+            if (std::abs(result[k] - expected[k]) > 1e-14 * (1 + std::abs(expected[k])))
+            {
+                std::cout << "Batched integral " << k << " is " << result[k] 
+                          << " rather than " << expected[k] << "\n";
+                return_code = 1;
+            }
+
+    return return_code;
+}
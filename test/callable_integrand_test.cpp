@@ -0,0 +1,75 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+using vec = std::vector<double>;
+
+double polynomial(double x, double y, double z)
+{
+    return x*x * y*y * z*z + x*y*z + 1;
+}
+
+int main()
+{
+    int return_code = 0;
+
+    auto lambda_func = [](double x, double y, double z) { return polynomial(x, y, z); };
+    const lebedev::QuadraturePoints::scalar_function std_function = lambda_func;
+    lebedev::QuadraturePoints::scalar_function mutable_std_function = lambda_func;
+    auto vector_lambda = [](const vec& x, const vec& y, const vec& z)
+                         {
+                             vec return_vec(x.size());
+                             for (std::size_t i = 0; i < x.size(); ++i)
+                                 return_vec[i] = polynomial(x[i], y[i], z[i]);
+
+                             return return_vec;
+                         };
+    const lebedev::QuadraturePoints::vector_function vector_std_function = vector_lambda;
+
+    const auto quad_points = lebedev::QuadraturePoints(lebedev::QuadratureOrder::order_590);
+    const auto view = lebedev::QuadraturePointsView(quad_points);
+    const auto compressed = lebedev::CompressedQuadraturePoints(lebedev::QuadratureOrder::order_590);
+
+    // templates and std::function overloads add up the same terms in the same order
+    const double expected = quad_points.evaluate_spherical_integral(std_function);
+    const double values[] 
+        = {quad_points.evaluate_spherical_integral(lambda_func),
+           quad_points.evaluate_spherical_integral(polynomial),
+           quad_points.evaluate_spherical_integral(&polynomial),
+           quad_points.evaluate_spherical_integral(mutable_std_function),
+           view.evaluate_spherical_integral(lambda_func),
+           view.evaluate_spherical_integral(std_function)};
+    for (double value : values)
+        if (value != expected)
+        {
+            std::cout << "Integral " << value << " differs from " << expected << "\n";
+            return_code = 1;
+        }
+
+    // vector integrands are reduced with several partial sums, see `weighted_sum`
+    const double vector_value = quad_points.evaluate_spherical_integral(vector_lambda);
+    if (vector_value != quad_points.evaluate_spherical_integral(vector_std_function)
+        || std::abs(vector_value - expected) > 1e-14 * std::abs(expected))
+    {
+        std::cout << "Vector integral " << vector_value << " differs from " << expected << "\n";
+        return_code = 1;
+    }
+
+    if (compressed.evaluate_spherical_integral(lambda_func) 
+        != compressed.evaluate_spherical_integral(std_function))
+    {
+        std::cout << "Compressed integrals differ\n";
+        return_code = 1;
+    }
+
+    if (std::abs(expected - 4.0 * M_PI * (1.0 / 105.0 + 1.0)) > 1e-13)
+    {
+        std::cout << "Integral " << expected << " is wrong\n";
+        return_code = 1;
+    }
+
+    return return_code;
+}
@@ -0,0 +1,141 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+int main()
+{
+    int return_code = 0;
+
+    const lebedev::SimdKernel kernels[] = {lebedev::SimdKernel::scalar,
+                                           lebedev::SimdKernel::sse2,
+                                           lebedev::SimdKernel::avx2,
+                                           lebedev::SimdKernel::avx512,
+                                           lebedev::SimdKernel::neon};
+
+    // every length up to a few vectors, to exercise all of the remainder loops
+    std::vector<std::size_t> lengths = {5810};
+    for (std::size_t n = 0; n <= 40; ++n)
+        lengths.push_back(n);
+
+    for (const lebedev::SimdKernel kernel : kernels)
+    {
+        if (!lebedev::is_simd_kernel_supported(kernel))
+        {
+            try
+            {
+                lebedev::complex_weighted_sum(kernel, nullptr, nullptr, 0);
+                std::cout << "Unsupported kernel was not rejected\n";
+                return_code = 1;
+            }
+            catch (const std::invalid_argument&)
+            {}
+
+            continue;
+        }
+
+        for (const std::size_t n : lengths)
+        {
+            // one extra entry, which must not be read
+            std::vector<std::complex<double>> values(n + 1, std::complex<double>(NAN, NAN));
+            std::vector<double> weights(n + 1, NAN);
+            std::complex<double> expected = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                values[i] = std::complex<double>(std::sin(1.0 + i), std::cos(2.0 + i));
+                weights[i] = 1.0 / (1.0 + i);
+                expected += values[i] * weights[i];
+            }
+
+            const std::complex<double> sum
+                = lebedev::complex_weighted_sum(kernel, values.data(), weights.data(), n);
+            if (std::abs(sum - expected) > 1e-13 * (1 + std::abs(expected)))
+            {
+                std::cout << "Kernel " << static_cast<int>(kernel) << " gives " << sum
+                          << " for length " << n << " rather than " << expected << "\n";
+                return_code = 1;
+            }
+        }
+    }
+
+    // e^{i phi} sin(theta) x = (x + i y) x, whose real and imaginary parts
+    // integrate to 4 pi / 3 and 0, plus a part whose integral is imaginary
+    auto integrand = [](double x, double y, double z)
+    {
+        return std::complex<double>(x, y) * x + std::complex<double>(0, z * z);
+    };
+    auto integrand_at_points = [&integrand](const std::vector<double> &x,
+                                            const std::vector<double> &y,
+                                            const std::vector<double> &z)
+    {
+        std::vector<std::complex<double>> values(x.size());
+        for (std::size_t i = 0; i < x.size(); ++i)
+            values[i] = integrand(x[i], y[i], z[i]);
+
+        return values;
+    };
+    const std::complex<double> exact(4 * M_PI / 3, 4 * M_PI / 3);
+
+    for (unsigned int n = 0; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n))
+            continue;
+
+        const auto order = lebedev::get_rule_order(n);
+        const lebedev::QuadraturePoints quad_points(order);
+        const lebedev::QuadraturePointsView view(quad_points);
+        const lebedev::QuadraturePoints::complex_function function = integrand;
+        const lebedev::QuadraturePoints::complex_vector_function vector_function
+            = integrand_at_points;
+
+        std::size_t n_evaluations = 0;
+        auto counted_integrand = [&integrand, &n_evaluations](double x, double y, double z)
+        {
+            ++n_evaluations;
+            return integrand(x, y, z);
+        };
+
+        const std::complex<double> integrals[]
+            = {quad_points.evaluate_spherical_integral(counted_integrand),
+               quad_points.evaluate_spherical_integral(function),
+               quad_points.evaluate_spherical_integral(integrand_at_points),
+               quad_points.evaluate_spherical_integral(vector_function),
+               view.evaluate_spherical_integral(integrand),
+               view.evaluate_spherical_integral(function)};
+
+        for (const std::complex<double> &integral : integrals)
+            if (std::abs(integral - exact) > 1e-13 * std::abs(exact))
+            {
+                std::cout << "Order " << static_cast<unsigned int>(order) << " gives "
+                          << integral << " rather than " << exact << "\n";
+                return_code = 1;
+            }
+
+        if (n_evaluations != quad_points.get_weights().size())
+        {
+            std::cout << "Order " << static_cast<unsigned int>(order) << " evaluates "
+                      << n_evaluations << " points rather than one per point\n";
+            return_code = 1;
+        }
+
+        // the real and imaginary parts on their own must give the same as
+        // two real integrals
+        const double real_integral = quad_points.evaluate_spherical_integral(
+            [&integrand](double x, double y, double z) { return integrand(x, y, z).real(); });
+        const double imag_integral = quad_points.evaluate_spherical_integral(
+            [&integrand](double x, double y, double z) { return integrand(x, y, z).imag(); });
+        if (std::abs(integrals[0].real() - real_integral) > 1e-14
+            || std::abs(integrals[0].imag() - imag_integral) > 1e-14)
+        {
+            std::cout << "Order " << static_cast<unsigned int>(order)
+                      << " does not match the integrals of the real and imaginary parts\n";
+            return_code = 1;
+        }
+    }
+
+    return return_code;
+}
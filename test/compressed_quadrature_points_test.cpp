@@ -0,0 +1,75 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+/** Checks that `compressed` visits exactly the points of `quad_points`, in the same order */
+bool visits_same_points(const lebedev::CompressedQuadraturePoints &compressed,
+                        const lebedev::QuadraturePoints &quad_points)
+{
+    std::vector<double> x, y, z;
+    compressed.evaluate_spherical_integral([&](double x_i, double y_i, double z_i)
+                                           {
+                                               x.push_back(x_i);
+                                               y.push_back(y_i);
+                                               z.push_back(z_i);
+                                               return 0.0;
+                                           });
+
+    return x == quad_points.get_x() && y == quad_points.get_y() && z == quad_points.get_z();
+}
+
+
+
+int main()
+{
+    auto integrand = [](double x, double y, double z) { return std::exp(x + 2*y - z) + x*x*y*y*z*z; };
+
+    unsigned int n_mismatches = 0;
+    for (unsigned int rule_number = 0; rule_number < lebedev::number_of_rules; ++rule_number)
+    {
+        if (!lebedev::get_rule_availability(rule_number))
+            continue;
+
+        const auto order = lebedev::get_rule_order(rule_number);
+        const auto quad_points = lebedev::QuadraturePoints(order);
+        const auto compressed = lebedev::CompressedQuadraturePoints(order);
+
+        const double expected = quad_points.evaluate_spherical_integral(integrand);
+        const double value = compressed.evaluate_spherical_integral(integrand);
+        if (compressed.size() != quad_points.get_weights().size()
+            || std::abs(value - expected) > 1e-13 * std::abs(expected)
+            || !visits_same_points(compressed, quad_points))
+        {
+            std::cout << "Compressed rule of order " << static_cast<unsigned int>(order)
+                      << " does not match\n";
+            ++n_mismatches;
+        }
+    }
+
+    const auto largest = lebedev::CompressedQuadraturePoints(lebedev::QuadratureOrder::order_5810);
+    const auto largest_expanded = lebedev::QuadraturePoints(lebedev::QuadratureOrder::order_5810);
+    if (20 * largest.memory_usage() > largest_expanded.memory_usage())
+    {
+        std::cout << "Compressed rule uses " << largest.memory_usage() << " bytes\n";
+        ++n_mismatches;
+    }
+
+    const auto from_generators = lebedev::CompressedQuadraturePoints(largest.get_generator_points());
+    if (from_generators.size() != 5810)
+        ++n_mismatches;
+
+    try
+    {
+        lebedev::CompressedQuadraturePoints(lebedev::QuadratureOrder::order_386);
+        std::cout << "Unavailable order was not rejected\n";
+        ++n_mismatches;
+    }
+    catch (const std::invalid_argument&)
+    {}
+
+    return n_mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+#include "lebedev_quadrature.hpp"
+
+#include <clocale>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/** Counts rules of the table which differ from the ones generated by `QuadraturePoints` */
+std::size_t count_mismatched_rules(const std::vector<lebedev::RulePackEntry> &rules)
+{
+    std::size_t n_mismatches = 0;
+    for (const auto &rule : rules)
+    {
+        const auto table_points = lebedev::QuadraturePoints(rule.generator_points);
+        const auto n_points = static_cast<unsigned int>(table_points.get_weights().size());
+        const auto order = lebedev::get_order_enum(n_points);
+        const auto quad_points = lebedev::QuadraturePoints(order);
+
+        bool matches = rule.precision == lebedev::get_rule_descriptor(order).precision;
+        // the compiled-in tables may be off in the last bit, see `parse_generator_table`
+        for (std::size_t i = 0; matches && i < quad_points.get_weights().size(); ++i)
+            matches = std::abs(table_points.get_x()[i] - quad_points.get_x()[i]) < 1e-14
+                      && std::abs(table_points.get_y()[i] - quad_points.get_y()[i]) < 1e-14
+                      && std::abs(table_points.get_z()[i] - quad_points.get_z()[i]) < 1e-14
+                      && std::abs(table_points.get_weights()[i] - quad_points.get_weights()[i]) 
+                         < 1e-15 * std::abs(quad_points.get_weights()[i]);
+
+        if (!matches)
+            ++n_mismatches;
+    }
+
+    return n_mismatches;
+}
+
+
+
+/** Checks that parsing `text` is rejected */
+bool is_rejected(const std::string &text)
+{
+    try
+    {
+        lebedev::parse_generator_table(text);
+    }
+    catch (const std::invalid_argument&)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+
+
+int main()
+{
+    const std::string filename = std::string(LEBEDEV_DATA_DIR) + "/lebedev_quadrature_table.csv";
+    const auto rules = lebedev::read_generator_table(filename);
+    const std::size_t n_mismatches = count_mismatched_rules(rules);
+    std::cout << "Rules in table: " << rules.size() << "\n";
+    std::cout << "Rules differing from QuadraturePoints: " << n_mismatches << "\n";
+
+    const auto generator_points 
+        = lebedev::read_generator_points(filename, lebedev::QuadratureOrder::order_590);
+    const bool found_order = lebedev::QuadraturePoints(generator_points).get_x().size() == 590;
+
+    // windows line endings, no header, and blank lines
+    const auto parsed = lebedev::parse_generator_table("0.6666666666666667e-1,1,14,,\r\n"
+                                                       "\r\n"
+                                                       "0.7500000000000000e-1,3,14,,\r\n");
+    const bool parsed_rule = parsed.size() == 1 && parsed[0].generator_points.size() == 2
+                             && parsed[0].precision == 5;
+
+    // an order which is not a QuadratureOrder, whose precision is unknown
+    const auto new_order = lebedev::parse_generator_table("0.02,1,54,,\n"
+                                                          "0.0183333333333333,6,54,0.3,0.4\n");
+    const bool parsed_new_order = new_order.size() == 1 && new_order[0].precision == 0
+                                  && new_order[0].generator_points.size() == 2;
+
+    const bool rejected = is_rejected("0.1666666666666667,7,6,,\n")
+                          && is_rejected("0.1666666666666667,1,6\n")
+                          && is_rejected("0.1666666666666667,1,6,,,\n")
+                          && is_rejected("0.01,4,6,,\n")
+                          && is_rejected("0.01,5,24,1.5,\n")
+                          && is_rejected("0.1666666666666667,1,14,,\n")
+                          && is_rejected("0.1666666666666667,nan,6,,\n")
+                          && is_rejected("0.1666666666666667,-1,6,,\n")
+                          && is_rejected("0.1666666666666667,1e300,6,,\n")
+                          && is_rejected("0.1666666666666667,1,inf,,\n")
+                          && is_rejected("0.1666666666666667,1,-6,,\n")
+                          && is_rejected("0.1666666666666667,1,1e300,,\n");
+    std::cout << "Malformed tables rejected: " << rejected << "\n";
+    std::cout << "Order outside the library parsed: " << parsed_new_order << "\n";
+
+    // numbers keep their decimal point under a decimal comma locale, where installed
+    bool parsed_in_locale = true;
+    for (const char *locale_name : {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8"})
+        if (std::setlocale(LC_NUMERIC, locale_name))
+        {
+            const auto localized = lebedev::parse_generator_table("0.6666666666666667e-1,1,14,,\n"
+                                                                  "0.75e-1,3,14,,\n");
+            parsed_in_locale = localized[0].generator_points[1].get_weight() == 0.075;
+            std::setlocale(LC_NUMERIC, "C");
+            break;
+        }
+    std::cout << "Numbers parsed under a decimal comma locale: " << parsed_in_locale << "\n";
+
+    return (n_mismatches == 0 && rules.size() == 32 && found_order && parsed_rule 
+            && parsed_new_order && rejected && parsed_in_locale) 
+           ? 0 : 1;
+}
@@ -0,0 +1,177 @@
+#include "lebedev_quadrature.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+int main()
+{
+    int return_code = 0;
+
+    // degree 12 has two invariants, (x^4 + y^4 + z^4)^3 and (x^2 y^2 z^2)^2
+    const unsigned int expected_dimensions[] = {1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 2};
+    for (unsigned int l = 0; l <= 12; ++l)
+        if (lebedev::n_cubic_harmonics_of_degree(l) != expected_dimensions[l])
+        {
+            std::cout << "Degree " << l << " has " << lebedev::n_cubic_harmonics_of_degree(l)
+                      << " cubic harmonics\n";
+            return_code = 1;
+        }
+
+    // an invariant field of degree 10
+    auto field = [](double x, double y, double z)
+    {
+        const double x2 = x * x, y2 = y * y, z2 = z * z;
+        return 1 + x2 * x2 + y2 * y2 + z2 * z2 - 3 * x2 * y2 * z2
+               + x2 * x2 * x2 * x2 * x2 + y2 * y2 * y2 * y2 * y2 + z2 * z2 * z2 * z2 * z2;
+    };
+
+    const lebedev::QuadratureOrder orders[] = {lebedev::QuadratureOrder::order_170,
+                                               lebedev::QuadratureOrder::order_974,
+                                               lebedev::QuadratureOrder::order_5810};
+    const unsigned int l_maxes[] = {10, 24, 65};
+    for (std::size_t r = 0; r < 3; ++r)
+    {
+        const unsigned int l_max = l_maxes[r];
+        const lebedev::QuadraturePoints quad_points(orders[r]);
+        const lebedev::CubicHarmonicTransform cubic(orders[r], l_max);
+        const lebedev::SphericalHarmonicTransform transform(quad_points, l_max);
+        const std::size_t n_cubic = cubic.n_coefficients();
+        const std::size_t n_harmonics = transform.n_coefficients();
+
+        unsigned int expected_n_cubic = 0;
+        for (unsigned int l = 0; l <= l_max; ++l)
+            expected_n_cubic += lebedev::n_cubic_harmonics_of_degree(l);
+        if (n_cubic != expected_n_cubic
+            || cubic.n_generators() != cubic.get_generator_points().size())
+        {
+            std::cout << "Order " << static_cast<unsigned int>(orders[r]) << " has " << n_cubic
+                      << " cubic harmonics\n";
+            return_code = 1;
+        }
+
+        // the cubic harmonics are orthonormal, invariant, and ordered by degree
+        std::vector<double> identity(n_cubic * n_cubic, 0.0);
+        for (std::size_t k = 0; k < n_cubic; ++k)
+            identity[k * n_cubic + k] = 1;
+        std::vector<double> expansions(n_cubic * n_harmonics);
+        cubic.to_spherical_harmonics(identity.data(), n_cubic, expansions.data());
+
+        std::vector<double> harmonics(n_harmonics);
+        const double points[2][3] = {{0.48, 0.6, 0.64}, {-0.6, 0.64, -0.48}};
+        std::vector<double> point_values[2];
+        for (std::size_t i = 0; i < 2; ++i)
+        {
+            lebedev::real_spherical_harmonics(points[i][0], points[i][1], points[i][2], l_max,
+                                              harmonics.data());
+            for (std::size_t k = 0; k < n_cubic; ++k)
+                point_values[i].push_back(lebedev::weighted_sum(expansions.data() + k * n_harmonics,
+                                                                harmonics.data(), n_harmonics));
+        }
+
+        for (std::size_t j = 0; j < n_cubic; ++j)
+        {
+            for (std::size_t k = 0; k < n_cubic; ++k)
+            {
+                const double product = lebedev::weighted_sum(expansions.data() + j * n_harmonics,
+                                                             expansions.data() + k * n_harmonics,
+                                                             n_harmonics);
+                if (std::abs(product - (j == k ? 1 : 0)) > 1e-12)
+                {
+                    std::cout << "Cubic harmonics " << j << " and " << k << " have product "
+                              << product << "\n";
+                    return_code = 1;
+                }
+            }
+
+            if (std::abs(point_values[0][j] - point_values[1][j]) > 1e-12
+                || (j > 0 && cubic.get_degree(j) < cubic.get_degree(j - 1))
+                || cubic.get_degree(j) % 2 != 0)
+            {
+                std::cout << "Cubic harmonic " << j << " of degree " << cubic.get_degree(j)
+                          << " is not invariant\n";
+                return_code = 1;
+            }
+        }
+
+        // projecting once per orbit gives the coefficients of the full transform
+        std::vector<double> cubic_coefficients(n_cubic);
+        cubic.project(field, cubic_coefficients.data());
+        std::vector<double> coefficients(n_harmonics);
+        cubic.to_spherical_harmonics(cubic_coefficients.data(), 1, coefficients.data());
+
+        std::vector<double> values(quad_points.get_weights().size());
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = field(quad_points.get_x()[i], quad_points.get_y()[i],
+                              quad_points.get_z()[i]);
+        std::vector<double> expected(n_harmonics);
+        transform.analyze(values.data(), 1, expected.data());
+
+        double largest_error = 0;
+        for (std::size_t k = 0; k < n_harmonics; ++k)
+            largest_error = std::max(largest_error, std::abs(coefficients[k] - expected[k]));
+
+        std::vector<double> round_trip(n_cubic);
+        cubic.from_spherical_harmonics(expected.data(), 1, round_trip.data());
+        for (std::size_t k = 0; k < n_cubic; ++k)
+            largest_error = std::max(largest_error,
+                                     std::abs(round_trip[k] - cubic_coefficients[k]));
+
+        // and synthesis gives back the field at the first point of each orbit
+        std::vector<double> orbit_values(cubic.n_generators());
+        cubic.synthesize(cubic_coefficients.data(), 1, orbit_values.data());
+        for (std::size_t j = 0; j < cubic.n_generators(); ++j)
+        {
+            const lebedev::GeneratorPoint &generator_point = cubic.get_generator_points()[j];
+            largest_error = std::max(largest_error,
+                                     std::abs(orbit_values[j] - field(generator_point.get_x(0),
+                                                                      generator_point.get_y(0),
+                                                                      generator_point.get_z(0))));
+        }
+
+        if (largest_error > 1e-11)
+        {
+            std::cout << "Cubic transform of order " << static_cast<unsigned int>(orders[r])
+                      << " is off by " << largest_error << "\n";
+            return_code = 1;
+        }
+
+        // a batch of fields gives the same coefficients as one at a time
+        std::vector<double> batch_values(2 * cubic.n_generators());
+        for (std::size_t j = 0; j < cubic.n_generators(); ++j)
+        {
+            batch_values[j] = 2 * orbit_values[j];
+            batch_values[cubic.n_generators() + j] = orbit_values[j];
+        }
+        std::vector<double> batch_coefficients(2 * n_cubic);
+        cubic.analyze(batch_values.data(), 2, batch_coefficients.data());
+        for (std::size_t k = 0; k < n_cubic; ++k)
+            if (std::abs(batch_coefficients[k] - 2 * cubic_coefficients[k]) > 1e-11
+                || std::abs(batch_coefficients[n_cubic + k] - cubic_coefficients[k]) > 1e-11)
+            {
+                std::cout << "Batched cubic analysis of order "
+                          << static_cast<unsigned int>(orders[r]) << " does not match\n";
+                return_code = 1;
+                break;
+            }
+    }
+
+#if LEBEDEV_CHECK_SYMMETRY
+    try
+    {
+        const lebedev::CubicHarmonicTransform cubic(lebedev::QuadratureOrder::order_110, 10);
+        std::vector<double> coefficients(cubic.n_coefficients());
+        cubic.project([](double x, double y, double z) { return x + y * z; },
+                      coefficients.data());
+        std::cout << "Field without octahedral symmetry was not caught\n";
+        return_code = 1;
+    }
+    catch (const std::invalid_argument&)
+    {}
+#endif
+
+    return return_code;
+}
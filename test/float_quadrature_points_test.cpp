@@ -0,0 +1,126 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+int main()
+{
+    int return_code = 0;
+
+    const lebedev::SimdKernel kernels[] = {lebedev::SimdKernel::scalar,
+                                           lebedev::SimdKernel::sse2,
+                                           lebedev::SimdKernel::avx2,
+                                           lebedev::SimdKernel::avx512,
+                                           lebedev::SimdKernel::neon};
+
+    // every length up to a few vectors, to exercise all of the remainder loops
+    std::vector<std::size_t> lengths = {5810};
+    for (std::size_t n = 0; n <= 140; ++n)
+        lengths.push_back(n);
+
+    for (const lebedev::SimdKernel kernel : kernels)
+    {
+        if (!lebedev::is_simd_kernel_supported(kernel))
+        {
+            try
+            {
+                lebedev::weighted_sum<float>(kernel, nullptr, nullptr, 0);
+                std::cout << "Unsupported kernel was not rejected\n";
+                return_code = 1;
+            }
+            catch (const std::invalid_argument&)
+            {}
+
+            continue;
+        }
+
+        for (const std::size_t n : lengths)
+        {
+            // one extra entry, which must not be read
+            std::vector<float> values(n + 1, NAN);
+            std::vector<float> weights(n + 1, NAN);
+            double expected = 0;
+            double magnitude = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                values[i] = static_cast<float>(std::sin(1.0 + i));
+                weights[i] = static_cast<float>(1.0 / (1.0 + i));
+                expected += static_cast<double>(values[i]) * weights[i];
+                magnitude += std::abs(static_cast<double>(values[i]) * weights[i]);
+            }
+
+            const float float_sum
+                = lebedev::weighted_sum<float>(kernel, values.data(), weights.data(), n);
+            const double double_sum
+                = lebedev::weighted_sum<double>(kernel, values.data(), weights.data(), n);
+            if (std::abs(float_sum - expected) > 1e-6 * (1 + magnitude)
+                || std::abs(double_sum - expected) > 1e-14 * (1 + magnitude))
+            {
+                std::cout << "Kernel " << static_cast<int>(kernel) << " gives " << float_sum
+                          << " and " << double_sum << " for length " << n << " rather than "
+                          << expected << "\n";
+                return_code = 1;
+            }
+        }
+    }
+
+    // x^2 y^2 z^2 integrates to 4 pi / 105 on every rule of precision 7 or more
+    const double exact = 4 * M_PI / 105;
+    auto integrand = [](float x, float y, float z) { return x * x * y * y * z * z; };
+    auto integrand_at_points = [](const float *x, const float *y, const float *z,
+                                  std::size_t n, float *values)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            values[i] = x[i] * x[i] * y[i] * y[i] * z[i] * z[i];
+    };
+
+    for (unsigned int n = 2; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n))
+            continue;
+
+        const auto order = lebedev::get_rule_order(n);
+        const lebedev::QuadraturePoints quad_points(order);
+        const lebedev::FloatQuadraturePoints<float> float_rule(order);
+        const lebedev::FloatQuadraturePoints<> mixed_rule(quad_points);
+        std::vector<float> values(float_rule.size());
+
+        const double float_integrals[]
+            = {float_rule.evaluate_spherical_integral(integrand),
+               float_rule.evaluate_spherical_integral(integrand_at_points, values.data())};
+        const double mixed_integrals[]
+            = {mixed_rule.evaluate_spherical_integral(integrand),
+               mixed_rule.evaluate_spherical_integral(integrand_at_points, values.data()),
+               float_rule.evaluate_spherical_integral<double>(integrand),
+               float_rule.evaluate_spherical_integral<double>(integrand_at_points, values.data())};
+
+        for (const double integral : float_integrals)
+            if (std::abs(integral - exact) > 2e-5 * exact)
+            {
+                std::cout << "Float sum of order " << static_cast<unsigned int>(order)
+                          << " gives " << integral << " rather than " << exact << "\n";
+                return_code = 1;
+            }
+        for (const double integral : mixed_integrals)
+            if (std::abs(integral - exact) > 2e-6 * exact)
+            {
+                std::cout << "Double sum of order " << static_cast<unsigned int>(order)
+                          << " gives " << integral << " rather than " << exact << "\n";
+                return_code = 1;
+            }
+
+        // half the bytes of the double precision points and weights
+        if (2 * (mixed_rule.memory_usage() - sizeof(mixed_rule))
+            != quad_points.memory_usage() - sizeof(quad_points))
+        {
+            std::cout << "Float rule of order " << static_cast<unsigned int>(order)
+                      << " takes " << mixed_rule.memory_usage() << " bytes\n";
+            return_code = 1;
+        }
+    }
+
+    return return_code;
+}
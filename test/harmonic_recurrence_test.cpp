@@ -0,0 +1,128 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+int main()
+{
+    int return_code = 0;
+
+    // odd numbers of pairs and fields exercise the padded lanes and the
+    // fields left over from groups of four
+    const lebedev::QuadratureOrder orders[] = {lebedev::QuadratureOrder::order_6,
+                                               lebedev::QuadratureOrder::order_110,
+                                               lebedev::QuadratureOrder::order_974};
+    const unsigned int l_maxes[] = {1, 8, 30};
+
+    for (std::size_t r = 0; r < 3; ++r)
+    {
+        const lebedev::QuadraturePoints quad_points(orders[r]);
+        const lebedev::SphericalHarmonicTransform table(quad_points, l_maxes[r]);
+        const lebedev::SphericalHarmonicTransform recurrence(quad_points, l_maxes[r],
+                                                             lebedev::HarmonicStorage::recurrence);
+        const std::size_t n_points = table.n_points();
+        const std::size_t n_coefficients = table.n_coefficients();
+
+        if (recurrence.get_storage() != lebedev::HarmonicStorage::recurrence
+            || recurrence.memory_usage() > 16 * sizeof(double) * n_points + 256 * n_coefficients)
+        {
+            std::cout << "Recurrence transform of order " << n_points << " takes "
+                      << recurrence.memory_usage() << " bytes\n";
+            return_code = 1;
+        }
+
+        const std::size_t n_fields = 7;
+        std::vector<double> fields(n_fields * n_points);
+        for (std::size_t f = 0; f < n_fields; ++f)
+            for (std::size_t i = 0; i < n_points; ++i)
+                fields[f * n_points + i] = std::exp((1.0 + f) * quad_points.get_x()[i]
+                                                    * quad_points.get_z()[i])
+                                           + quad_points.get_y()[i];
+
+        std::vector<double> table_coefficients(n_fields * n_coefficients);
+        std::vector<double> recurrence_coefficients(n_fields * n_coefficients);
+        table.analyze(fields.data(), n_fields, table_coefficients.data());
+        recurrence.analyze(fields.data(), n_fields, recurrence_coefficients.data());
+
+        std::vector<double> table_values(fields.size());
+        std::vector<double> recurrence_values(fields.size());
+        table.synthesize(table_coefficients.data(), n_fields, table_values.data());
+        recurrence.synthesize(table_coefficients.data(), n_fields, recurrence_values.data());
+
+        std::vector<double> degree_factors(l_maxes[r] + 1);
+        for (unsigned int l = 0; l <= l_maxes[r]; ++l)
+            degree_factors[l] = 1.0 / (1.0 + l);
+        std::vector<double> table_filtered(fields.size());
+        std::vector<double> recurrence_filtered(fields.size());
+        table.filter(fields.data(), n_fields, degree_factors.data(), table_filtered.data());
+        recurrence.filter(fields.data(), n_fields, degree_factors.data(),
+                          recurrence_filtered.data());
+
+        for (std::size_t k = 0; k < table_coefficients.size(); ++k)
+            if (std::abs(recurrence_coefficients[k] - table_coefficients[k]) > 1e-12)
+            {
+                std::cout << "Order " << n_points << " gives coefficient " << k << " as "
+                          << recurrence_coefficients[k] << " rather than "
+                          << table_coefficients[k] << "\n";
+                return_code = 1;
+                break;
+            }
+        for (std::size_t i = 0; i < fields.size(); ++i)
+            if (std::abs(recurrence_values[i] - table_values[i]) > 1e-12
+                || std::abs(recurrence_filtered[i] - table_filtered[i]) > 1e-12)
+            {
+                std::cout << "Order " << n_points << " gives value " << i << " as "
+                          << recurrence_values[i] << " and " << recurrence_filtered[i]
+                          << " filtered, rather than " << table_values[i] << " and "
+                          << table_filtered[i] << "\n";
+                return_code = 1;
+                break;
+            }
+
+        // complex transforms go through the same real ones
+        std::vector<std::complex<double>> complex_fields(n_fields * n_points);
+        for (std::size_t i = 0; i < complex_fields.size(); ++i)
+            complex_fields[i] = std::complex<double>(fields[i], table_values[i]);
+
+        std::vector<std::complex<double>> table_complex(n_fields * n_coefficients);
+        std::vector<std::complex<double>> recurrence_complex(n_fields * n_coefficients);
+        table.analyze(complex_fields.data(), n_fields, table_complex.data());
+        recurrence.analyze(complex_fields.data(), n_fields, recurrence_complex.data());
+        for (std::size_t k = 0; k < table_complex.size(); ++k)
+            if (std::abs(recurrence_complex[k] - table_complex[k]) > 1e-12)
+            {
+                std::cout << "Order " << n_points << " gives complex coefficient " << k
+                          << " as " << recurrence_complex[k] << " rather than "
+                          << table_complex[k] << "\n";
+                return_code = 1;
+                break;
+            }
+
+        std::vector<std::complex<double>> table_complex_values(complex_fields.size());
+        std::vector<std::complex<double>> recurrence_complex_values(complex_fields.size());
+        table.synthesize(table_complex.data(), n_fields, table_complex_values.data());
+        recurrence.synthesize(table_complex.data(), n_fields, recurrence_complex_values.data());
+        for (std::size_t i = 0; i < complex_fields.size(); ++i)
+            if (std::abs(recurrence_complex_values[i] - table_complex_values[i]) > 1e-12)
+            {
+                std::cout << "Order " << n_points << " gives complex value " << i << " as "
+                          << recurrence_complex_values[i] << " rather than "
+                          << table_complex_values[i] << "\n";
+                return_code = 1;
+                break;
+            }
+    }
+
+    if (lebedev::SphericalHarmonicTransform::shared(lebedev::QuadratureOrder::order_110, 8)
+        == lebedev::SphericalHarmonicTransform::shared(lebedev::QuadratureOrder::order_110, 8,
+                                                       lebedev::HarmonicStorage::recurrence))
+    {
+        std::cout << "Shared transforms with different storage are the same\n";
+        return_code = 1;
+    }
+
+    return return_code;
+}
@@ -0,0 +1,124 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+
+int main()
+{
+    int return_code = 0;
+
+    // invariant under the octahedral group
+    auto cubic = [](double x, double y, double z)
+    {
+        return x * x * x * x + y * y * y * y + z * z * z * z + std::exp(x * x * y * y * z * z);
+    };
+    // even in each coordinate, but not invariant under permutations
+    auto even = [](double x, double y, double z)
+    {
+        return x * x + 2 * y * y * y * y + 3 * z * z * z * z * z * z + std::cos(x * z);
+    };
+    // odd in x
+    auto odd = [](double x, double y, double z) { return x * (1 + y * y + z * z); };
+    // invariant under rotations of the octahedral group, but odd under its
+    // reflections; zero on every mirror plane, so on every point of the
+    // small rules
+    auto chiral = [](double x, double y, double z)
+    {
+        return x * y * z * (x * x - y * y) * (y * y - z * z) * (z * z - x * x);
+    };
+
+    const lebedev::IntegrandSymmetry symmetries[] = {lebedev::IntegrandSymmetry::none,
+                                                     lebedev::IntegrandSymmetry::reflections,
+                                                     lebedev::IntegrandSymmetry::octahedral};
+
+    for (unsigned int n = 0; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n))
+            continue;
+
+        const auto order = lebedev::get_rule_order(n);
+        const lebedev::CompressedQuadraturePoints compressed(order);
+        const std::size_t n_generators = compressed.get_generator_points().size();
+
+        const double cubic_integral = compressed.evaluate_spherical_integral(cubic);
+        const double even_integral = compressed.evaluate_spherical_integral(even);
+        for (const lebedev::IntegrandSymmetry symmetry : symmetries)
+        {
+            std::size_t n_evaluations = 0;
+            auto counted_cubic = [&cubic, &n_evaluations](double x, double y, double z)
+            {
+                ++n_evaluations;
+                return cubic(x, y, z);
+            };
+
+            const double integral = compressed.evaluate_spherical_integral(counted_cubic, symmetry);
+            if (std::abs(integral - cubic_integral) > 1e-13 * std::abs(cubic_integral))
+            {
+                std::cout << "Order " << static_cast<unsigned int>(order) << " with symmetry "
+                          << static_cast<int>(symmetry) << " gives " << integral
+                          << " rather than " << cubic_integral << "\n";
+                return_code = 1;
+            }
+
+            const std::size_t n_checks = (LEBEDEV_CHECK_SYMMETRY
+                                          && symmetry != lebedev::IntegrandSymmetry::none)
+                                         ? 2 * n_generators : 0;
+            if (symmetry == lebedev::IntegrandSymmetry::octahedral
+                && n_evaluations != n_generators + n_checks)
+            {
+                std::cout << "Order " << static_cast<unsigned int>(order) << " evaluates "
+                          << n_evaluations << " points rather than one per orbit\n";
+                return_code = 1;
+            }
+            if (symmetry == lebedev::IntegrandSymmetry::reflections
+                && 2 * (n_evaluations - n_checks) > compressed.size())
+            {
+                std::cout << "Order " << static_cast<unsigned int>(order) << " evaluates "
+                          << n_evaluations << " points with reflection symmetry\n";
+                return_code = 1;
+            }
+        }
+
+        const lebedev::QuadraturePoints::scalar_function even_function = even;
+        const double reflected_integrals[]
+            = {compressed.evaluate_spherical_integral(even, lebedev::IntegrandSymmetry::reflections),
+               compressed.evaluate_spherical_integral(even_function,
+                                                      lebedev::IntegrandSymmetry::reflections)};
+        for (const double integral : reflected_integrals)
+            if (std::abs(integral - even_integral) > 1e-13 * std::abs(even_integral))
+            {
+                std::cout << "Order " << static_cast<unsigned int>(order)
+                          << " with reflection symmetry gives " << integral
+                          << " rather than " << even_integral << "\n";
+                return_code = 1;
+            }
+
+        if (!compressed.has_symmetry(cubic, lebedev::IntegrandSymmetry::octahedral)
+            || !compressed.has_symmetry(even, lebedev::IntegrandSymmetry::reflections)
+            || compressed.has_symmetry(odd, lebedev::IntegrandSymmetry::reflections)
+            || compressed.has_symmetry(odd, lebedev::IntegrandSymmetry::octahedral)
+            || compressed.has_symmetry(chiral, lebedev::IntegrandSymmetry::reflections)
+            || compressed.has_symmetry(chiral, lebedev::IntegrandSymmetry::octahedral)
+            || compressed.has_symmetry(even, lebedev::IntegrandSymmetry::octahedral))
+        {
+            std::cout << "Order " << static_cast<unsigned int>(order)
+                      << " misjudges the symmetry of an integrand\n";
+            return_code = 1;
+        }
+
+#if LEBEDEV_CHECK_SYMMETRY
+        try
+        {
+            compressed.evaluate_spherical_integral(odd, lebedev::IntegrandSymmetry::reflections);
+            std::cout << "Wrong symmetry hint was not caught\n";
+            return_code = 1;
+        }
+        catch (const std::invalid_argument&)
+        {}
+#endif
+    }
+
+    return return_code;
+}
@@ -0,0 +1,79 @@
+#include "lebedev_quadrature.hpp"
+#include "allocation_counter.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+using vec = std::vector<double>;
+
+void xyz_squared(const double *x, const double *y, const double *z, std::size_t n, double *values)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        values[i] = x[i]*x[i] * y[i]*y[i] * z[i]*z[i];
+}
+
+int main()
+{
+    int return_code = 0;
+
+    const auto quad_points = lebedev::QuadraturePoints(lebedev::QuadratureOrder::order_5810);
+    const auto small_quad_points = lebedev::QuadraturePoints(lebedev::QuadratureOrder::order_590);
+    const auto view = lebedev::QuadraturePointsView(quad_points);
+    const lebedev::QuadraturePoints::output_function std_function = xyz_squared;
+    auto lambda_func = [](const double *x, const double *y, const double *z, 
+                          std::size_t n, double *values) { xyz_squared(x, y, z, n, values); };
+
+    const double expected 
+        = quad_points.evaluate_spherical_integral([](const vec &x, const vec &y, const vec &z)
+                                                  {
+                                                      vec values(x.size());
+                                                      xyz_squared(x.data(), y.data(), z.data(), 
+                                                                  x.size(), values.data());
+                                                      return values;
+                                                  });
+
+    lebedev::IntegrationWorkspace workspace;
+    std::vector<double> buffer(quad_points.get_weights().size());
+
+    // the workspace grows on first use, after which nothing allocates
+    quad_points.evaluate_spherical_integral(lambda_func, workspace);
+    n_allocations = 0;
+
+    unsigned int n_mismatches = 0;
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        const double values[] 
+            = {quad_points.evaluate_spherical_integral(lambda_func, workspace),
+               quad_points.evaluate_spherical_integral(std_function, workspace),
+               quad_points.evaluate_spherical_integral(xyz_squared, workspace),
+               quad_points.evaluate_spherical_integral(lambda_func, buffer.data()),
+               quad_points.evaluate_spherical_integral(std_function, buffer.data()),
+               view.evaluate_spherical_integral(lambda_func, workspace),
+               view.evaluate_spherical_integral(std_function, buffer.data())};
+        for (double value : values)
+            if (value != expected)
+                ++n_mismatches;
+
+        // a smaller rule fits in the same workspace
+        small_quad_points.evaluate_spherical_integral(lambda_func, workspace);
+    }
+
+    if (n_allocations != 0)
+    {
+        std::cout << n_allocations << " allocations while integrating\n";
+        return_code = 1;
+    }
+    if (n_mismatches != 0)
+    {
+        std::cout << n_mismatches << " integrals differ from " << expected << "\n";
+        return_code = 1;
+    }
+    if (workspace.capacity() != quad_points.get_weights().size())
+    {
+        std::cout << "Workspace has room for " << workspace.capacity() << " values\n";
+        return_code = 1;
+    }
+
+    return return_code;
+}
@@ -0,0 +1,46 @@
+#include "lebedev_quadrature.hpp"
+#include "allocation_counter.hpp"
+
+#include <iostream>
+#include <vector>
+
+int main()
+{
+    // one arena big enough for the largest rule
+    const std::size_t max_n_points = 5810;
+    std::vector<double> arena(4 * max_n_points);
+
+    std::size_t total_allocations = 0;
+    std::size_t n_mismatches = 0;
+    for (unsigned int n = 0; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n))
+            continue;
+
+        const auto order = lebedev::get_rule_order(n);
+        const std::size_t n_points = lebedev::get_rule_descriptor(n).n_points;
+        double *x = arena.data();
+        double *y = x + n_points;
+        double *z = y + n_points;
+        double *w = z + n_points;
+
+        n_allocations = 0;
+        lebedev::generate_quadrature_points(order, x, y, z, w);
+        total_allocations += n_allocations;
+
+        const auto quad_points = lebedev::QuadraturePoints(order);
+        for (std::size_t i = 0; i < n_points; ++i)
+            if (x[i] != quad_points.get_x()[i]
+                || y[i] != quad_points.get_y()[i]
+                || z[i] != quad_points.get_z()[i]
+                || w[i] != quad_points.get_weights()[i])
+                ++n_mismatches;
+    }
+
+    std::cout << "Allocations while generating into caller buffers: " 
+              << total_allocations << "\n";
+    std::cout << "Entries differing from QuadraturePoints: " 
+              << n_mismatches << "\n";
+
+    return (total_allocations == 0 && n_mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+#include "lebedev_quadrature.hpp"
+#include "quadrature_rule.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+using vec = std::vector<double>;
+
+static_assert(lebedev::QuadratureRule<lebedev::QuadratureOrder::order_590>::size() == 590,
+              "size of rule is known at compile time");
+
+double xyz_squared(double x, double y, double z)
+{
+    return x*x * y*y * z*z;
+}
+
+vec xyz_squared_vec(const vec& x, const vec& y, const vec& z)
+{
+    vec return_vec(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+        return_vec[i] = x[i]*x[i] * y[i]*y[i] * z[i]*z[i];
+
+    return return_vec;
+}
+
+int main()
+{
+    constexpr auto quad_order = lebedev::QuadratureOrder::order_590;
+    const lebedev::QuadratureRule<quad_order> quad_rule;
+    const auto quad_points = lebedev::QuadraturePoints(quad_order);
+
+    auto lambda_func = [](double x, double y, double z) { return x*x * y*y * z*z; };
+    const lebedev::QuadraturePoints::scalar_function std_func = lambda_func;
+    const lebedev::QuadraturePoints::vector_function std_vec_func = xyz_squared_vec;
+
+    const double expected = quad_points.evaluate_spherical_integral(lambda_func);
+    const double values[] = {quad_rule.evaluate_spherical_integral(xyz_squared),
+                             quad_rule.evaluate_spherical_integral(lambda_func),
+                             quad_rule.evaluate_spherical_integral(std_func),
+                             quad_rule.evaluate_spherical_integral(xyz_squared_vec),
+                             quad_rule.evaluate_spherical_integral(std_vec_func)};
+
+    double error = 0;
+    for (double value : values)
+        error += std::abs(value - expected);
+
+    std::cout << "QuadraturePoints integration is: " << expected << "\n";
+    std::cout << "Actual integral value is: " << 4.0 * M_PI / 105.0 << "\n";
+    std::cout << "Difference between QuadratureRule and QuadraturePoints is: "
+              << error << "\n";
+
+    const bool same_points = std::equal(quad_rule.get_x().begin(), quad_rule.get_x().end(),
+                                        quad_points.get_x().begin())
+                             && std::equal(quad_rule.get_weights().begin(),
+                                           quad_rule.get_weights().end(),
+                                           quad_points.get_weights().begin());
+    std::cout << "Points match QuadraturePoints: " << same_points << "\n";
+
+    return (error < 1e-15 && same_points) ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+#include "lebedev_quadrature.hpp"
+#include "quadrature_tables.hpp"
+
+#include <iostream>
+#include <cstddef>
+
+using lebedev::QuadratureOrder;
+
+// the tables must be usable in constant expressions
+static_assert(lebedev::QuadratureTable<QuadratureOrder::order_6>::x[0] == 1.0,
+              "first point of order 6 rule is (1, 0, 0)");
+static_assert(lebedev::QuadratureTable<QuadratureOrder::order_5810>::weights.size() == 5810,
+              "order 5810 rule has 5810 points");
+
+
+
+/**
+ * Counts entries of the compile-time table which differ from the ones
+ * generated at runtime by `QuadraturePoints`
+ */
+template <QuadratureOrder quad_order>
+std::size_t count_mismatches()
+{
+    using table = lebedev::QuadratureTable<quad_order>;
+    const auto quad_points = lebedev::QuadraturePoints(quad_order);
+
+    if (quad_points.get_weights().size() != table::n_points)
+        return table::n_points;
+
+    std::size_t n_mismatches = 0;
+    for (std::size_t i = 0; i < table::n_points; ++i)
+        if (table::x[i] != quad_points.get_x()[i]
+            || table::y[i] != quad_points.get_y()[i]
+            || table::z[i] != quad_points.get_z()[i]
+            || table::weights[i] != quad_points.get_weights()[i])
+            ++n_mismatches;
+
+    return n_mismatches;
+}
+
+
+
+template <QuadratureOrder... quad_orders>
+std::size_t check_orders()
+{
+    std::size_t total_mismatches = 0;
+    for (std::size_t n_mismatches : {count_mismatches<quad_orders>()...})
+        total_mismatches += n_mismatches;
+
+    return total_mismatches;
+}
+
+
+
+int main()
+{
+    const std::size_t n_mismatches
+        = check_orders<QuadratureOrder::order_6,
+                       QuadratureOrder::order_14,
+                       QuadratureOrder::order_26,
+                       QuadratureOrder::order_38,
+                       QuadratureOrder::order_50,
+                       QuadratureOrder::order_74,
+                       QuadratureOrder::order_86,
+                       QuadratureOrder::order_110,
+                       QuadratureOrder::order_146,
+                       QuadratureOrder::order_170,
+                       QuadratureOrder::order_194,
+                       QuadratureOrder::order_230,
+                       QuadratureOrder::order_266,
+                       QuadratureOrder::order_302,
+                       QuadratureOrder::order_350,
+                       QuadratureOrder::order_434,
+                       QuadratureOrder::order_590,
+                       QuadratureOrder::order_770,
+                       QuadratureOrder::order_974,
+                       QuadratureOrder::order_1202,
+                       QuadratureOrder::order_1454,
+                       QuadratureOrder::order_1730,
+                       QuadratureOrder::order_2030,
+                       QuadratureOrder::order_2354,
+                       QuadratureOrder::order_2702,
+                       QuadratureOrder::order_3074,
+                       QuadratureOrder::order_3470,
+                       QuadratureOrder::order_3890,
+                       QuadratureOrder::order_4334,
+                       QuadratureOrder::order_4802,
+                       QuadratureOrder::order_5294,
+                       QuadratureOrder::order_5810>();
+
+    std::cout << "Entries differing from runtime generated points: "
+              << n_mismatches << "\n";
+
+    return n_mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+#include "lebedev_quadrature.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+/** Returns the rotation by `angle` about the unit vector (`a`, `b`, `c`) */
+lebedev::RotationMatrix axis_rotation(double a, double b, double c, double angle)
+{
+    const double s = std::sin(angle);
+    const double t = 1 - std::cos(angle);
+    return {1 - t * (b * b + c * c), t * a * b - s * c, t * a * c + s * b,
+            t * a * b + s * c, 1 - t * (a * a + c * c), t * b * c - s * a,
+            t * a * c - s * b, t * b * c + s * a, 1 - t * (a * a + b * b)};
+}
+
+
+
+int main()
+{
+    int return_code = 0;
+
+    std::vector<lebedev::RotationMatrix> rotations;
+    for (unsigned int r = 0; r < 37; ++r)
+    {
+        const double theta = std::acos(1 - 2 * std::fmod(0.3 + r * 0.618034, 1.0));
+        const double phi = 2 * M_PI * std::fmod(0.1 + r * 0.754878, 1.0);
+        rotations.push_back(axis_rotation(std::sin(theta) * std::cos(phi),
+                                          std::sin(theta) * std::sin(phi),
+                                          std::cos(theta), 0.1 + 0.37 * r));
+    }
+
+    auto integrand = [](double x, double y, double z) { return std::exp(x + 2 * y - z) + x * x * y; };
+    auto integrand_at_points = [&](const double *x, const double *y, const double *z,
+                                   std::size_t n, double *values)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            values[i] = integrand(x[i], y[i], z[i]);
+    };
+    // x^4 + y^2 z^2, which rules of precision 4 or more integrate exactly at any rotation
+    auto polynomial = [](double x, double y, double z) { return x * x * x * x + y * y * z * z; };
+    const double polynomial_integral = 4 * M_PI / 5 + 4 * M_PI / 15;
+
+    const lebedev::QuadratureOrder orders[] = {lebedev::QuadratureOrder::order_6,
+                                               lebedev::QuadratureOrder::order_302,
+                                               lebedev::QuadratureOrder::order_5810};
+    for (const lebedev::QuadratureOrder order : orders)
+    {
+        const lebedev::QuadraturePoints quad_points(order);
+        const std::size_t n = quad_points.get_weights().size();
+        lebedev::IntegrationWorkspace workspace;
+
+        std::vector<double> batched(rotations.size());
+        std::vector<double> batched_output(rotations.size());
+        std::vector<double> batched_function(rotations.size());
+        lebedev::evaluate_rotated_spherical_integrals(quad_points, rotations.data(),
+                                                      rotations.size(), integrand, batched.data());
+        lebedev::evaluate_rotated_spherical_integrals(quad_points, rotations.data(),
+                                                      rotations.size(), integrand_at_points,
+                                                      batched_output.data(), workspace);
+        lebedev::evaluate_rotated_spherical_integrals(
+            quad_points, rotations.data(), rotations.size(),
+            lebedev::QuadraturePoints::scalar_function(integrand), batched_function.data());
+
+        for (std::size_t r = 0; r < rotations.size(); ++r)
+        {
+            // rotating a copy of the points by hand
+            const lebedev::RotationMatrix &R = rotations[r];
+            std::vector<double> x(n), y(n), z(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const double p[3] = {quad_points.get_x()[i], quad_points.get_y()[i],
+                                     quad_points.get_z()[i]};
+                x[i] = R[0] * p[0] + R[1] * p[1] + R[2] * p[2];
+                y[i] = R[3] * p[0] + R[4] * p[1] + R[5] * p[2];
+                z[i] = R[6] * p[0] + R[7] * p[1] + R[8] * p[2];
+            }
+            const lebedev::QuadraturePointsView copy(x.data(), y.data(), z.data(),
+                                                     quad_points.get_weights().data(), n);
+            const double expected = copy.evaluate_spherical_integral(integrand);
+
+            const lebedev::RotatedQuadraturePointsView rotated(quad_points, R);
+            const double integrals[]
+                = {rotated.evaluate_spherical_integral(integrand),
+                   rotated.evaluate_spherical_integral(
+                       lebedev::QuadraturePoints::scalar_function(integrand)),
+                   rotated.evaluate_spherical_integral(integrand_at_points, workspace),
+                   rotated.evaluate_spherical_integral(
+                       lebedev::QuadraturePoints::output_function(integrand_at_points), workspace),
+                   batched[r], batched_output[r], batched_function[r]};
+
+            for (const double integral : integrals)
+                if (std::abs(integral - expected) > 1e-13 * std::abs(expected))
+                {
+                    std::cout << "Rotation " << r << " of order " << static_cast<unsigned int>(order)
+                              << " gives " << integral << " rather than " << expected << "\n";
+                    return_code = 1;
+                }
+
+            const double polynomial_value = rotated.evaluate_spherical_integral(polynomial);
+            if (order != lebedev::QuadratureOrder::order_6
+                && std::abs(polynomial_value - polynomial_integral) > 1e-13)
+            {
+                std::cout << "Rotation " << r << " of order " << static_cast<unsigned int>(order)
+                          << " integrates a quartic to " << polynomial_value << "\n";
+                return_code = 1;
+            }
+        }
+
+        // only one block of rotated points is ever held
+        if (workspace.capacity() != 4 * lebedev::integration_block_size)
+        {
+            std::cout << "Rotated integrals of order " << static_cast<unsigned int>(order)
+                      << " use " << workspace.capacity() << " doubles of workspace\n";
+            return_code = 1;
+        }
+    }
+
+    return return_code;
+}
@@ -0,0 +1,61 @@
+#include "lebedev_quadrature.hpp"
+
+#include <iostream>
+#include <stdexcept>
+
+int main()
+{
+    unsigned int n_failures = 0;
+
+    for (unsigned int n = 0; n < lebedev::number_of_rules; ++n)
+    {
+        const auto &descriptor = lebedev::get_rule_descriptor(n);
+        const unsigned int order = static_cast<unsigned int>(descriptor.order);
+
+        if (lebedev::get_order_enum(order) != descriptor.order
+            || lebedev::get_rule_number(descriptor.order) != n
+            || &lebedev::get_rule_descriptor(descriptor.order) != &descriptor)
+        {
+            std::cout << "Lookup of order " << order << " failed\n";
+            ++n_failures;
+        }
+
+        if (!descriptor.available)
+            continue;
+
+        // orbit counts must add up to the number of points, and agree with
+        // the points which are actually generated
+        unsigned int n_generators = 0;
+        unsigned int n_points = 0;
+        for (unsigned int rule = 0; rule < lebedev::n_generating_rules; ++rule)
+        {
+            n_generators += descriptor.n_orbits[rule];
+            n_points += descriptor.n_orbits[rule] 
+                        * lebedev::orbit_size(static_cast<lebedev::OhPointGen>(rule));
+        }
+
+        const auto quad_points = lebedev::QuadraturePoints(descriptor.order);
+        if (n_generators != descriptor.n_generators
+            || n_points != descriptor.n_points
+            || quad_points.get_weights().size() != descriptor.n_points)
+        {
+            std::cout << "Orbit structure of order " << order << " is inconsistent\n";
+            ++n_failures;
+        }
+    }
+
+    for (unsigned int order : {0u, 7u, 388u, 5811u, 100000u})
+    {
+        try
+        {
+            lebedev::get_order_enum(order);
+            std::cout << "Order " << order << " should not exist\n";
+            ++n_failures;
+        }
+        catch (const std::invalid_argument &) {}
+    }
+
+    std::cout << "Number of failures: " << n_failures << "\n";
+
+    return n_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using lebedev::QuadratureOrder;
+using lebedev::OhPointGen;
+
+/** Counts rules in `rule_pack` which differ from the ones generated by `QuadraturePoints` */
+std::size_t count_mismatched_rules(const lebedev::RulePack &rule_pack)
+{
+    std::size_t n_mismatches = 0;
+    std::size_t i = 0;
+    for (unsigned int rule_number = 0; rule_number < lebedev::number_of_rules; ++rule_number)
+    {
+        const auto &descriptor = lebedev::get_rule_descriptor(rule_number);
+        if (!descriptor.available)
+            continue;
+
+        const auto quad_points = lebedev::QuadraturePoints(descriptor.order);
+        const auto view = rule_pack.get_rule(i);
+        const auto generator_points = rule_pack.get_generator_points(i);
+
+        bool matches = view.size() == quad_points.get_weights().size()
+                       && rule_pack.get_precision(i) == descriptor.precision
+                       && generator_points.size() == descriptor.n_generators
+                       && rule_pack.get_rule(descriptor.order).get_x() == view.get_x()
+                       && reinterpret_cast<std::uintptr_t>(view.get_x()) % 64 == 0
+                       && reinterpret_cast<std::uintptr_t>(view.get_weights()) % 64 == 0;
+
+        for (std::size_t j = 0; matches && j < view.size(); ++j)
+            matches = view.get_x()[j] == quad_points.get_x()[j]
+                      && view.get_y()[j] == quad_points.get_y()[j]
+                      && view.get_z()[j] == quad_points.get_z()[j]
+                      && view.get_weights()[j] == quad_points.get_weights()[j];
+
+        const auto n_orbits = rule_pack.get_n_orbits(i);
+        for (unsigned int rule = 0; matches && rule < lebedev::n_generating_rules; ++rule)
+            matches = n_orbits[rule] == descriptor.n_orbits[rule];
+
+        const auto *table_generators = descriptor.get_generator_points();
+        for (std::size_t j = 0; matches && j < generator_points.size(); ++j)
+            matches = generator_points[j].get_a() == table_generators[j].get_a()
+                      && generator_points[j].get_b() == table_generators[j].get_b()
+                      && generator_points[j].get_c() == table_generators[j].get_c()
+                      && generator_points[j].get_weight() == table_generators[j].get_weight()
+                      && generator_points[j].get_generating_rule() 
+                         == table_generators[j].get_generating_rule();
+
+        if (!matches)
+            ++n_mismatches;
+        ++i;
+    }
+
+    return n_mismatches + (i != rule_pack.size());
+}
+
+
+
+/** Checks that opening `filename` is rejected */
+bool is_rejected(const std::string &filename)
+{
+    try
+    {
+        lebedev::RulePack rule_pack(filename);
+    }
+    catch (const std::invalid_argument&)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+
+
+int main()
+{
+    const std::string filename = "rule_pack_test.lebedev";
+    lebedev::write_rule_pack(filename);
+
+    lebedev::RulePack rule_pack(filename);
+    const std::size_t n_mismatches = count_mismatched_rules(rule_pack);
+    std::cout << "Rules in pack: " << rule_pack.size() << "\n";
+    std::cout << "Rules differing from QuadraturePoints: " << n_mismatches << "\n";
+
+    // rules which are not compiled in may be added to a pack
+    const std::string custom_filename = "rule_pack_test_custom.lebedev";
+    lebedev::write_rule_pack(custom_filename, 
+                             {{3, {lebedev::GeneratorPoint(1, 0, 0, 1.0 / 6.0, 
+                                                           OhPointGen::points_6)}}});
+    const lebedev::RulePack custom_pack(custom_filename);
+    const double integral = custom_pack.get_rule(QuadratureOrder::order_6)
+                                .evaluate_spherical_integral([](double x, double, double)
+                                                             { return x*x; });
+    const double error = std::abs(integral - 4.0 * M_PI / 3.0);
+    std::cout << "Custom rule error integrating x^2: " << error << "\n";
+
+    // moving a pack hands over its mapping
+    lebedev::RulePack moved_pack(std::move(rule_pack));
+    const bool moved = rule_pack.size() == 0 && moved_pack.size() > 0;
+
+    // corrupt and truncated files must be rejected
+    {
+        std::ofstream corrupt(custom_filename, std::ios::binary | std::ios::trunc);
+        corrupt << "not a rule pack, but long enough to hold a rule pack header ....";
+    }
+    const bool rejected = is_rejected(custom_filename);
+    std::cout << "Corrupt pack rejected: " << rejected << "\n";
+
+    std::vector<char> contents;
+    {
+        std::ifstream pack(filename, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(pack), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream truncated(custom_filename, std::ios::binary | std::ios::trunc);
+        truncated.write(contents.data(), static_cast<std::streamsize>(contents.size() / 2));
+    }
+    const bool truncated_rejected = is_rejected(custom_filename);
+    std::cout << "Truncated pack rejected: " << truncated_rejected << "\n";
+
+    // rewriting a pack replaces the file rather than overwriting the mapped one
+    lebedev::write_rule_pack(filename);
+    const bool still_mapped = count_mismatched_rules(moved_pack) == 0
+                              && count_mismatched_rules(lebedev::RulePack(filename)) == 0;
+    std::cout << "Pack still valid after rewrite: " << still_mapped << "\n";
+
+    return (n_mismatches == 0 && error < 1e-14 && moved && rejected && truncated_rejected
+            && still_mapped) ? 0 : 1;
+}
@@ -0,0 +1,56 @@
+#include "lebedev_quadrature.hpp"
+
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using handle = std::shared_ptr<const lebedev::QuadraturePoints>;
+
+int main()
+{
+    constexpr unsigned int n_threads = 8;
+    constexpr unsigned int n_requests = 100;
+
+    const auto orders = {lebedev::QuadratureOrder::order_590,
+                         lebedev::QuadratureOrder::order_5810};
+
+    // every thread repeatedly requests the same rules at the same time
+    std::vector<std::vector<handle>> handles(n_threads);
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < n_threads; ++i)
+        threads.emplace_back([&, i]()
+                             {
+                                 for (unsigned int j = 0; j < n_requests; ++j)
+                                     for (auto order : orders)
+                                         handles[i].push_back(lebedev::QuadraturePoints::shared(order));
+                             });
+    for (auto &thread : threads)
+        thread.join();
+
+    unsigned int n_distinct = 0;
+    for (unsigned int i = 0; i < n_threads; ++i)
+        for (std::size_t j = 0; j < handles[i].size(); ++j)
+            if (handles[i][j] != handles[0][j % orders.size()])
+                ++n_distinct;
+
+    std::size_t expected_memory_usage = 0;
+    for (auto order : orders)
+        expected_memory_usage += lebedev::QuadraturePoints(order).memory_usage();
+
+    const auto reference = lebedev::QuadraturePoints(lebedev::QuadratureOrder::order_5810);
+    const bool same_points 
+        = (reference.get_x() == handles[0][1]->get_x())
+          && (reference.get_weights() == handles[0][1]->get_weights());
+
+    std::cout << "Handles not pointing to the shared rule: " << n_distinct << "\n";
+    std::cout << "Shared rule matches constructed rule: " << same_points << "\n";
+    std::cout << "Shared memory usage is: " 
+              << lebedev::QuadraturePoints::shared_memory_usage() << " bytes\n";
+    std::cout << "Expected memory usage is: " << expected_memory_usage << " bytes\n";
+
+    return (n_distinct == 0 
+            && same_points 
+            && lebedev::QuadraturePoints::shared_memory_usage() == expected_memory_usage) 
+           ? 0 : 1;
+}
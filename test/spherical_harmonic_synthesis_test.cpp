@@ -0,0 +1,168 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+int main()
+{
+    int return_code = 0;
+
+    // every rule pairs its points, and synthesis inverts analysis up to
+    // half its precision
+    for (unsigned int n = 0; n < lebedev::number_of_rules; ++n)
+    {
+        if (!lebedev::get_rule_availability(n))
+            continue;
+
+        const auto &descriptor = lebedev::get_rule_descriptor(n);
+        if (descriptor.n_points > 1202)
+            break;
+
+        const unsigned int l_max = std::min(descriptor.precision / 2, 12u);
+        const lebedev::SphericalHarmonicTransform transform(descriptor.order, l_max);
+        if (2 * transform.n_point_pairs() < transform.n_points()
+            || transform.n_point_pairs() >= transform.n_points())
+        {
+            std::cout << "Order " << descriptor.n_points << " has "
+                      << transform.n_point_pairs() << " pairs of points\n";
+            return_code = 1;
+        }
+
+        const std::size_t n_fields = 3;
+        std::vector<double> expected(n_fields * transform.n_coefficients());
+        for (std::size_t k = 0; k < expected.size(); ++k)
+            expected[k] = std::cos(0.5 + k);
+
+        std::vector<double> fields(n_fields * transform.n_points());
+        std::vector<double> coefficients(expected.size());
+        transform.synthesize(expected.data(), n_fields, fields.data());
+        transform.analyze(fields.data(), n_fields, coefficients.data());
+        for (std::size_t k = 0; k < coefficients.size(); ++k)
+            if (std::abs(coefficients[k] - expected[k]) > 1e-12)
+            {
+                std::cout << "Order " << descriptor.n_points << " gives coefficient " << k
+                          << " as " << coefficients[k] << " rather than " << expected[k] << "\n";
+                return_code = 1;
+                break;
+            }
+    }
+
+    const unsigned int l_max = 16;
+    const lebedev::QuadraturePoints quad_points(lebedev::QuadratureOrder::order_434);
+    const lebedev::SphericalHarmonicTransform transform(quad_points, l_max);
+    const std::size_t n_points = transform.n_points();
+    const std::size_t n_coefficients = transform.n_coefficients();
+
+    // more fields than filter_field_block_size, and not a multiple of it
+    const std::size_t n_fields = lebedev::filter_field_block_size + 3;
+    std::vector<double> coefficients(n_fields * n_coefficients);
+    for (std::size_t k = 0; k < coefficients.size(); ++k)
+        coefficients[k] = std::sin(2.0 + 3.0 * k);
+
+    // synthesis must match the expansion evaluated at each point
+    std::vector<double> fields(n_fields * n_points);
+    transform.synthesize(coefficients.data(), n_fields, fields.data());
+    std::vector<double> harmonics(n_coefficients);
+    for (std::size_t i = 0; i < n_points; ++i)
+    {
+        lebedev::real_spherical_harmonics(quad_points.get_x()[i], quad_points.get_y()[i],
+                                          quad_points.get_z()[i], l_max, harmonics.data());
+        for (std::size_t f = 0; f < n_fields; ++f)
+        {
+            double value = 0;
+            for (std::size_t k = 0; k < n_coefficients; ++k)
+                value += coefficients[f * n_coefficients + k] * harmonics[k];
+
+            if (std::abs(fields[f * n_points + i] - value) > 1e-12)
+            {
+                std::cout << "Field " << f << " is " << fields[f * n_points + i]
+                          << " at point " << i << " rather than " << value << "\n";
+                return_code = 1;
+            }
+        }
+    }
+
+    // the fused filter must match analysis, scaling, and synthesis
+    std::vector<double> degree_factors(l_max + 1);
+    for (unsigned int l = 0; l <= l_max; ++l)
+        degree_factors[l] = l < 10 ? std::exp(-0.01 * l * (l + 1)) : 0.0;
+
+    std::vector<double> expected_coefficients(coefficients.size());
+    transform.analyze(fields.data(), n_fields, expected_coefficients.data());
+    for (std::size_t f = 0; f < n_fields; ++f)
+        for (unsigned int l = 0; l <= l_max; ++l)
+            for (int m = -static_cast<int>(l); m <= static_cast<int>(l); ++m)
+                expected_coefficients[f * n_coefficients + lebedev::spherical_harmonic_index(l, m)]
+                    *= degree_factors[l];
+    std::vector<double> expected_fields(fields.size());
+    transform.synthesize(expected_coefficients.data(), n_fields, expected_fields.data());
+
+    std::vector<double> filtered(fields.size());
+    transform.filter(fields.data(), n_fields, degree_factors.data(), filtered.data());
+    transform.filter(fields.data(), n_fields, degree_factors.data(), fields.data());
+    for (std::size_t i = 0; i < fields.size(); ++i)
+        if (std::abs(filtered[i] - expected_fields[i]) > 1e-12
+            || fields[i] != filtered[i])
+        {
+            std::cout << "Filtered value " << i << " is " << filtered[i] << " and "
+                      << fields[i] << " in place, rather than " << expected_fields[i] << "\n";
+            return_code = 1;
+            break;
+        }
+
+    // complex synthesis must invert complex analysis, and give the
+    // expansion in Y_lm = (-1)^m (Y^R_lm + i Y^R_l,-m) / sqrt(2) and
+    // Y_l,-m = (Y^R_lm - i Y^R_l,-m) / sqrt(2) for m > 0
+    const std::size_t n_complex_fields = 2;
+    std::vector<std::complex<double>> complex_coefficients(n_complex_fields * n_coefficients);
+    for (std::size_t k = 0; k < complex_coefficients.size(); ++k)
+        complex_coefficients[k] = std::complex<double>(std::cos(1.0 + k), std::sin(2.0 * k));
+
+    std::vector<std::complex<double>> complex_fields(n_complex_fields * n_points);
+    transform.synthesize(complex_coefficients.data(), n_complex_fields, complex_fields.data());
+    for (std::size_t i = 0; i < n_points; ++i)
+    {
+        lebedev::real_spherical_harmonics(quad_points.get_x()[i], quad_points.get_y()[i],
+                                          quad_points.get_z()[i], l_max, harmonics.data());
+        for (std::size_t f = 0; f < n_complex_fields; ++f)
+        {
+            const std::complex<double> *c = complex_coefficients.data() + f * n_coefficients;
+            std::complex<double> value = 0;
+            for (unsigned int l = 0; l <= l_max; ++l)
+            {
+                const std::size_t k = lebedev::spherical_harmonic_index(l, 0);
+                value += c[k] * harmonics[k];
+                for (unsigned int m = 1; m <= l; ++m)
+                {
+                    const std::complex<double> y_plus(harmonics[k + m], harmonics[k - m]);
+                    const double sign = m % 2 == 0 ? 1.0 : -1.0;
+                    value += c[k + m] * sign * M_SQRT1_2 * y_plus
+                             + c[k - m] * M_SQRT1_2 * std::conj(y_plus);
+                }
+            }
+
+            if (std::abs(complex_fields[f * n_points + i] - value) > 1e-12)
+            {
+                std::cout << "Complex field " << f << " is " << complex_fields[f * n_points + i]
+                          << " at point " << i << " rather than " << value << "\n";
+                return_code = 1;
+            }
+        }
+    }
+
+    std::vector<std::complex<double>> complex_analysis(complex_coefficients.size());
+    transform.analyze(complex_fields.data(), n_complex_fields, complex_analysis.data());
+    for (std::size_t k = 0; k < complex_analysis.size(); ++k)
+        if (std::abs(complex_analysis[k] - complex_coefficients[k]) > 1e-12)
+        {
+            std::cout << "Complex coefficient " << k << " is " << complex_analysis[k]
+                      << " rather than " << complex_coefficients[k] << "\n";
+            return_code = 1;
+            break;
+        }
+
+    return return_code;
+}
@@ -0,0 +1,144 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+int main()
+{
+    int return_code = 0;
+
+    // degree one harmonics are sqrt(3 / 4 pi) times the coordinates
+    {
+        const double x = 0.48, y = -0.6, z = 0.64;
+        std::vector<double> values(lebedev::n_spherical_harmonics(1));
+        lebedev::real_spherical_harmonics(x, y, z, 1, values.data());
+
+        const double c = std::sqrt(3 / (4 * M_PI));
+        const double expected[] = {1 / std::sqrt(4 * M_PI), c * y, c * z, c * x};
+        for (std::size_t k = 0; k < values.size(); ++k)
+            if (std::abs(values[k] - expected[k]) > 1e-15)
+            {
+                std::cout << "Harmonic " << k << " is " << values[k]
+                          << " rather than " << expected[k] << "\n";
+                return_code = 1;
+            }
+    }
+
+    // order 590 has precision 41, so products of harmonics of degree 20 are exact
+    const unsigned int l_max = 20;
+    const lebedev::QuadraturePoints quad_points(lebedev::QuadratureOrder::order_590);
+    const lebedev::SphericalHarmonicTransform transform(lebedev::QuadratureOrder::order_590,
+                                                       l_max);
+    const std::size_t n_points = transform.n_points();
+    const std::size_t n_coefficients = transform.n_coefficients();
+
+    // harmonics at each point, one point after another
+    std::vector<double> harmonics(n_points * n_coefficients);
+    for (std::size_t i = 0; i < n_points; ++i)
+        lebedev::real_spherical_harmonics(quad_points.get_x()[i], quad_points.get_y()[i],
+                                          quad_points.get_z()[i], l_max,
+                                          harmonics.data() + i * n_coefficients);
+
+    // fields built from known coefficients, which analysis should recover;
+    // an odd number exercises the fields left over from blocks of four
+    const std::size_t n_fields = 7;
+    std::vector<double> expected(n_fields * n_coefficients);
+    for (std::size_t k = 0; k < expected.size(); ++k)
+        expected[k] = std::sin(1.0 + k);
+
+    std::vector<double> fields(n_fields * n_points, 0.0);
+    for (std::size_t f = 0; f < n_fields; ++f)
+        for (std::size_t i = 0; i < n_points; ++i)
+            for (std::size_t k = 0; k < n_coefficients; ++k)
+                fields[f * n_points + i] += expected[f * n_coefficients + k]
+                                            * harmonics[i * n_coefficients + k];
+
+    std::vector<double> coefficients(n_fields * n_coefficients);
+    transform.analyze(fields.data(), n_fields, coefficients.data());
+    for (std::size_t k = 0; k < coefficients.size(); ++k)
+        if (std::abs(coefficients[k] - expected[k]) > 1e-12)
+        {
+            std::cout << "Real coefficient " << k << " is " << coefficients[k]
+                      << " rather than " << expected[k] << "\n";
+            return_code = 1;
+            break;
+        }
+
+    // each coefficient must match an integral of the field times a harmonic
+    const unsigned int l = 7;
+    const int m = -3;
+    const double integral = quad_points.evaluate_spherical_integral(
+        [&](double x, double y, double z)
+        {
+            std::vector<double> values(n_coefficients);
+            lebedev::real_spherical_harmonics(x, y, z, l_max, values.data());
+            double field = 0;
+            for (std::size_t k = 0; k < n_coefficients; ++k)
+                field += expected[k] * values[k];
+
+            return field * values[lebedev::spherical_harmonic_index(l, m)];
+        });
+    if (std::abs(integral - coefficients[lebedev::spherical_harmonic_index(l, m)]) > 1e-12)
+    {
+        std::cout << "Analysis does not match the integral " << integral << "\n";
+        return_code = 1;
+    }
+
+    // complex fields built from complex harmonics, with the Condon-Shortley
+    // phase, Y_lm = (-1)^m (Y^R_lm + i Y^R_l,-m) / sqrt(2) and
+    // Y_l,-m = (Y^R_lm - i Y^R_l,-m) / sqrt(2) for m > 0
+    std::vector<std::complex<double>> complex_expected(n_fields * n_coefficients);
+    for (std::size_t k = 0; k < complex_expected.size(); ++k)
+        complex_expected[k] = std::complex<double>(std::cos(2.0 + k), std::sin(3.0 * k));
+
+    std::vector<std::complex<double>> complex_fields(n_fields * n_points, 0.0);
+    for (std::size_t f = 0; f < n_fields; ++f)
+        for (std::size_t i = 0; i < n_points; ++i)
+        {
+            const double *row = harmonics.data() + i * n_coefficients;
+            const std::complex<double> *c = complex_expected.data() + f * n_coefficients;
+            std::complex<double> value = 0;
+            for (unsigned int degree = 0; degree <= l_max; ++degree)
+            {
+                const std::size_t k = lebedev::spherical_harmonic_index(degree, 0);
+                value += c[k] * row[k];
+                for (unsigned int order = 1; order <= degree; ++order)
+                {
+                    const std::complex<double> y_plus(row[k + order], row[k - order]);
+                    const double sign = order % 2 == 0 ? 1.0 : -1.0;
+                    value += c[k + order] * sign * M_SQRT1_2 * y_plus
+                             + c[k - order] * M_SQRT1_2 * std::conj(y_plus);
+                }
+            }
+            complex_fields[f * n_points + i] = value;
+        }
+
+    std::vector<std::complex<double>> complex_coefficients(n_fields * n_coefficients);
+    transform.analyze(complex_fields.data(), n_fields, complex_coefficients.data());
+    for (std::size_t k = 0; k < complex_coefficients.size(); ++k)
+        if (std::abs(complex_coefficients[k] - complex_expected[k]) > 1e-12)
+        {
+            std::cout << "Complex coefficient " << k << " is " << complex_coefficients[k]
+                      << " rather than " << complex_expected[k] << "\n";
+            return_code = 1;
+            break;
+        }
+
+    // shared transforms are tabulated once per rule and degree
+    const auto shared = lebedev::SphericalHarmonicTransform::shared(
+        lebedev::QuadratureOrder::order_590, l_max);
+    if (shared != lebedev::SphericalHarmonicTransform::shared(lebedev::QuadratureOrder::order_590,
+                                                              l_max)
+        || shared == lebedev::SphericalHarmonicTransform::shared(lebedev::QuadratureOrder::order_590,
+                                                                 l_max - 1)
+        || shared->memory_usage() != transform.memory_usage())
+    {
+        std::cout << "Shared transforms are not reused\n";
+        return_code = 1;
+    }
+
+    return return_code;
+}
@@ -0,0 +1,201 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+int main()
+{
+    int return_code = 0;
+
+    const lebedev::SimdKernel kernels[] = {lebedev::SimdKernel::scalar,
+                                           lebedev::SimdKernel::sse2,
+                                           lebedev::SimdKernel::avx2,
+                                           lebedev::SimdKernel::avx512,
+                                           lebedev::SimdKernel::neon};
+    const lebedev::Summation policies[] = {lebedev::Summation::naive,
+                                           lebedev::Summation::pairwise,
+                                           lebedev::Summation::neumaier,
+                                           lebedev::Summation::double_double};
+
+    // every length up to a few vectors, plus several pairwise blocks
+    std::vector<std::size_t> lengths = {1000, 5810};
+    for (std::size_t n = 0; n <= 70; ++n)
+        lengths.push_back(n);
+
+    for (const lebedev::SimdKernel kernel : kernels)
+        for (const lebedev::Summation summation : policies)
+        {
+            if (!lebedev::is_simd_kernel_supported(kernel))
+            {
+                try
+                {
+                    lebedev::weighted_sum(summation, kernel, nullptr, nullptr, 0);
+                    std::cout << "Unsupported kernel was not rejected\n";
+                    return_code = 1;
+                }
+                catch (const std::invalid_argument&)
+                {}
+
+                continue;
+            }
+
+            for (const std::size_t n : lengths)
+            {
+                // one extra entry, which must not be read
+                std::vector<double> values(n + 1, NAN);
+                std::vector<double> weights(n + 1, NAN);
+                long double expected = 0;
+                long double magnitude = 0;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    values[i] = std::sin(1.0 + i);
+                    weights[i] = 1.0 / (1.0 + i);
+                    expected += static_cast<long double>(values[i]) * weights[i];
+                    magnitude += std::abs(static_cast<long double>(values[i]) * weights[i]);
+                }
+
+                const double value
+                    = lebedev::weighted_sum(summation, kernel, values.data(), weights.data(), n);
+                if (std::abs(value - expected) > 1e-15 * (1 + magnitude))
+                {
+                    std::cout << "Policy " << static_cast<int>(summation)
+                              << " with kernel " << static_cast<int>(kernel) << " gives " << value
+                              << " for length " << n << " rather than "
+                              << static_cast<double>(expected) << "\n";
+                    return_code = 1;
+                }
+            }
+        }
+
+    // large terms which cancel exactly, hiding small ones: the compensated
+    // policies recover the small terms, which a naive sum loses entirely
+    {
+        constexpr std::size_t n_large = 500;
+        std::vector<double> values;
+        double expected = 0;
+        for (std::size_t i = 0; i < n_large; ++i)
+        {
+            values.push_back(std::ldexp(std::sin(1.0 + i), 40));
+            values.push_back(std::ldexp(static_cast<double>(i % 7), -10));
+            expected += values.back();
+        }
+        for (std::size_t i = 0; i < n_large; ++i)
+            values.push_back(-values[2 * i]);
+        const std::vector<double> weights(values.size(), 1.0);
+
+        for (const lebedev::SimdKernel kernel : kernels)
+            for (const lebedev::Summation summation : {lebedev::Summation::neumaier,
+                                                       lebedev::Summation::double_double})
+            {
+                if (!lebedev::is_simd_kernel_supported(kernel))
+                    continue;
+
+                const double value = lebedev::weighted_sum(summation, kernel, values.data(),
+                                                           weights.data(), values.size());
+                if (std::abs(value - expected) > 1e-13 * expected)
+                {
+                    std::cout << "Policy " << static_cast<int>(summation)
+                              << " with kernel " << static_cast<int>(kernel)
+                              << " gives " << value << " for cancelling sum rather than "
+                              << expected << "\n";
+                    return_code = 1;
+                }
+            }
+    }
+
+    // (1 + 2^-30)(1 - 2^-30) - 1 is -2^-60, but the product rounds to 1, so
+    // only the double-double policy, which keeps the product's error, gets it
+    {
+        const double values[] = {1 + std::ldexp(1.0, -30), 1.0};
+        const double weights[] = {1 - std::ldexp(1.0, -30), -1.0};
+        for (const lebedev::SimdKernel kernel : kernels)
+        {
+            if (!lebedev::is_simd_kernel_supported(kernel))
+                continue;
+
+            const double value = lebedev::weighted_sum(lebedev::Summation::double_double, kernel,
+                                                       values, weights, 2);
+            if (value != -std::ldexp(1.0, -60))
+            {
+                std::cout << "Double-double product error is lost with kernel "
+                          << static_cast<int>(kernel) << ", giving " << value << "\n";
+                return_code = 1;
+            }
+        }
+    }
+
+    // many equal terms: the naive sum's error grows with their number, the
+    // pairwise sum's barely does
+    {
+        const std::vector<double> values(1 << 20, 0.1);
+        const std::vector<double> weights(values.size(), 1.0);
+        const long double expected = static_cast<long double>(0.1) * values.size();
+        const double value = lebedev::weighted_sum(lebedev::Summation::pairwise, values.data(),
+                                                   weights.data(), values.size());
+        if (std::abs(value - expected) > 1e-14 * expected)
+        {
+            std::cout << "Pairwise sum of equal terms gives " << value << " rather than "
+                      << static_cast<double>(expected) << "\n";
+            return_code = 1;
+        }
+    }
+
+    // integrals of a large integrand which nearly cancels
+    {
+        const auto quad_points = lebedev::QuadraturePoints(lebedev::QuadratureOrder::order_5810);
+        const auto &x = quad_points.get_x();
+        const auto &weights = quad_points.get_weights();
+        auto integrand = [](double x) { return 1e12 * (x * x - 1.0 / 3.0) + 1.0; };
+
+        // compensated, since even long double loses digits to this cancellation
+        long double expected = 0;
+        long double compensation = 0;
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            const long double term = static_cast<long double>(integrand(x[i])) * weights[i];
+            const long double sum = expected + term;
+            const long double term_rounded = sum - expected;
+            compensation += (expected - (sum - term_rounded)) + (term - term_rounded);
+            expected = sum;
+        }
+        expected = 4 * M_PI * (expected + compensation);
+
+        auto vector_integrand = [&integrand](const std::vector<double> &x,
+                                             const std::vector<double> &,
+                                             const std::vector<double> &)
+        {
+            std::vector<double> values(x.size());
+            for (std::size_t i = 0; i < x.size(); ++i)
+                values[i] = integrand(x[i]);
+            return values;
+        };
+        auto output_integrand = [&integrand](const double *x, const double *, const double *,
+                                             std::size_t n, double *values)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+                values[i] = integrand(x[i]);
+        };
+        const lebedev::QuadraturePoints::vector_function vector_function = vector_integrand;
+        const lebedev::QuadraturePoints::output_function output_function = output_integrand;
+
+        lebedev::IntegrationWorkspace workspace;
+        const auto summation = lebedev::Summation::double_double;
+        const double integrals[]
+            = {quad_points.evaluate_spherical_integral(vector_integrand, summation),
+               quad_points.evaluate_spherical_integral(output_integrand, workspace, summation),
+               quad_points.evaluate_spherical_integral(vector_function, summation),
+               quad_points.evaluate_spherical_integral(output_function, workspace, summation)};
+        for (const double integral : integrals)
+            if (std::abs(integral - expected) > 1e-6)
+            {
+                std::cout << "Double-double integral is " << integral << " rather than "
+                          << static_cast<double>(expected) << "\n";
+                return_code = 1;
+            }
+    }
+
+    return return_code;
+}
@@ -0,0 +1,134 @@
+#include "lebedev_quadrature.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+/** Integrand which takes a while to evaluate, like one solving a small system per point */
+double expensive_integrand(double x, double y, double z)
+{
+    double t = x + 2*y + 3*z;
+    for (int i = 0; i < 20; ++i)
+        t = std::cos(t) + 0.5 * x;
+
+    return t;
+}
+
+int main()
+{
+    int return_code = 0;
+
+    const auto quad_points = lebedev::QuadraturePoints(lebedev::QuadratureOrder::order_5810);
+    const auto view = lebedev::QuadraturePointsView(quad_points);
+
+    // every task runs exactly once
+    lebedev::ThreadPool pool(4);
+    std::vector<std::atomic<int>> counts(1000);
+    pool.run(counts.size(), [&](std::size_t i) { ++counts[i]; });
+    for (const auto &count : counts)
+        if (count != 1)
+        {
+            std::cout << "Task ran " << count << " times\n";
+            return_code = 1;
+            break;
+        }
+
+    // the same tasks give the same result with any number of threads
+    const double serial = quad_points.evaluate_spherical_integral(expensive_integrand);
+    lebedev::ThreadPool single_thread(1);
+    const double reference = quad_points.evaluate_spherical_integral(expensive_integrand, 
+                                                                     single_thread, 100);
+    for (unsigned int n_threads : {2, 3, 8})
+    {
+        lebedev::ThreadPool other_pool(n_threads);
+        for (unsigned int repeat = 0; repeat < 5; ++repeat)
+            if (quad_points.evaluate_spherical_integral(expensive_integrand, other_pool, 100) 
+                != reference)
+            {
+                std::cout << "Result differs with " << n_threads << " threads\n";
+                return_code = 1;
+            }
+    }
+    if (std::abs(reference - serial) > 1e-13 * std::abs(serial)
+        || view.evaluate_spherical_integral(expensive_integrand, pool, 100) != reference)
+    {
+        std::cout << "Parallel integral " << reference << " differs from " << serial << "\n";
+        return_code = 1;
+    }
+
+    // a single task is the sequential sum
+    if (quad_points.evaluate_spherical_integral(expensive_integrand, pool, 10000) != serial)
+    {
+        std::cout << "Small integral was not computed serially\n";
+        return_code = 1;
+    }
+
+    // nested runs fall back to the calling thread rather than deadlocking
+    std::atomic<int> n_nested{0};
+    pool.run(8, [&](std::size_t)
+                {
+                    pool.run(4, [&](std::size_t) { ++n_nested; });
+                });
+    if (n_nested != 32)
+    {
+        std::cout << n_nested << " nested tasks ran\n";
+        return_code = 1;
+    }
+
+    // exceptions reach the caller, and the pool stays usable
+    try
+    {
+        quad_points.evaluate_spherical_integral([](double x, double, double) -> double
+                                                {
+                                                    if (x > 0.99)
+                                                        throw std::domain_error("bad point");
+                                                    return x;
+                                                },
+                                                pool, 100);
+        std::cout << "Exception was not rethrown\n";
+        return_code = 1;
+    }
+    catch (const std::domain_error&)
+    {}
+    if (quad_points.evaluate_spherical_integral(expensive_integrand, pool, 100) != reference)
+    {
+        std::cout << "Pool is not usable after an exception\n";
+        return_code = 1;
+    }
+
+    // runs on the calling thread alone (no workers, or nested) also finish
+    // every task before rethrowing
+    std::atomic<int> n_after_throw{0};
+    auto throwing_task = [&](std::size_t i)
+    {
+        if (i == 0)
+            throw std::domain_error("first task");
+        ++n_after_throw;
+    };
+    try
+    {
+        single_thread.run(8, throwing_task);
+        std::cout << "Exception was not rethrown without workers\n";
+        return_code = 1;
+    }
+    catch (const std::domain_error&)
+    {}
+    try
+    {
+        pool.run(1, [&](std::size_t) { pool.run(8, throwing_task); });
+        std::cout << "Exception was not rethrown from a nested run\n";
+        return_code = 1;
+    }
+    catch (const std::domain_error&)
+    {}
+    if (n_after_throw != 14)
+    {
+        std::cout << n_after_throw << " tasks ran after a task threw, rather than 14\n";
+        return_code = 1;
+    }
+
+    return return_code;
+}
@@ -0,0 +1,73 @@
+#include "lebedev_quadrature.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+int main()
+{
+    int return_code = 0;
+
+    const lebedev::SimdKernel kernels[] = {lebedev::SimdKernel::scalar,
+                                           lebedev::SimdKernel::sse2,
+                                           lebedev::SimdKernel::avx2,
+                                           lebedev::SimdKernel::avx512,
+                                           lebedev::SimdKernel::neon};
+
+    if (!lebedev::is_simd_kernel_supported(lebedev::get_simd_kernel()))
+    {
+        std::cout << "Chosen kernel is not supported\n";
+        return_code = 1;
+    }
+
+    // every length up to a few vectors, to exercise all of the remainder loops
+    std::vector<std::size_t> lengths = {5810};
+    for (std::size_t n = 0; n <= 70; ++n)
+        lengths.push_back(n);
+
+    for (const lebedev::SimdKernel kernel : kernels)
+    {
+        if (!lebedev::is_simd_kernel_supported(kernel))
+        {
+            try
+            {
+                lebedev::weighted_sum(kernel, nullptr, nullptr, 0);
+                std::cout << "Unsupported kernel was not rejected\n";
+                return_code = 1;
+            }
+            catch (const std::invalid_argument&)
+            {}
+
+            continue;
+        }
+
+        for (const std::size_t n : lengths)
+        {
+            // one extra entry, which must not be read
+            std::vector<double> values(n + 1, NAN);
+            std::vector<double> weights(n + 1, NAN);
+            long double expected = 0;
+            long double magnitude = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                values[i] = std::sin(1.0 + i);
+                weights[i] = 1.0 / (1.0 + i);
+                expected += static_cast<long double>(values[i]) * weights[i];
+                magnitude += std::abs(static_cast<long double>(values[i]) * weights[i]);
+            }
+
+            const double value = lebedev::weighted_sum(kernel, values.data(), weights.data(), n);
+            if (std::abs(value - expected) > 1e-15 * (1 + magnitude))
+            {
+                std::cout << "Kernel " << static_cast<int>(kernel) << " gives " << value 
+                          << " for length " << n << " rather than " << static_cast<double>(expected) 
+                          << "\n";
+                return_code = 1;
+            }
+        }
+    }
+
+    return return_code;
+}